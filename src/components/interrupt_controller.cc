@@ -0,0 +1,71 @@
+#include "interrupt_controller.h" //InterruptController
+
+namespace mygbc{
+
+    /// @brief Binds the controller to the high page of the arena.
+    /// @param arena Arena holding the high page
+    /// @param region Index of the high page region in the layout
+    InterruptController::InterruptController(std::shared_ptr<MemoryArena> arena, const std::size_t region)
+    :arena_(std::move(arena)), region_(region), pending_(0){
+        const std::size_t high_page_offset = arena_->get_region_offset(region_);
+        interrupt_flag_ = high_page_offset + interrupt_flag_offset;
+        interrupt_enable_ = high_page_offset + interrupt_enable_offset;
+        refresh();
+    }
+
+    /// @brief Requests the interrupt by setting its bit in IF.
+    /// @param interrupt Interrupt to request
+    void InterruptController::request(const Interrupt interrupt) noexcept{
+        set_interrupt_flag(arena_->get_byte(interrupt_flag_) | static_cast<uint8_t>(interrupt));
+    }
+
+    /// @brief Clears the requests of the given interrupts, as done when one is serviced.
+    /// @param interrupts Interrupt bits to clear
+    void InterruptController::acknowledge(const uint8_t interrupts) noexcept{
+        set_interrupt_flag(arena_->get_byte(interrupt_flag_) & ~interrupts);
+    }
+
+    /// @brief Returns the interrupt enable register.
+    /// @return IE.
+    uint8_t InterruptController::get_interrupt_enable() const noexcept{
+        return arena_->get_byte(interrupt_enable_);
+    }
+
+    /// @brief Returns the interrupt flag register.
+    /// @return IF.
+    uint8_t InterruptController::get_interrupt_flag() const noexcept{
+        return arena_->get_byte(interrupt_flag_);
+    }
+
+    /// @brief Sets the interrupt enable register.
+    /// @param value Byte, New value.
+    void InterruptController::set_interrupt_enable(const uint8_t value) noexcept{
+        arena_->set_byte(interrupt_enable_, value);
+        refresh();
+    }
+
+    /// @brief Sets the interrupt flag register.
+    /// @param value Byte, New value.
+    void InterruptController::set_interrupt_flag(const uint8_t value) noexcept{
+        arena_->set_byte(interrupt_flag_, value);
+        refresh();
+    }
+
+    /// @brief Recomputes the pending interrupts after IE or IF was written past the controller.
+    void InterruptController::refresh() noexcept{
+        pending_ = arena_->get_byte(interrupt_enable_) & arena_->get_byte(interrupt_flag_) & interrupt_mask;
+    }
+
+    /// @brief Returns the arena holding the registers.
+    /// @return Arena of the controller.
+    const std::shared_ptr<MemoryArena>& InterruptController::get_arena() const noexcept{
+        return arena_;
+    }
+
+    /// @brief Returns the index of the high page region.
+    /// @return Region of the registers.
+    std::size_t InterruptController::get_region() const noexcept{
+        return region_;
+    }
+
+}//namespace_mygbc
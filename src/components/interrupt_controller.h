@@ -0,0 +1,111 @@
+#ifndef INTERRUPT_CONTROLLER_H
+#define INTERRUPT_CONTROLLER_H
+
+#include <bit> //std::countr_zero
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "../memory/memory_arena.h" //MemoryArena
+
+namespace mygbc{
+
+    /// @brief Keeps the interrupt enable (IE) and interrupt flag (IF) registers and the interrupts pending from them.
+    /// @details IE and IF are plain bytes of the high page region of a MemoryArena, at 0xFFFF and 0xFF0F on the bus.
+    ///          Pending interrupts, IE & IF, are cached and updated only when either register is written, trough the
+    ///          controller or trough the HighPageMemory view calling refresh. Checking for interrupts is a single load.
+    class InterruptController{
+        public:
+
+            //Interrupt bits of IE and IF, in priority order
+            enum class Interrupt : uint8_t{
+                VBLANK = 0x01,
+                LCD_STAT = 0x02,
+                TIMER = 0x04,
+                SERIAL = 0x08,
+                JOYPAD = 0x10
+            };
+
+            //Bits of the five interrupts
+            static constexpr uint8_t interrupt_mask = 0x1F;
+
+            //Offsets of the registers in the high page
+            static constexpr std::size_t interrupt_flag_offset = 0x0F;
+            static constexpr std::size_t interrupt_enable_offset = 0xFF;
+
+            //Handler address of the vertical blank, the rest follow 8 bytes apart
+            static constexpr uint16_t vector_base = 0x0040;
+
+            /// @brief Binds the controller to the high page of the arena.
+            /// @param arena Arena holding the high page
+            /// @param region Index of the high page region in the layout
+            InterruptController(std::shared_ptr<MemoryArena> arena, const std::size_t region);
+
+            /// @brief Returns the interrupts both enabled and requested.
+            /// @return IE & IF of the five interrupts.
+            uint8_t get_pending() const noexcept{ return pending_; }
+
+            /// @brief Requests the interrupt by setting its bit in IF.
+            /// @param interrupt Interrupt to request
+            void request(const Interrupt interrupt) noexcept;
+
+            /// @brief Clears the requests of the given interrupts, as done when one is serviced.
+            /// @param interrupts Interrupt bits to clear
+            void acknowledge(const uint8_t interrupts) noexcept;
+
+            /// @brief Returns the interrupt enable register.
+            /// @return IE.
+            uint8_t get_interrupt_enable() const noexcept;
+
+            /// @brief Returns the interrupt flag register.
+            /// @return IF.
+            uint8_t get_interrupt_flag() const noexcept;
+
+            /// @brief Sets the interrupt enable register.
+            /// @param value Byte, New value.
+            void set_interrupt_enable(const uint8_t value) noexcept;
+
+            /// @brief Sets the interrupt flag register.
+            /// @param value Byte, New value.
+            void set_interrupt_flag(const uint8_t value) noexcept;
+
+            /// @brief Recomputes the pending interrupts after IE or IF was written past the controller.
+            void refresh() noexcept;
+
+            /// @brief Returns the arena holding the registers.
+            /// @return Arena of the controller.
+            const std::shared_ptr<MemoryArena>& get_arena() const noexcept;
+
+            /// @brief Returns the index of the high page region.
+            /// @return Region of the registers.
+            std::size_t get_region() const noexcept;
+
+            /// @brief Picks the interrupt serviced first.
+            /// @param pending Pending interrupt bits, not zero
+            /// @return Lowest pending bit.
+            static constexpr uint8_t get_highest_priority(const uint8_t pending) noexcept{
+                return static_cast<uint8_t>(pending & -pending);
+            }
+
+            /// @brief Returns the handler address of the interrupt.
+            /// @param interrupt Single interrupt bit
+            /// @return Address of the handler.
+            static constexpr uint16_t get_vector(const uint8_t interrupt) noexcept{
+                return static_cast<uint16_t>(vector_base + 8 * std::countr_zero(interrupt));
+            }
+
+        private:
+
+            //Arena holding the registers
+            std::shared_ptr<MemoryArena> arena_;
+            std::size_t region_;
+
+            //Arena offsets of the registers in the high page, the page may be copied on write
+            std::size_t interrupt_flag_;
+            std::size_t interrupt_enable_;
+
+            //IE & IF & interrupt_mask
+            uint8_t pending_;
+    };
+
+}//namespace_mygbc
+
+#endif
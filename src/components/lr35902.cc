@@ -1,27 +1,291 @@
 #include "lr35902.h" //LR35902
+#include <algorithm> //std::max
 #include "../instruction_set_lr35902/instruction_decoder_lr35902.h" //InstructionDecoderL35902
 
 namespace mygbc{
     /// @brief Initializes the CPU for execution
     /// @details Sets pc pointing at 0x00 (BOOT start)
-    LR35902::LR35902(){
+    LR35902::LR35902():predecode_cache_(std::make_shared<PredecodeCacheLR35902>()), execution_backend_(ExecutionBackend::INTERPRETER), attached_memory_controller_(nullptr){
         //Point the pc at the start of the boot rom
         register_file_.pc.set_word(0x00);
+        register_file_.set_lazy_flags_enabled(true);
     }
 
     /// @brief Emulates one fetch-decode-execute cycle returning the costs of that cycle.
+    /// @details Decodes into a stack record, the cycle does not allocate. Pc is advanced past the instruction before execution.
+    ///          Halted cpu idles for a machine cycle instead. After the HALT bug the opcode byte is read twice, pc is not advanced past it.
+    ///          Decoded instructions are cached by pc and contents tag, writes trough the memory controller invalidate them.
+    ///          IME scheduled by EI is set once the instruction after EI is done.
     /// @return Status or Cost of the fetch-decode-execute cycle.
     StatusOr<uint8_t> LR35902::fetch_decode_execute(MemoryController& memory_controller){
-        //Fetch and decode
-        StatusOr<InstructionLR35902> instruction_fetch = InstructionDecoderLR35902::decode(
-            memory_controller, register_file_.pc.get_word(), instruction_set_
+        if(register_file_.halted){
+            return machine_cycle_ticks;
+        }
+        attach_memory_controller(memory_controller);
+        const uint16_t pc = register_file_.pc.get_word();
+        const uint64_t bank_tag = memory_controller.get_contents_tag(pc);
+        //Fetch and decode, unless cached
+        DecodedInstructionLR35902 decoded_instruction;
+        const DecodedInstructionLR35902* cached_instruction = predecode_cache_->lookup(pc, bank_tag);
+        if(cached_instruction != nullptr){
+            decoded_instruction = *cached_instruction;
+        }
+        else{
+            Status decode_status = InstructionDecoderLR35902::decode_operation(memory_controller, pc, decoded_instruction);
+            if(!decode_status.ok()){
+                return decode_status;
+            }
+            predecode_cache_->store(pc, bank_tag, decoded_instruction);
+        }
+        //Point pc at the next instruction and execute, the HALT bug leaves it one byte short
+        uint8_t pc_increment = decoded_instruction.descriptor->size_in_bytes;
+        if(register_file_.halt_bug){
+            register_file_.halt_bug = false;
+            repeat_opcode_byte(decoded_instruction);
+            pc_increment = decoded_instruction.descriptor->size_in_bytes - 1;
+        }
+        register_file_.pc.increment(pc_increment);
+        const bool ime_was_scheduled = register_file_.ime_scheduled;
+        StatusOr<uint8_t> execution = instruction_executor_.execute_instruction(decoded_instruction, register_file_, memory_controller);
+        apply_scheduled_ime(ime_was_scheduled);
+        return execution;
+    }
+
+    /// @brief Executes the basic block starting at pc returning the summed costs of the block.
+    /// @details Block is translated on first use into pre-bound executors and reused while the memory under it is unchanged.
+    ///      Block stops before a instruction that could cross the budget, the first instruction always runs.
+    /// @param cycle_budget Ticks the dispatch may spend
+    /// @return Status or Cost of the block.
+    StatusOr<uint16_t> LR35902::execute_basic_block(MemoryController& memory_controller, const uint16_t cycle_budget){
+        attach_memory_controller(memory_controller);
+        StatusOr<const BasicBlockLR35902*> block_fetch = basic_block_cache_.get_block(
+            memory_controller, register_file_.pc.get_word(), *predecode_cache_
         );
-        if(instruction_fetch.ok()){
-            //Execute
-            InstructionLR35902 instruction = std::move(instruction_fetch).value();
-            return instruction_executor_.execute_instruction(instruction, register_file_, memory_controller);
+        if(!block_fetch.ok()){
+            return block_fetch.status();
+        }
+        return run_basic_block(*block_fetch.value(), memory_controller, cycle_budget);
+    }
+
+    /// @brief Executes the basic block starting at pc, as native code if compiled.
+    /// @details Hot blocks the JitCompilerLR35902 can handle are compiled, the rest run as basic blocks.
+    ///          Compiled self loops iterate while a whole iteration fits the budget, a compiled block that does not fit
+    ///          it runs as a basic block instead. Falls back to execute_basic_block on hosts without compiler support.
+    /// @param cycle_budget Ticks the dispatch may spend
+    /// @return Status or Cost of the block.
+    StatusOr<uint16_t> LR35902::execute_jit_block(MemoryController& memory_controller, const uint16_t cycle_budget){
+        if(!JitCompilerLR35902::is_supported()){
+            return execute_basic_block(memory_controller, cycle_budget);
+        }
+        attach_memory_controller(memory_controller);
+        const uint16_t pc = register_file_.pc.get_word();
+        JitCompilerLR35902::CompiledBlock compiled_block = jit_compiler_.lookup(pc, memory_controller.get_contents_tag(pc), *predecode_cache_);
+        if(compiled_block != nullptr){
+            const bool ime_was_scheduled = register_file_.ime_scheduled;
+            JitStateLR35902 jit_state{
+                pc, register_file_.get_flags(), register_file_.a_f.get_high(), cycle_budget,
+                register_file_.b_c.get_high(), register_file_.b_c.get_low(), register_file_.d_e.get_high(),
+                register_file_.d_e.get_low(), register_file_.h_l.get_high(), register_file_.h_l.get_low()
+            };
+            compiled_block(&jit_state);
+            const uint16_t execution_ticks = static_cast<uint16_t>(cycle_budget - jit_state.cycle_budget);
+            //Block returns untouched if it could overshoot the budget
+            if(execution_ticks != 0){
+                register_file_.pc.set_word(jit_state.pc);
+                register_file_.a_f.set_high(jit_state.a);
+                register_file_.set_flags(jit_state.f);
+                register_file_.b_c.set_word(static_cast<uint16_t>((jit_state.b << 8) | jit_state.c));
+                register_file_.d_e.set_word(static_cast<uint16_t>((jit_state.d << 8) | jit_state.e));
+                register_file_.h_l.set_word(static_cast<uint16_t>((jit_state.h << 8) | jit_state.l));
+                apply_scheduled_ime(ime_was_scheduled);
+                return execution_ticks;
+            }
+        }
+        StatusOr<const BasicBlockLR35902*> block_fetch = basic_block_cache_.get_block(memory_controller, pc, *predecode_cache_);
+        if(!block_fetch.ok()){
+            return block_fetch.status();
+        }
+        Status record_status = jit_compiler_.record_execution(*block_fetch.value());
+        if(!record_status.ok()){
+            return record_status;
+        }
+        return run_basic_block(*block_fetch.value(), memory_controller, cycle_budget);
+    }
+
+    /// @brief Executes one dispatch of the selected backend.
+    /// @details Single instruction with INTERPRETER, a basic block with BASIC_BLOCK and JIT. Halted cpu idles for a machine cycle.
+    ///          Instruction after the HALT bug is always interpreted. Blocks end before crossing the budget.
+    /// @param cycle_budget Ticks the dispatch may spend
+    /// @return Status or Cost of the dispatch.
+    StatusOr<uint16_t> LR35902::step(MemoryController& memory_controller, const uint16_t cycle_budget){
+        if(register_file_.halted){
+            return uint16_t{machine_cycle_ticks};
+        }
+        //Blocks assume every instruction is read once
+        if(!register_file_.halt_bug){
+            if(execution_backend_ == ExecutionBackend::BASIC_BLOCK){
+                return execute_basic_block(memory_controller, cycle_budget);
+            }
+            if(execution_backend_ == ExecutionBackend::JIT){
+                return execute_jit_block(memory_controller, cycle_budget);
+            }
+        }
+        StatusOr<uint8_t> cycle = fetch_decode_execute(memory_controller);
+        if(!cycle.ok()){
+            return cycle.status();
+        }
+        return static_cast<uint16_t>(cycle.value());
+    }
+
+    /// @brief Dispatches a interrupt to its handler.
+    /// @details Pushes pc like CALL, clears IME and wakes the cpu. Requester acknowledges the interrupt.
+    /// @param memory_controller Memory holding the stack
+    /// @param vector Address of the handler
+    /// @return Status or Cost of the dispatch.
+    StatusOr<uint8_t> LR35902::service_interrupt(MemoryController& memory_controller, const uint16_t vector){
+        //Push pc to stack
+        Status pc_push = memory_controller.set_word(register_file_.sp.get_word(), register_file_.pc.get_word());
+        if(!pc_push.ok()){
+            return pc_push;
+        }
+        register_file_.sp.increment(2);
+        register_file_.pc.set_word(vector);
+        register_file_.ime = false;
+        register_file_.ime_scheduled = false;
+        register_file_.halted = false;
+        return interrupt_service_ticks;
+    }
+
+    /// @brief Is the code starting at the given address a side-effect-free polling loop?
+    /// @details Analysis is cached like the basic blocks, see IdleLoopDetectorLR35902.
+    /// @param memory_controller Memory to decode from
+    /// @param address Address of the first instruction
+    /// @param last_address Set to the address of the last byte of the loop if idle
+    /// @return Idle loop?
+    bool LR35902::find_idle_loop(MemoryController& memory_controller, const uint16_t address, uint16_t& last_address){
+        attach_memory_controller(memory_controller);
+        return idle_loop_detector_.find_idle_loop(memory_controller, address, *predecode_cache_, last_address);
+    }
+
+    /// @brief Selects the backend used by step.
+    /// @param execution_backend Backend to use
+    void LR35902::set_execution_backend(const ExecutionBackend execution_backend) noexcept{
+        execution_backend_ = execution_backend;
+    }
+
+    /// @brief Returns the backend used by step.
+    /// @return Backend in use.
+    LR35902::ExecutionBackend LR35902::get_execution_backend() const noexcept{
+        return execution_backend_;
+    }
+
+    /// @brief Enables or disables the lazy flags mode of the register file.
+    /// @details ALU instructions record their operands and the flags are computed when read, see LR35902LazyFlags.
+    ///          Disabling materializes the pending flags. Enabled by default.
+    /// @param enabled Lazy flags mode on?
+    void LR35902::set_lazy_flags(const bool enabled) noexcept{
+        register_file_.set_lazy_flags_enabled(enabled);
+    }
+
+    /// @brief Is the lazy flags mode of the register file enabled?
+    /// @return Lazy flags mode on?
+    bool LR35902::is_lazy_flags() const noexcept{
+        return register_file_.lazy_flags_enabled;
+    }
+
+    /// @brief Returns the number of basic blocks translated for the BASIC_BLOCK and JIT backends.
+    /// @return Translated blocks.
+    std::size_t LR35902::get_translated_block_count() const noexcept{
+        return basic_block_cache_.get_block_count();
+    }
+
+    /// @brief Returns a copy of the registers of the cpu.
+    /// @details Call from the thread running the cpu or while it is stopped. Pending lazy flags are materialized in the copy.
+    /// @return Copy of the register file.
+    LR35902RegisterFile LR35902::get_register_snapshot() const noexcept{
+        LR35902RegisterFile snapshot = register_file_;
+        snapshot.materialize_flags();
+        return snapshot;
+    }
+
+    /// @brief Grants access to the registers of the cpu.
+    /// @return Register file.
+    LR35902RegisterFile& LR35902::get_register_file() noexcept{
+        return register_file_;
+    }
+
+    /// @brief Attaches the predecode cache to the memory controller as write observer.
+    /// @details Cache is emptied when the memory controller changes.
+    /// @param memory_controller Memory controller used for execution
+    void LR35902::attach_memory_controller(MemoryController& memory_controller) noexcept{
+        //Cache is emptied when the controller changes or someone else took the observer slot
+        if(attached_memory_controller_ != &memory_controller || memory_controller.get_write_observer() != predecode_cache_.get()){
+            predecode_cache_->invalidate_all();
+            memory_controller.set_write_observer(predecode_cache_);
+            attached_memory_controller_ = &memory_controller;
+        }
+    }
+
+    /// @brief Runs the pre-bound operations of the block.
+    /// @details Stops before a instruction whose worst case cost would cross the budget, the first instruction always runs.
+    /// @param block Current basic block
+    /// @param memory_controller Memory controller used for execution
+    /// @param cycle_budget Ticks the block may spend
+    /// @return Status or Cost of the block.
+    StatusOr<uint16_t> LR35902::run_basic_block(const BasicBlockLR35902& block, MemoryController& memory_controller, const uint16_t cycle_budget){
+        uint16_t execution_ticks = 0;
+        //Only the first instruction of a block can follow EI, EI ends the block
+        bool ime_was_scheduled = register_file_.ime_scheduled;
+        for(const ThreadedOperationLR35902& operation : block.operations){
+            //Rest of the block runs in a later dispatch, pc already points at it
+            const std::array<uint8_t, 2>& costs = operation.decoded_instruction.descriptor->t_cycles_costs;
+            if(execution_ticks != 0 && execution_ticks + std::max(costs[0], costs[1]) > cycle_budget){
+                break;
+            }
+            //Point pc at the next instruction and execute
+            register_file_.pc.increment(operation.decoded_instruction.descriptor->size_in_bytes);
+            StatusOr<uint8_t> operation_execution = operation.execute(operation.decoded_instruction, register_file_, memory_controller);
+            apply_scheduled_ime(ime_was_scheduled);
+            ime_was_scheduled = false;
+            if(!operation_execution.ok()){
+                return operation_execution.status();
+            }
+            execution_ticks += operation_execution.value();
+            //Block wrote over itself or remapped memory, rest of it is stale
+            if(!BasicBlockCacheLR35902::is_current(block, memory_controller.get_contents_tag(block.start_address), *predecode_cache_)){
+                break;
+            }
+        }
+        return execution_ticks;
+    }
+
+    /// @brief Sets IME if it was scheduled before the instruction just executed.
+    /// @details DI in between cancels the schedule.
+    /// @param ime_was_scheduled Was the instruction preceded by EI?
+    void LR35902::apply_scheduled_ime(const bool ime_was_scheduled) noexcept{
+        if(ime_was_scheduled && register_file_.ime_scheduled){
+            register_file_.ime = true;
+            register_file_.ime_scheduled = false;
+        }
+    }
+
+    /// @brief Rebuilds the decoded instruction as read after the HALT bug, the opcode byte read twice.
+    /// @param decoded_instruction Instruction decoded at pc, rebuilt in place
+    void LR35902::repeat_opcode_byte(DecodedInstructionLR35902& decoded_instruction) noexcept{
+        const uint16_t opcode = decoded_instruction.descriptor->opcode;
+        //Prefix read twice forms 0xCBCB, the byte after it is left for the next instruction
+        if(opcode > 0xFF){
+            decoded_instruction.descriptor = &InstructionSetLR35902::get_descriptor(0xCBCB);
+            decoded_instruction.read_value = 0;
+            return;
+        }
+        //Immidiate bytes shift by one, the opcode byte becomes the low byte
+        if(decoded_instruction.descriptor->read_value_size_in_bytes > 1){
+            decoded_instruction.read_value = static_cast<uint16_t>(((decoded_instruction.read_value & 0xFF) << 8) | opcode);
+        }
+        else if(decoded_instruction.descriptor->has_read_value()){
+            decoded_instruction.read_value = opcode;
         }
-        return instruction_fetch.status();
     }
 
 }
\ No newline at end of file
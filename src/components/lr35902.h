@@ -3,8 +3,13 @@
 
 #include "lr35902_register_file.h" //LR35902RegisterFile
 #include "memory_controller.h" //MemoryController
-#include "../instruction_set_lr35902/instruction_set_lr35902.h" //InstructionSetLR35902
+#include <cstddef> //std::size_t
+#include <memory> //std::shared_ptr
 #include "../instruction_set_lr35902/instruction_executor_lr35902.h" //InstructionExecutorLR35902
+#include "../instruction_set_lr35902/predecode_cache_lr35902.h" //PredecodeCacheLR35902
+#include "../instruction_set_lr35902/basic_block_cache_lr35902.h" //BasicBlockCacheLR35902
+#include "../instruction_set_lr35902/jit_compiler_lr35902.h" //JitCompilerLR35902
+#include "../instruction_set_lr35902/idle_loop_detector_lr35902.h" //IdleLoopDetectorLR35902
 
 namespace mygbc{
 
@@ -12,24 +17,153 @@ namespace mygbc{
     class LR35902{
 
         public:
+
+        //Backends executing the instructions
+        enum class ExecutionBackend : uint8_t{
+            INTERPRETER = 0, //One instruction per dispatch, reference implementation
+            BASIC_BLOCK = 1, //Pre-bound basic block per dispatch
+            JIT = 2 //Native code for hot compilable blocks, basic block otherwise
+        };
         
         /// @brief Initializes the CPU for execution
         /// @details Sets pc pointing at 0x00 (BOOT start)
         LR35902();
 
+        //Predecode cache is shared with the memory controller
+        LR35902(const LR35902&) = delete;
+        LR35902& operator=(const LR35902&) = delete;
+
+        //Ticks of a single machine cycle, a halted cpu idles in these
+        static constexpr uint8_t machine_cycle_ticks = 4;
+
+        //Ticks of dispatching a interrupt to its handler
+        static constexpr uint8_t interrupt_service_ticks = 20;
+
+        //Cycle budget of a dispatch the caller does not limit
+        static constexpr uint16_t unbounded_cycle_budget = UINT16_MAX;
+
         /// @brief Emulates one fetch-decode-execute cycle returning the costs of that cycle.
+        /// @details Decodes into a stack record, the cycle does not allocate. Pc is advanced past the instruction before execution.
+        ///          Halted cpu idles for a machine cycle instead. After the HALT bug the opcode byte is read twice, pc is not advanced past it.
+        ///          Decoded instructions are cached by pc and contents tag, writes trough the memory controller invalidate them.
+        ///          IME scheduled by EI is set once the instruction after EI is done.
         /// @return Status or Cost of the fetch-decode-execute cycle.
         StatusOr<uint8_t> fetch_decode_execute(MemoryController& memory_controller);
+
+        /// @brief Executes the basic block starting at pc returning the summed costs of the block.
+        /// @details Block is translated on first use into pre-bound executors and reused while the memory under it is unchanged.
+        ///          Block stops before a instruction that could cross the budget, the first instruction always runs.
+        /// @param cycle_budget Ticks the dispatch may spend
+        /// @return Status or Cost of the block.
+        StatusOr<uint16_t> execute_basic_block(MemoryController& memory_controller, const uint16_t cycle_budget = unbounded_cycle_budget);
+
+        /// @brief Executes the basic block starting at pc, as native code if compiled.
+        /// @details Hot blocks the JitCompilerLR35902 can handle are compiled, the rest run as basic blocks.
+        ///          Compiled self loops iterate while a whole iteration fits the budget, a compiled block that does not fit
+        ///          it runs as a basic block instead. Falls back to execute_basic_block on hosts without compiler support.
+        /// @param cycle_budget Ticks the dispatch may spend
+        /// @return Status or Cost of the block.
+        StatusOr<uint16_t> execute_jit_block(MemoryController& memory_controller, const uint16_t cycle_budget = unbounded_cycle_budget);
+
+        /// @brief Executes one dispatch of the selected backend.
+        /// @details Single instruction with INTERPRETER, a basic block with BASIC_BLOCK and JIT. Halted cpu idles for a machine cycle.
+        ///          Instruction after the HALT bug is always interpreted. Blocks end before crossing the budget.
+        /// @param cycle_budget Ticks the dispatch may spend
+        /// @return Status or Cost of the dispatch.
+        StatusOr<uint16_t> step(MemoryController& memory_controller, const uint16_t cycle_budget = unbounded_cycle_budget);
+
+        /// @brief Dispatches a interrupt to its handler.
+        /// @details Pushes pc like CALL, clears IME and wakes the cpu. Requester acknowledges the interrupt.
+        /// @param memory_controller Memory holding the stack
+        /// @param vector Address of the handler
+        /// @return Status or Cost of the dispatch.
+        StatusOr<uint8_t> service_interrupt(MemoryController& memory_controller, const uint16_t vector);
+
+        /// @brief Is the code starting at the given address a side-effect-free polling loop?
+        /// @details Analysis is cached like the basic blocks, see IdleLoopDetectorLR35902.
+        /// @param memory_controller Memory to decode from
+        /// @param address Address of the first instruction
+        /// @param last_address Set to the address of the last byte of the loop if idle
+        /// @return Idle loop?
+        bool find_idle_loop(MemoryController& memory_controller, const uint16_t address, uint16_t& last_address);
+
+        /// @brief Selects the backend used by step.
+        /// @param execution_backend Backend to use
+        void set_execution_backend(const ExecutionBackend execution_backend) noexcept;
+
+        /// @brief Returns the backend used by step.
+        /// @return Backend in use.
+        ExecutionBackend get_execution_backend() const noexcept;
+
+        /// @brief Enables or disables the lazy flags mode of the register file.
+        /// @details ALU instructions record their operands and the flags are computed when read, see LR35902LazyFlags.
+        ///          Disabling materializes the pending flags. Enabled by default.
+        /// @param enabled Lazy flags mode on?
+        void set_lazy_flags(const bool enabled) noexcept;
+
+        /// @brief Is the lazy flags mode of the register file enabled?
+        /// @return Lazy flags mode on?
+        bool is_lazy_flags() const noexcept;
+
+        /// @brief Returns the number of basic blocks translated for the BASIC_BLOCK and JIT backends.
+        /// @return Translated blocks.
+        std::size_t get_translated_block_count() const noexcept;
+
+        /// @brief Returns a copy of the registers of the cpu.
+        /// @details Call from the thread running the cpu or while it is stopped. Pending lazy flags are materialized in the copy.
+        /// @return Copy of the register file.
+        LR35902RegisterFile get_register_snapshot() const noexcept;
+
+        /// @brief Grants access to the registers of the cpu.
+        /// @return Register file.
+        LR35902RegisterFile& get_register_file() noexcept;
         
         private:
         //Registers of the cpu
         LR35902RegisterFile register_file_;
 
-        //Instructions available to the LR35902
-        InstructionSetLR35902 instruction_set_;
-
         //Executor of the LR35902 instructions
         InstructionExecutorLR35902 instruction_executor_;
+
+        //Decoded instructions by pc. Shared with the memory controller reporting writes to it
+        std::shared_ptr<PredecodeCacheLR35902> predecode_cache_;
+
+        //Translated basic blocks by start address
+        BasicBlockCacheLR35902 basic_block_cache_;
+
+        //Native code for hot blocks
+        JitCompilerLR35902 jit_compiler_;
+
+        //Idle loops by start address
+        IdleLoopDetectorLR35902 idle_loop_detector_;
+
+        //Backend used by step
+        ExecutionBackend execution_backend_;
+
+        //Memory controller last used for execution, only compared never accessed
+        const MemoryController* attached_memory_controller_;
+
+        /// @brief Attaches the predecode cache to the memory controller as write observer.
+        /// @details Cache is emptied when the memory controller changes.
+        /// @param memory_controller Memory controller used for execution
+        void attach_memory_controller(MemoryController& memory_controller) noexcept;
+
+        /// @brief Runs the pre-bound operations of the block.
+        /// @details Stops before a instruction whose worst case cost would cross the budget, the first instruction always runs.
+        /// @param block Current basic block
+        /// @param memory_controller Memory controller used for execution
+        /// @param cycle_budget Ticks the block may spend
+        /// @return Status or Cost of the block.
+        StatusOr<uint16_t> run_basic_block(const BasicBlockLR35902& block, MemoryController& memory_controller, const uint16_t cycle_budget);
+
+        /// @brief Sets IME if it was scheduled before the instruction just executed.
+        /// @details DI in between cancels the schedule.
+        /// @param ime_was_scheduled Was the instruction preceded by EI?
+        void apply_scheduled_ime(const bool ime_was_scheduled) noexcept;
+
+        /// @brief Rebuilds the decoded instruction as read after the HALT bug, the opcode byte read twice.
+        /// @param decoded_instruction Instruction decoded at pc, rebuilt in place
+        static void repeat_opcode_byte(DecodedInstructionLR35902& decoded_instruction) noexcept;
     };
 
 }//namespace_mygbc
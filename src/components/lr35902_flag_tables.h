@@ -0,0 +1,82 @@
+#ifndef LR35902_FLAG_TABLES_H
+#define LR35902_FLAG_TABLES_H
+
+#include <array> //std::array
+#include <cstddef> //std::size_t
+#include <cstdint> //Fixed lenght variables
+
+namespace mygbc{
+
+    /// @brief Compile time flag tables of the LR35902 ALU.
+    /// @details Tables are constexpr and placed in read only data. Flags not covered by a table come from branchless bit
+    ///          tricks on the operands and the result, half carry is bit 4 of operand_a ^ operand_b ^ result.
+    struct LR35902FlagTables{
+
+        //Flag bits of the F register
+        static constexpr uint8_t zero_flag_mask = 0x80;
+        static constexpr uint8_t sub_flag_mask = 0x40;
+        static constexpr uint8_t half_carry_flag_mask = 0x20;
+        static constexpr uint8_t carry_flag_mask = 0x10;
+
+        //Entries of the DAA table, every A for each combination of N, H and C
+        static constexpr std::size_t daa_table_size = 8 * 256;
+
+        /// @brief Translates A and F into the index of the DAA table.
+        /// @param a Accumulator before DAA
+        /// @param flags F before DAA
+        /// @return Index of the entry, N H C above A.
+        static constexpr std::size_t get_daa_index(const uint8_t a, const uint8_t flags) noexcept{
+            return (static_cast<std::size_t>(flags & (sub_flag_mask | half_carry_flag_mask | carry_flag_mask)) << 4) | a;
+        }
+
+        private:
+
+        /// @brief Builds the zero flag of every byte.
+        /// @return Byte => Z bit.
+        static constexpr std::array<uint8_t, 256> build_zero_flags() noexcept{
+            std::array<uint8_t, 256> zero_flags{};
+            zero_flags[0] = zero_flag_mask;
+            return zero_flags;
+        }
+
+        /// @brief Builds the result of DAA for every A, N, H and C.
+        /// @return Index => A after DAA in the high byte and F after DAA in the low byte.
+        static constexpr std::array<uint16_t, daa_table_size> build_daa_table() noexcept{
+            std::array<uint16_t, daa_table_size> daa_table{};
+            for(std::size_t index = 0; index < daa_table_size; ++index){
+                const uint8_t flags = static_cast<uint8_t>((index >> 4) & 0x70);
+                uint8_t a = static_cast<uint8_t>(index);
+                bool carry = flags & carry_flag_mask;
+                if(flags & sub_flag_mask){
+                    //Correct after subtraction, only by the carries of it
+                    a = static_cast<uint8_t>(a - ((flags & carry_flag_mask) ? 0x60 : 0x00) - ((flags & half_carry_flag_mask) ? 0x06 : 0x00));
+                }
+                else{
+                    const bool high_correction = carry || a > 0x99;
+                    const bool low_correction = (flags & half_carry_flag_mask) || (a & 0x0F) > 0x09;
+                    a = static_cast<uint8_t>(a + (high_correction ? 0x60 : 0x00) + (low_correction ? 0x06 : 0x00));
+                    carry = high_correction;
+                }
+                const uint8_t result_flags = static_cast<uint8_t>(
+                    (a == 0 ? zero_flag_mask : 0) | (flags & sub_flag_mask) | (carry ? carry_flag_mask : 0)
+                );
+                daa_table[index] = static_cast<uint16_t>((a << 8) | result_flags);
+            }
+            return daa_table;
+        }
+
+        public:
+
+        //Byte => Z bit of the F register, defined once the builders are complete
+        static const std::array<uint8_t, 256> zero_flags;
+
+        //A and N H C => A after DAA in the high byte, F after DAA in the low byte
+        static const std::array<uint16_t, daa_table_size> daa_table;
+    };
+
+    inline constexpr std::array<uint8_t, 256> LR35902FlagTables::zero_flags = LR35902FlagTables::build_zero_flags();
+    inline constexpr std::array<uint16_t, LR35902FlagTables::daa_table_size> LR35902FlagTables::daa_table = LR35902FlagTables::build_daa_table();
+
+}//namespace_mygbc
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef LR35902_LAZY_FLAGS_H
+#define LR35902_LAZY_FLAGS_H
+
+#include <cstdint> //Fixed lenght variables
+#include <type_traits> //std::is_trivially_copyable_v
+#include "lr35902_flag_tables.h" //LR35902FlagTables
+
+namespace mygbc{
+
+    /// @brief Record of the last flag producing ALU operation.
+    /// @details Holds the operands instead of the flags, flags are computed only when read. Computation is branchless per
+    ///          operation, Z comes from LR35902FlagTables and H and C from the carry bits of the operands and the result.
+    ///          Operations keeping some of the flags point at the record producing them instead of reading F up front.
+    struct LR35902LazyFlags{
+
+        //Flag producing operations
+        enum class Operation : uint8_t{
+            NONE = 0, //No pending flags, F register is current
+            ADD_8BIT = 1, //ADD A, x
+            ADC_8BIT = 2, //ADC A, x
+            SUB_8BIT = 3, //SUB A, x and CP A, x
+            SBC_8BIT = 4, //SBC A, x
+            AND_8BIT = 5, //AND A, x
+            OR_8BIT = 6, //OR A, x and XOR A, x
+            INC_8BIT = 7, //INC x, keeps C
+            DEC_8BIT = 8, //DEC x, keeps C
+            ADD_16BIT = 9, //ADD HL, rr, keeps Z
+            ADD_SP_8BIT = 10 //ADD SP, e8 and LD HL, SP + e8
+        };
+
+        //Flag bits of the F register
+        static constexpr uint8_t zero_flag_mask = LR35902FlagTables::zero_flag_mask;
+        static constexpr uint8_t sub_flag_mask = LR35902FlagTables::sub_flag_mask;
+        static constexpr uint8_t half_carry_flag_mask = LR35902FlagTables::half_carry_flag_mask;
+        static constexpr uint8_t carry_flag_mask = LR35902FlagTables::carry_flag_mask;
+
+        /// @brief Single recorded operation.
+        struct Record{
+            Operation operation; //Recorded operation, NONE for a plain F value
+            uint8_t carry_in; //Carry consumed by ADC/SBC
+            uint8_t flags; //F value of a NONE record
+            uint16_t operand_a; //Left operand, result for AND/OR
+            uint16_t operand_b; //Right operand
+
+            /// @brief Computes the F register produced by the recorded operation.
+            /// @param kept_flags F before the operation, only the flags the operation keeps are used
+            /// @return Value of the F register, lower nibble zero.
+            constexpr uint8_t compute_flags(const uint8_t kept_flags) const noexcept{
+                const uint8_t a = static_cast<uint8_t>(operand_a);
+                const uint8_t b = static_cast<uint8_t>(operand_b);
+                switch(operation){
+                    case Operation::ADD_8BIT:
+                    case Operation::ADC_8BIT:{
+                        //Carry out of bit 3 lands in bit 4 of the carry vector, out of bit 7 in bit 8 of the sum
+                        const uint16_t result = static_cast<uint16_t>(a + b + carry_in);
+                        return static_cast<uint8_t>(
+                            LR35902FlagTables::zero_flags[result & 0xFF] | (((a ^ b ^ result) & 0x10) << 1) | ((result >> 4) & carry_flag_mask)
+                        );
+                    }
+                    case Operation::SUB_8BIT:
+                    case Operation::SBC_8BIT:{
+                        //Borrow wraps the difference, setting bit 8
+                        const uint16_t result = static_cast<uint16_t>(a - b - carry_in);
+                        return static_cast<uint8_t>(
+                            LR35902FlagTables::zero_flags[result & 0xFF] | sub_flag_mask | (((a ^ b ^ result) & 0x10) << 1) | ((result >> 4) & carry_flag_mask)
+                        );
+                    }
+                    case Operation::AND_8BIT:
+                        return LR35902FlagTables::zero_flags[a] | half_carry_flag_mask;
+                    case Operation::OR_8BIT:
+                        return LR35902FlagTables::zero_flags[a];
+                    case Operation::INC_8BIT:{
+                        const uint8_t result = static_cast<uint8_t>(a + 1);
+                        return static_cast<uint8_t>(
+                            LR35902FlagTables::zero_flags[result] | (((a ^ result) & 0x10) << 1) | (kept_flags & carry_flag_mask)
+                        );
+                    }
+                    case Operation::DEC_8BIT:{
+                        const uint8_t result = static_cast<uint8_t>(a - 1);
+                        return static_cast<uint8_t>(
+                            LR35902FlagTables::zero_flags[result] | sub_flag_mask | (((a ^ result) & 0x10) << 1) | (kept_flags & carry_flag_mask)
+                        );
+                    }
+                    case Operation::ADD_16BIT:{
+                        //Half carry out of bit 11, carry out of bit 15
+                        const uint32_t result = static_cast<uint32_t>(operand_a) + operand_b;
+                        return static_cast<uint8_t>(
+                            (kept_flags & zero_flag_mask) | (((operand_a ^ operand_b ^ result) & 0x1000) >> 7) | ((result >> 12) & carry_flag_mask)
+                        );
+                    }
+                    case Operation::ADD_SP_8BIT:{
+                        //Flags of the unsigned addition of the low byte
+                        const uint16_t result = static_cast<uint16_t>((operand_a & 0xFF) + b);
+                        return static_cast<uint8_t>((((operand_a ^ b ^ result) & 0x10) << 1) | ((result >> 4) & carry_flag_mask));
+                    }
+                    default:
+                        return flags;
+                }
+            }
+        };
+
+        Record current; //Pending operation
+        Record kept_source; //Source of the flags the pending operation keeps, C of INC/DEC and Z of ADD HL
+
+        /// @brief Returns the flags the operation keeps from the F before it.
+        /// @param operation Flag producing operation
+        /// @return Mask of the kept flags.
+        static constexpr uint8_t get_kept_flags_mask(const Operation operation) noexcept{
+            switch(operation){
+                case Operation::INC_8BIT:
+                case Operation::DEC_8BIT:
+                    return carry_flag_mask;
+                case Operation::ADD_16BIT:
+                    return zero_flag_mask;
+                default:
+                    return 0;
+            }
+        }
+
+        /// @brief Is there a operation whose flags are not in the F register yet?
+        /// @return Flags pending?
+        constexpr bool is_pending() const noexcept{ return current.operation != Operation::NONE; }
+
+        /// @brief Records a operation, the F register holds the flags before it.
+        /// @details Nothing is computed. Kept flags come from the F register, the pending operation or the source
+        ///          the pending operation keeps the same flags from, so resolving them never chains further.
+        /// @param operation_record Operation to record
+        /// @param flags Value of the F register
+        constexpr void record(const Record& operation_record, const uint8_t flags) noexcept{
+            const uint8_t kept_flags_mask = get_kept_flags_mask(operation_record.operation);
+            if(kept_flags_mask != 0){
+                if(!is_pending()){
+                    kept_source = Record{Operation::NONE, 0, flags, 0, 0};
+                }
+                else if((get_kept_flags_mask(current.operation) & kept_flags_mask) == 0){
+                    kept_source = current;
+                }
+            }
+            current = operation_record;
+        }
+
+        /// @brief Computes the F register produced by the pending operation.
+        /// @return Value of the F register, lower nibble zero.
+        constexpr uint8_t compute_flags() const noexcept{
+            //Kept source produces the kept flags itself, it needs no kept flags of its own
+            return current.compute_flags((get_kept_flags_mask(current.operation) != 0) ? kept_source.compute_flags(0) : uint8_t{0});
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<LR35902LazyFlags>);
+
+}//namespace_mygbc
+
+#endif
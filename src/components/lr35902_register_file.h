@@ -1,83 +1,254 @@
 #ifndef LR35902_REGISTER_FILE_H
 #define LR35902_REGISTER_FILE_H
 
-#include <unordered_map> //std::unordered_map
-#include <atomic> //std::atomic
-#include <string> //std::string
-#include "../memory/memory_mapped_register_8bit.h" //MemoryMappedRegister8Bit
-#include "../memory/register_16bit.h" //Register16Bit
+#include <cstdint> //Fixed lenght variables
+#include <array> //std::array
+#include <type_traits> //std::is_trivially_copyable_v
+#include "lr35902_lazy_flags.h" //LR35902LazyFlags
+#include "lr35902_register_id.h" //LR35902RegisterId
+#include "../util/status/status_or.h" //StatusOr
 
 namespace mygbc{
-    struct LR35902RegisterFile{
-        std::atomic<bool> ime; //Interupt master enable
-        MemoryMappedRegister8Bit ie; //Interupt enable register
-        MemoryMappedRegister8Bit ir; //Interupt flag register (IF), avoiding c++ collision with ir.
-        Register16Bit a_f; //Accumilator and flag register
-        Register16Bit b_c;
-        Register16Bit d_e;
-        Register16Bit h_l;
-        Register16Bit pc; //Program counter
-        Register16Bit sp; //Stack pointer
-
-        //Flag registry index
-        const uint8_t lower_eight_index;
-
-        /// id lookup table
-        const std::unordered_map<std::string, Register16Bit*> register_lookup_table;
-
-        /// @brief Initializes the register_file and lookup tables.
-        LR35902RegisterFile();
 
-        /// @brief Returns the lookup table for id to register lookup.
-        /// @return Id to register lookup table.
-        const std::unordered_map<std::string, Register16Bit*> get_lookup_table();
+    /// @brief 16-bit register pair with 8-bit views of its halves.
+    /// @details Plain value, no locking or allocation. High half is the first named register (A of AF, B of BC...).
+    struct RegisterPair{
+        uint16_t word;
+
+        /// @brief Returns the contents of the pair as a word.
+        /// @return Word value.
+        constexpr uint16_t get_word() const noexcept{ return word; }
+
+        /// @brief Sets the contents of the pair.
+        /// @param value Word, New value.
+        constexpr void set_word(const uint16_t value) noexcept{ word = value; }
+
+        /// @brief Increments the pair by the given value, wraps around.
+        /// @param value Value to increment with
+        constexpr void increment(const uint16_t value) noexcept{ word = static_cast<uint16_t>(word + value); }
+
+        /// @brief Decrements the pair by the given value, wraps around.
+        /// @param value Value to decrement with
+        constexpr void decrement(const uint16_t value) noexcept{ word = static_cast<uint16_t>(word - value); }
+
+        /// @brief Returns the high half of the pair.
+        /// @return High byte (A, B, D, H, S, P).
+        constexpr uint8_t get_high() const noexcept{ return static_cast<uint8_t>(word >> 8); }
+
+        /// @brief Returns the low half of the pair.
+        /// @return Low byte (F, C, E, L, P, C).
+        constexpr uint8_t get_low() const noexcept{ return static_cast<uint8_t>(word); }
+
+        /// @brief Sets the high half of the pair.
+        /// @param value Byte, New value.
+        constexpr void set_high(const uint8_t value) noexcept{ word = static_cast<uint16_t>((word & 0x00FF) | (value << 8)); }
+
+        /// @brief Sets the low half of the pair.
+        /// @param value Byte, New value.
+        constexpr void set_low(const uint8_t value) noexcept{ word = static_cast<uint16_t>((word & 0xFF00) | value); }
+    };
+
+    /// @brief Registers of the LR35902.
+    /// @details Plain struct fitting a single cache line, accessed with plain loads and stores.
+    ///          Owned by the thread running the cpu, observers take a copy trough LR35902::get_register_snapshot.
+    ///          In lazy flags mode ALU operations only record their operands, the F register is brought up to date
+    ///          when a flag is read trough the accessors, get_flags or get_af, or by materialize_flags.
+    struct alignas(64) LR35902RegisterFile{
+        RegisterPair a_f; //Accumilator and flag register
+        RegisterPair b_c;
+        RegisterPair d_e;
+        RegisterPair h_l;
+        RegisterPair pc; //Program counter
+        RegisterPair sp; //Stack pointer
+        bool ime; //Interupt master enable
+        bool ime_scheduled; //EI executed, IME is set after the next instruction
+        bool halted; //Waiting for a interrupt after HALT or STOP
+        bool halt_bug; //HALT skipped with a interrupt pending and IME clear, the next opcode byte is read twice
+        LR35902LazyFlags lazy_flags; //Last ALU operation whose flags are not in F yet
+        bool lazy_flags_enabled; //Record ALU operations instead of computing the flags
+
+        //Flag bits of the F register
+        static constexpr uint8_t zero_flag_mask = LR35902LazyFlags::zero_flag_mask;
+        static constexpr uint8_t sub_flag_mask = LR35902LazyFlags::sub_flag_mask;
+        static constexpr uint8_t half_carry_flag_mask = LR35902LazyFlags::half_carry_flag_mask;
+        static constexpr uint8_t carry_flag_mask = LR35902LazyFlags::carry_flag_mask;
+
+        /// @brief Initializes the register_file, every register zeroed.
+        LR35902RegisterFile();
 
         /// @brief Helper to get the zero flag from F register
         /// @details Queries the 7th bit of the F registry.
-        /// @return State of the zero flag or status.
-        StatusOr<bool> get_zero_flag() noexcept;
+        /// @return State of the zero flag.
+        constexpr bool get_zero_flag() const noexcept{ return get_flags() & zero_flag_mask; }
 
         /// @brief Helper to get the carry flag from F register
         /// @details Queries the 4th bit of the F registry.
-        /// @return State of the carry flag or status.
-        StatusOr<bool> get_carry_flag() noexcept;
+        /// @return State of the carry flag.
+        constexpr bool get_carry_flag() const noexcept{ return get_flags() & carry_flag_mask; }
 
         /// @brief Helper to get the subtraction flag from F register
         /// @details Queries the 6th bit of the F registry.
-        /// @return State of the subtraction flag or status.
-        StatusOr<bool> get_sub_flag() noexcept;
+        /// @return State of the subtraction flag.
+        constexpr bool get_sub_flag() const noexcept{ return get_flags() & sub_flag_mask; }
 
         /// @brief Helper to get the half carry flag from F register
         /// @details Queries the 5th bit of the F registry.
-        /// @return State of the half carry flag or status.
-        StatusOr<bool> get_half_carry_flag() noexcept;
+        /// @return State of the half carry flag.
+        constexpr bool get_half_carry_flag() const noexcept{ return get_flags() & half_carry_flag_mask; }
 
         /// @brief Helper to set the zero flag from F register
         /// @details Sets the 7th bit of the F registry.
         /// @param new_flag New value of the flag.
-        Status set_zero_flag(const bool new_flag) noexcept;
+        constexpr void set_zero_flag(const bool new_flag) noexcept{ set_flag(zero_flag_mask, new_flag); }
 
         /// @brief Helper to set the carry flag from F register
         /// @details Sets the 4th bit of the F registry.
         /// @param new_flag New value of the flag.
-        Status set_carry_flag(const bool new_flag) noexcept;
+        constexpr void set_carry_flag(const bool new_flag) noexcept{ set_flag(carry_flag_mask, new_flag); }
 
         /// @brief Helper to set the subtraction flag from F register
         /// @details Sets the 6th bit of the F registry.
         /// @param new_flag New value of the flag.
-        Status set_sub_flag(const bool new_flag) noexcept;
+        constexpr void set_sub_flag(const bool new_flag) noexcept{ set_flag(sub_flag_mask, new_flag); }
 
         /// @brief Helper to set the half carry flag from F register
         /// @details Sets the 5th bit of the F registry.
         /// @param new_flag New value of the flag.
-        Status set_half_carry_flag(const bool new_flag) noexcept;
-
-        /// @brief Helper to get register by letter id
-        /// @details Returns reference to the register.
-        /// @return Reference to the register or Status.
-        StatusOr<Register16Bit*> get_register_by_id(const std::string& id) noexcept;
+        constexpr void set_half_carry_flag(const bool new_flag) noexcept{ set_flag(half_carry_flag_mask, new_flag); }
+
+        /// @brief Returns the F register, including the flags of a pending ALU operation.
+        /// @return Value of the F register.
+        constexpr uint8_t get_flags() const noexcept{
+            return lazy_flags.is_pending() ? lazy_flags.compute_flags() : a_f.get_low();
+        }
+
+        /// @brief Sets the F register, discarding the pending ALU operation.
+        /// @param value Byte, New value.
+        constexpr void set_flags(const uint8_t value) noexcept{
+            lazy_flags.current.operation = LR35902LazyFlags::Operation::NONE;
+            a_f.set_low(value);
+        }
+
+        /// @brief Returns the AF pair with the flags up to date, as pushed by PUSH AF.
+        /// @return Word value of AF.
+        constexpr uint16_t get_af() const noexcept{
+            return static_cast<uint16_t>((a_f.get_high() << 8) | get_flags());
+        }
+
+        /// @brief Records the flags of a ALU operation.
+        /// @details In lazy flags mode only the operands are stored, otherwise the flags are computed right away.
+        ///          Flags kept by INC, DEC and ADD HL are resolved when read, not when recorded.
+        /// @param operation Flag producing operation
+        /// @param operand_a Left operand, the result for AND, OR and XOR
+        /// @param operand_b Right operand
+        /// @param carry_in Carry consumed by ADC and SBC
+        constexpr void record_flags(const LR35902LazyFlags::Operation operation, const uint16_t operand_a, const uint16_t operand_b, const uint8_t carry_in = 0) noexcept{
+            lazy_flags.record(LR35902LazyFlags::Record{operation, carry_in, 0, operand_a, operand_b}, a_f.get_low());
+            if(!lazy_flags_enabled){
+                materialize_flags();
+            }
+        }
+
+        /// @brief Writes the flags of the pending ALU operation into the F register.
+        constexpr void materialize_flags() noexcept{
+            if(lazy_flags.is_pending()){
+                set_flags(lazy_flags.compute_flags());
+            }
+        }
+
+        /// @brief Enables or disables the lazy flags mode.
+        /// @details Disabling materializes the pending flags.
+        /// @param enabled Lazy flags mode on?
+        constexpr void set_lazy_flags_enabled(const bool enabled) noexcept{
+            materialize_flags();
+            lazy_flags_enabled = enabled;
+        }
+
+        /// @brief Helper to get register by id
+        /// @details Returns pointer to the register pair holding the register. Pending lazy flags are materialized first for the AF pair (A, F, AF), it exposes F directly.
+        /// @param reg_id Id of the register
+        /// @return Pointer to the register pair or Status.
+        StatusOr<RegisterPair*> get_register_by_id(const LR35902RegisterId reg_id) noexcept;
+
+        /// @brief Reads a register by id.
+        /// @details 8-bit ids read their half of the pair, F and AF include the pending lazy flags.
+        /// @param reg_id Id of the register, not NONE
+        /// @return Value of the register.
+        constexpr uint16_t get_register_value(const LR35902RegisterId reg_id) const noexcept;
+
+        /// @brief Writes a register by id.
+        /// @details 8-bit ids write their half of the pair, F and AF discard the pending lazy flags.
+        /// @param reg_id Id of the register, not NONE
+        /// @param value New value, truncated to 8 bits for 8-bit ids
+        constexpr void set_register_value(const LR35902RegisterId reg_id, const uint16_t value) noexcept;
+
+        private:
+
+        /// @brief Sets or clears the flag bits of the F register.
+        /// @param flag_mask Bits of the flag
+        /// @param new_flag New value of the flag.
+        constexpr void set_flag(const uint8_t flag_mask, const bool new_flag) noexcept{
+            materialize_flags();
+            a_f.set_low(new_flag ? (a_f.get_low() | flag_mask) : (a_f.get_low() & ~flag_mask));
+        }
+    };
 
+    //Copied freely for snapshots
+    static_assert(std::is_trivially_copyable_v<LR35902RegisterFile>);
+    static_assert(sizeof(LR35902RegisterFile) == 64);
+
+    //Register id => pair holding the register, nullptr for NONE. Indexed by the id value
+    inline constexpr std::array<RegisterPair LR35902RegisterFile::*, lr35902_register_id_count> lr35902_register_pairs{
+        nullptr,
+        &LR35902RegisterFile::a_f, &LR35902RegisterFile::a_f, //A, F
+        &LR35902RegisterFile::b_c, &LR35902RegisterFile::b_c, //B, C
+        &LR35902RegisterFile::d_e, &LR35902RegisterFile::d_e, //D, E
+        &LR35902RegisterFile::h_l, &LR35902RegisterFile::h_l, //H, L
+        &LR35902RegisterFile::a_f, &LR35902RegisterFile::b_c, &LR35902RegisterFile::d_e, &LR35902RegisterFile::h_l, //AF, BC, DE, HL
+        &LR35902RegisterFile::sp, &LR35902RegisterFile::pc //SP, PC
     };
+
+    /// @brief Reads a register by id.
+    /// @details 8-bit ids read their half of the pair, F and AF include the pending lazy flags.
+    /// @param reg_id Id of the register, not NONE
+    /// @return Value of the register.
+    constexpr uint16_t LR35902RegisterFile::get_register_value(const LR35902RegisterId reg_id) const noexcept{
+        if(reg_id == LR35902RegisterId::F){
+            return get_flags();
+        }
+        if(reg_id == LR35902RegisterId::AF){
+            return get_af();
+        }
+        const RegisterPair& pair = this->*lr35902_register_pairs[static_cast<uint8_t>(reg_id)];
+        switch(get_register_width(reg_id)){
+            case LR35902RegisterWidth::HIGH: return pair.get_high();
+            case LR35902RegisterWidth::LOW: return pair.get_low();
+            default: return pair.get_word();
+        }
+    }
+
+    /// @brief Writes a register by id.
+    /// @details 8-bit ids write their half of the pair, F and AF discard the pending lazy flags.
+    /// @param reg_id Id of the register, not NONE
+    /// @param value New value, truncated to 8 bits for 8-bit ids
+    constexpr void LR35902RegisterFile::set_register_value(const LR35902RegisterId reg_id, const uint16_t value) noexcept{
+        if(reg_id == LR35902RegisterId::F){
+            set_flags(static_cast<uint8_t>(value));
+            return;
+        }
+        if(reg_id == LR35902RegisterId::AF){
+            a_f.set_high(static_cast<uint8_t>(value >> 8));
+            set_flags(static_cast<uint8_t>(value));
+            return;
+        }
+        RegisterPair& pair = this->*lr35902_register_pairs[static_cast<uint8_t>(reg_id)];
+        switch(get_register_width(reg_id)){
+            case LR35902RegisterWidth::HIGH: pair.set_high(static_cast<uint8_t>(value)); break;
+            case LR35902RegisterWidth::LOW: pair.set_low(static_cast<uint8_t>(value)); break;
+            default: pair.set_word(value); break;
+        }
+    }
+
 }
 
-#endif
\ No newline at end of file
+#endif
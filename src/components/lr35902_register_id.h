@@ -0,0 +1,66 @@
+#ifndef LR35902_REGISTER_ID_H
+#define LR35902_REGISTER_ID_H
+
+#include <cstdint> //Fixed lenght variables
+#include <cstddef> //std::size_t
+#include <array> //std::array
+#include <string_view> //std::string_view
+
+namespace mygbc{
+
+    //Registers of the LR35902, used as instruction operands
+    enum class LR35902RegisterId : uint8_t{
+        NONE = 0,
+        A = 1,
+        F = 2,
+        B = 3,
+        C = 4,
+        D = 5,
+        E = 6,
+        H = 7,
+        L = 8,
+        AF = 9,
+        BC = 10,
+        DE = 11,
+        HL = 12,
+        SP = 13,
+        PC = 14
+    };
+
+    //Part of the register pair a register id refers to
+    enum class LR35902RegisterWidth : uint8_t{
+        NONE = 0, //No register
+        HIGH = 1, //8-bit high half (A, B, D, H)
+        LOW = 2, //8-bit low half (F, C, E, L)
+        WORD = 3 //16-bit pair
+    };
+
+    //Number of register ids, NONE included
+    inline constexpr std::size_t lr35902_register_id_count = 15;
+
+    //Register id => width. Indexed by the id value
+    inline constexpr std::array<LR35902RegisterWidth, lr35902_register_id_count> lr35902_register_widths{
+        LR35902RegisterWidth::NONE,
+        LR35902RegisterWidth::HIGH, LR35902RegisterWidth::LOW, //A, F
+        LR35902RegisterWidth::HIGH, LR35902RegisterWidth::LOW, //B, C
+        LR35902RegisterWidth::HIGH, LR35902RegisterWidth::LOW, //D, E
+        LR35902RegisterWidth::HIGH, LR35902RegisterWidth::LOW, //H, L
+        LR35902RegisterWidth::WORD, LR35902RegisterWidth::WORD, LR35902RegisterWidth::WORD, LR35902RegisterWidth::WORD, //AF, BC, DE, HL
+        LR35902RegisterWidth::WORD, LR35902RegisterWidth::WORD //SP, PC
+    };
+
+    //Register id => assembly name. Indexed by the id value
+    inline constexpr std::array<std::string_view, lr35902_register_id_count> lr35902_register_names{
+        "", "A", "F", "B", "C", "D", "E", "H", "L", "AF", "BC", "DE", "HL", "SP", "PC"
+    };
+
+    /// @brief Returns the width of the register.
+    /// @param reg_id Id of the register
+    /// @return Width of the register, NONE for NONE.
+    constexpr LR35902RegisterWidth get_register_width(const LR35902RegisterId reg_id) noexcept{
+        return lr35902_register_widths[static_cast<uint8_t>(reg_id)];
+    }
+
+}//namespace_mygbc
+
+#endif
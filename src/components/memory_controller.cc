@@ -1,9 +1,18 @@
 #include "memory_controller.h"
+#include "../util/util.h" //Util
+#include "../memory/dirty_page_tracker.h" //DirtyPageTracker
+#include <algorithm> //std::min, std::sort
+#include <functional> //std::less
+#include <utility> //std::pair
+#include <cstring> //std::memcpy
 
 namespace mygbc{
 
+    //Direct writes mark the single dirty page behind the page table page
+    static_assert(MemoryController::page_size == DirtyPageTracker::page_size);
+
     /// @brief Default constructor
-    MemoryController::MemoryController():memory_banks_mutex_(std::make_shared<std::shared_mutex>()){
+    MemoryController::MemoryController():page_table_{}, memory_banks_mutex_(std::make_shared<std::shared_mutex>()), mapping_generation_(0){
     }
 
     /// @brief Returns the byte located at the given address.
@@ -11,7 +20,11 @@ namespace mygbc{
     /// @param addr Zero based address.
     /// @return byte value located at the given address or error Status.
     StatusOr<uint8_t> MemoryController::get_byte(const uint16_t addr) noexcept{
-        StatusOr<MemoryBank*> memory_bank_fetch = get_addr_memory_bank(addr);
+        const Page& page = get_current_page(addr);
+        if(page.read != nullptr){
+            return page.read[addr & 0xFF];
+        }
+        StatusOr<MemoryBank*> memory_bank_fetch = get_page_memory_bank(addr);
         if(memory_bank_fetch.ok()){
             const uint16_t translated_addr = memory_bank_fetch.value()->translate_address(addr);
             return memory_bank_fetch.value()->memory_bank_->get_byte(translated_addr);
@@ -24,21 +37,35 @@ namespace mygbc{
     /// @param addr Zero based address.
     /// @return Word value located at the given address or error Status.
     StatusOr<uint16_t> MemoryController::get_word(const uint16_t addr) noexcept{
-        StatusOr<MemoryBank*> memory_bank_fetch = get_addr_memory_bank(addr);
-        if(memory_bank_fetch.ok()){
-            const uint16_t translated_addr = memory_bank_fetch.value()->translate_address(addr);
-            return memory_bank_fetch.value()->memory_bank_->get_word(translated_addr);
+        const Page& page = get_current_page(addr);
+        if((addr & 0xFF) != 0xFF){
+            //Both bytes on the page, stored low byte first
+            if(page.read != nullptr){
+                return Util::load_little_endian_word(page.read + (addr & 0xFF));
+            }
+            if(page.bank != nullptr){
+                return page.bank->memory_bank_->get_word(page.bank->translate_address(addr));
+            }
         }
-        return memory_bank_fetch.status();
+        //Word crosses a page and possibly a memory boundary, read the bytes separately
+        StatusOr<uint8_t> low_byte = get_byte(addr);
+        if(!low_byte.ok()){
+            return low_byte.status();
+        }
+        StatusOr<uint8_t> high_byte = get_byte(static_cast<uint16_t>(addr + 1));
+        if(!high_byte.ok()){
+            return high_byte.status();
+        }
+        return static_cast<uint16_t>((high_byte.value() << 8) | low_byte.value());
     }
 
     /// @brief Returns the current size of the memory in bytes
     /// @return Size of the memory in bytes.
     std::size_t MemoryController::get_memory_size(){
         std::shared_lock<std::shared_mutex> read_lock(*memory_banks_mutex_);
-        uint16_t size = 0;
+        std::size_t size = 0;
         for(auto& memory_bank : memory_banks_){
-            size += (memory_bank.second.range_end - memory_bank.second.range_start);
+            size += (memory_bank.second.range_end - memory_bank.second.range_start) + 1;
         }
         return size;
     }
@@ -49,10 +76,24 @@ namespace mygbc{
     /// @param value Byte, New value.
     /// @return Returns status of the set
     Status MemoryController::set_byte(const uint16_t addr, const uint8_t value) noexcept{
-        StatusOr<MemoryBank*> memory_bank_fetch = get_addr_memory_bank(addr);
+        const Page& page = get_current_page(addr);
+        if(page.write != nullptr){
+            page.write[addr & 0xFF] = value;
+            if(page.dirty != nullptr){
+                *page.dirty = 1;
+            }
+            notify_write(addr, 1);
+            return Status::ok_status();
+        }
+        StatusOr<MemoryBank*> memory_bank_fetch = get_page_memory_bank(addr);
         if(memory_bank_fetch.ok()){
             const uint16_t translated_addr = memory_bank_fetch.value()->translate_address(addr);
-            return memory_bank_fetch.value()->memory_bank_->set_byte(translated_addr, value);
+            Status write_status = memory_bank_fetch.value()->memory_bank_->set_byte(translated_addr, value);
+            if(write_status.ok()){
+                refresh_direct_pointers(*memory_bank_fetch.value());
+                notify_write(addr, 1);
+            }
+            return write_status;
         }
         return memory_bank_fetch.status();
     }
@@ -63,12 +104,105 @@ namespace mygbc{
     /// @param value Word, New value.
     /// @return Returns status of the set
     Status MemoryController::set_word(const uint16_t addr, const uint16_t value) noexcept{
-        StatusOr<MemoryBank*> memory_bank_fetch = get_addr_memory_bank(addr);
-        if(memory_bank_fetch.ok()){
-            const uint16_t translated_addr = memory_bank_fetch.value()->translate_address(addr);
-            return memory_bank_fetch.value()->memory_bank_->set_word(translated_addr, value);
+        const Page& page = get_current_page(addr);
+        if((addr & 0xFF) != 0xFF){
+            //Both bytes on the page, stored low byte first
+            if(page.write != nullptr){
+                Util::store_little_endian_word(page.write + (addr & 0xFF), value);
+                if(page.dirty != nullptr){
+                    *page.dirty = 1;
+                }
+                notify_write(addr, 2);
+                return Status::ok_status();
+            }
+            if(page.bank != nullptr){
+                MemoryBank& bank = *page.bank;
+                Status write_status = bank.memory_bank_->set_word(bank.translate_address(addr), value);
+                if(write_status.ok()){
+                    refresh_direct_pointers(bank);
+                    notify_write(addr, 2);
+                }
+                return write_status;
+            }
         }
-        return memory_bank_fetch.status();
+        //Word crosses a page and possibly a memory boundary, write the bytes separately
+        Status low_write = set_byte(addr, static_cast<uint8_t>(value));
+        if(!low_write.ok()){
+            return low_write;
+        }
+        return set_byte(static_cast<uint16_t>(addr + 1), static_cast<uint8_t>(value >> 8));
+    }
+
+    /// @brief Reads the block of memory starting at the given address.
+    /// @details Pages with direct pointers are copied with memcpy, the rest is read byte by byte trough the memory.
+    ///          Block may span several mounted memories but must not wrap past 0xFFFF.
+    /// @param addr Zero based address of the first byte.
+    /// @param destination Buffer to read into, its size is the size of the block.
+    /// @return Returns status of the read
+    Status MemoryController::read_block(const uint16_t addr, std::span<uint8_t> destination) noexcept{
+        if(addr + destination.size() > page_count * page_size){
+            return Status::invalid_index_error(
+                "Block read wraps past the end of the bus! (Addr: " + std::to_string(addr) + " / Size: " + std::to_string(destination.size()) + ")"
+            );
+        }
+        std::size_t offset = 0;
+        while(offset < destination.size()){
+            const std::size_t block_addr = addr + offset;
+            const std::size_t chunk_size = std::min(destination.size() - offset, page_size - (block_addr & 0xFF));
+            const Page& page = get_current_page(static_cast<uint16_t>(block_addr));
+            if(page.read != nullptr){
+                std::memcpy(destination.data() + offset, page.read + (block_addr & 0xFF), chunk_size);
+            }
+            else{
+                for(std::size_t i = 0; i < chunk_size; ++i){
+                    StatusOr<uint8_t> byte_read = get_byte(static_cast<uint16_t>(block_addr + i));
+                    if(!byte_read.ok()){
+                        return byte_read.status();
+                    }
+                    destination[offset + i] = byte_read.value();
+                }
+            }
+            offset += chunk_size;
+        }
+        return Status::ok_status();
+    }
+
+    /// @brief Writes the block of memory starting at the given address.
+    /// @details Pages with direct pointers are copied with memcpy and reported to the observer once per page, the rest
+    ///          is written byte by byte trough set_byte. Stops at the first failing byte, the bytes before it stay written.
+    /// @param addr Zero based address of the first byte.
+    /// @param source Bytes to write, its size is the size of the block.
+    /// @return Returns status of the write
+    Status MemoryController::write_block(const uint16_t addr, std::span<const uint8_t> source) noexcept{
+        if(addr + source.size() > page_count * page_size){
+            return Status::invalid_index_error(
+                "Block write wraps past the end of the bus! (Addr: " + std::to_string(addr) + " / Size: " + std::to_string(source.size()) + ")"
+            );
+        }
+        std::size_t offset = 0;
+        while(offset < source.size()){
+            const std::size_t block_addr = addr + offset;
+            const std::size_t chunk_size = std::min(source.size() - offset, page_size - (block_addr & 0xFF));
+            //Page is looked up per chunk, byte writes may have switched banks
+            const Page& page = get_current_page(static_cast<uint16_t>(block_addr));
+            if(page.write != nullptr){
+                std::memcpy(page.write + (block_addr & 0xFF), source.data() + offset, chunk_size);
+                if(page.dirty != nullptr){
+                    *page.dirty = 1;
+                }
+                notify_write(static_cast<uint16_t>(block_addr), static_cast<uint16_t>(chunk_size));
+            }
+            else{
+                for(std::size_t i = 0; i < chunk_size; ++i){
+                    Status write_status = set_byte(static_cast<uint16_t>(block_addr + i), source[offset + i]);
+                    if(!write_status.ok()){
+                        return write_status;
+                    }
+                }
+            }
+            offset += chunk_size;
+        }
+        return Status::ok_status();
     }
 
     /// @brief Frees the memory assosiated with the memory object.
@@ -76,6 +210,8 @@ namespace mygbc{
     void MemoryController::free(){
         std::unique_lock<std::shared_mutex> write_lock(*memory_banks_mutex_);
         memory_banks_.clear();
+        page_table_.fill(Page{});
+        ++mapping_generation_;
     }
 
     /// @brief Tries to mount memory starting at given address.
@@ -84,16 +220,26 @@ namespace mygbc{
     /// @return Status of the mount try
     Status MemoryController::mount_memory(uint16_t memory_start_addr, std::shared_ptr<SystemMemoryInterface> memory){
         std::unique_lock<std::shared_mutex> write_lock(*memory_banks_mutex_);
+        const std::size_t memory_size = memory->get_memory_size();
+        //Range end is inclusive, empty memories and memories past the end of the bus can't be mounted
+        if(memory_size == 0 || memory_start_addr + memory_size > page_count * page_size){
+            return Status::invalid_memory_range_error(
+                "Memory does not fit the bus! (" + std::to_string(memory_start_addr) + " / Size: " + std::to_string(memory_size) + ")"
+            );
+        }
+        const uint16_t memory_end_addr = static_cast<uint16_t>(memory_start_addr + memory_size - 1);
         //Check range availability
-        if(memory_range_is_free(memory_start_addr, (memory_start_addr + memory->get_memory_size()))){
+        if(memory_range_is_free(memory_start_addr, memory_end_addr)){
             memory_banks_.emplace( 
                 memory_start_addr,
-                MemoryBank(memory_start_addr, (memory_start_addr + memory->get_memory_size()), true, memory)
+                MemoryBank(memory_start_addr, memory_end_addr, true, memory)
             );
+            rebuild_pages(memory_start_addr, memory_size);
+            ++mapping_generation_;
             return Status::ok_status();
         }
         return Status::invalid_memory_range_error(
-            "Memory range is occupied currently! (" + std::to_string(memory_start_addr) + " - " + std::to_string((memory_start_addr + memory->get_memory_size())) + ")"
+            "Memory range is occupied currently! (" + std::to_string(memory_start_addr) + " - " + std::to_string(memory_end_addr) + ")"
         );
     }
 
@@ -104,20 +250,117 @@ namespace mygbc{
         std::unique_lock<std::shared_mutex> write_lock(*memory_banks_mutex_);
         auto memory_bank = memory_banks_.find(range_start);
         if(memory_bank != memory_banks_.end()){
+            const std::size_t range_size = memory_bank->second.memory_bank_->get_memory_size();
             memory_banks_.erase(memory_bank);
+            rebuild_pages(range_start, range_size);
+            ++mapping_generation_;
             return Status::ok_status();
         }
         return Status::invalid_memory_range_error("Given start address is not associated with any memory range!");
     }
 
+    /// @brief Sets the observer notified after successful writes.
+    /// @details Only one observer is supported, nullptr detaches the current one. Observer is kept alive while attached.
+    /// @param observer Observer of the writes or nullptr
+    void MemoryController::set_write_observer(std::shared_ptr<MemoryWriteObserver> observer) noexcept{
+        write_observer_ = std::move(observer);
+    }
+
+    /// @brief Returns the observer notified after successful writes.
+    /// @return Current observer or nullptr.
+    MemoryWriteObserver* MemoryController::get_write_observer() const noexcept{
+        return write_observer_.get();
+    }
+
+    /// @brief Returns the generation of the memory mapping.
+    /// @details Changes every time memory is mounted or unmounted. Used to tag data derived from the mapped memory.
+    /// @return Generation of the memory mapping.
+    uint32_t MemoryController::get_mapping_generation() const noexcept{
+        return mapping_generation_;
+    }
+
+    /// @brief Returns the tag of the contents mapped at the page of the address and the page after it.
+    /// @details Mapping generation in the high half, bank tags of the two pages in the low half. A bank switch only changes
+    ///          the tag of the switched pages and of the pages right before them. Used to tag data derived from code starting at
+    ///          the address that does not reach past the next page, like decoded instructions and basic blocks.
+    /// @param address Address on the first page
+    /// @return Tag of the contents.
+    uint64_t MemoryController::get_contents_tag(const uint16_t address) noexcept{
+        const Page& page = get_current_page(address);
+        const Page& next_page = get_current_page(static_cast<uint16_t>(address + page_size));
+        return (static_cast<uint64_t>(mapping_generation_) << 32) | (static_cast<uint32_t>(page.bank_tag) << 16) | next_page.bank_tag;
+    }
+
+    /// @brief Rebuilds the pages of the memories whose direct pointers moved outside of a write trough the controller.
+    /// @details Bumps the mapping generation if the contents of a memory changed.
+    void MemoryController::refresh_direct_pointers() noexcept{
+        bool contents_changed = false;
+        for(auto& memory_bank : memory_banks_){
+            MemoryBank& bank = memory_bank.second;
+            const uint32_t generation = bank.memory_bank_->get_direct_pointer_generation();
+            if(generation != bank.direct_pointer_generation){
+                bank.direct_pointer_generation = generation;
+                //Memory may have shrunk, rebuild the whole mounted range
+                rebuild_pages(bank.range_start, static_cast<std::size_t>(bank.range_end - bank.range_start) + 1);
+            }
+            const uint32_t contents_generation = bank.memory_bank_->get_contents_generation();
+            if(contents_generation != bank.contents_generation){
+                bank.contents_generation = contents_generation;
+                contents_changed = true;
+            }
+        }
+        if(contents_changed){
+            ++mapping_generation_;
+        }
+    }
+
+    /// @brief Forks the controller with clones of the mounted memories.
+    /// @details Memories are cloned trough SystemMemoryInterface::clone and mounted at the same addresses, a memory mounted
+    ///          at several addresses is cloned once. Write observer is not carried over. Must not race with accesses.
+    /// @return Controller over the clones or error Status if a memory can't be cloned.
+    StatusOr<MemoryController> MemoryController::clone(){
+        MemoryCloneMap clones;
+        return clone(clones);
+    }
+
+    /// @brief Forks the controller with clones of the mounted memories, see clone.
+    /// @param clones Clones made during the fork, holds the clones of the memories and their owners afterwards
+    /// @return Controller over the clones or error Status if a memory can't be cloned.
+    StatusOr<MemoryController> MemoryController::clone(MemoryCloneMap& clones){
+        MemoryController controller_clone;
+        Status clone_status = Status::ok_status();
+        for(auto& memory_bank : memory_banks_){
+            const SystemMemoryInterface* memory = memory_bank.second.memory_bank_.get();
+            auto existing_clone = clones.find(memory);
+            if(existing_clone == clones.end()){
+                StatusOr<std::shared_ptr<SystemMemoryInterface>> memory_clone = memory_bank.second.memory_bank_->clone(clones);
+                if(!memory_clone.ok()){
+                    clone_status = memory_clone.status();
+                    break;
+                }
+                existing_clone = clones.emplace(memory, std::move(memory_clone).value()).first;
+            }
+            clone_status = controller_clone.mount_memory(memory_bank.first, std::static_pointer_cast<SystemMemoryInterface>(existing_clone->second));
+            if(!clone_status.ok()){
+                break;
+            }
+        }
+        //Memories now sharing pages copy on write with the clone withdrew their direct write pointers
+        refresh_direct_pointers();
+        if(!clone_status.ok()){
+            return clone_status;
+        }
+        return controller_clone;
+    }
+
     /// @brief Checks wheter the given memory range is unocupied.
     /// @param range_start Start of the range
     /// @param range_end End of the range
     /// @return given memory range is unocupied?
     bool MemoryController::memory_range_is_free(const uint16_t range_start, const uint16_t range_end){
         auto map_range = memory_banks_.lower_bound(range_start); // Get first above or equal to start
-        //Start >= End of all ranges || range_end is not in range of greater or equal range
-        return (map_range == memory_banks_.end() || !map_range->second.in_range(range_end))  &&
+        //Start >= End of all ranges || next range starts past range_end
+        return (map_range == memory_banks_.end() || map_range->second.range_start > range_end)  &&
                (map_range == memory_banks_.begin() || !std::prev(map_range)->second.in_range(range_start)); 
         //We are at begining or prev doesnt have range_start in range.
     }
@@ -127,13 +370,10 @@ namespace mygbc{
     /// @return mounted memorybank that controls the address
     StatusOr<MemoryController::MemoryBank*> MemoryController::get_addr_memory_bank(const uint16_t address){
         std::shared_lock<std::shared_mutex> read_lock(*memory_banks_mutex_);
-        auto nearest_low = memory_banks_.lower_bound(address);
-        //No memory_bank found
-        if(nearest_low != memory_banks_.end()){
-            if(nearest_low != memory_banks_.begin() && nearest_low->first > address){
-                //Current memory bank starts too high
-                nearest_low = std::prev(nearest_low);
-            }
+        auto nearest_high = memory_banks_.upper_bound(address); // Get first starting above the address
+        //No memory_bank starts at or below the address
+        if(nearest_high != memory_banks_.begin()){
+            auto nearest_low = std::prev(nearest_high);
             //Are we in range of the bank?
             if(nearest_low->second.in_range(address)){
                 return &(nearest_low->second);
@@ -144,9 +384,105 @@ namespace mygbc{
         );
     }
 
+    /// @brief Gets the mounted memorybank that controls the address, using the page table when possible.
+    /// @param address Memory address
+    /// @return mounted memorybank that controls the address
+    StatusOr<MemoryController::MemoryBank*> MemoryController::get_page_memory_bank(const uint16_t address){
+        MemoryBank* page_bank = page_table_[address >> 8].bank;
+        if(page_bank != nullptr){
+            return page_bank;
+        }
+        return get_addr_memory_bank(address);
+    }
+
+    /// @brief Rebuilds the pages of the banks whose direct pointers moved.
+    /// @details Called after writes handled by the memory of the given bank.
+    /// @param written_bank Bank that handled the write
+    void MemoryController::refresh_direct_pointers(MemoryBank& written_bank) noexcept{
+        if(written_bank.memory_bank_->get_direct_pointer_generation() == written_bank.direct_pointer_generation){
+            return;
+        }
+        //Write may have moved the pointers of other views of the same device too
+        refresh_direct_pointers();
+    }
+
+    /// @brief Rebuilds the page table entries of the pages overlapping the range.
+    /// @param range_start Start of the range
+    /// @param range_size Size of the range in bytes
+    void MemoryController::rebuild_pages(const uint16_t range_start, const std::size_t range_size) noexcept{
+        const std::size_t last_page = std::min<std::size_t>((range_start + range_size) >> 8, page_count - 1);
+        for(std::size_t page_index = (range_start >> 8); page_index <= last_page; ++page_index){
+            const std::size_t page_start = page_index * page_size;
+            const std::size_t page_last = page_start + page_size - 1;
+            Page page{};
+            //Bank starting at or below the page start must cover the whole page
+            auto nearest_high = memory_banks_.upper_bound(static_cast<uint16_t>(page_start));
+            if(nearest_high != memory_banks_.begin()){
+                MemoryBank& bank = std::prev(nearest_high)->second;
+                const std::size_t bank_size = bank.memory_bank_->get_memory_size();
+                if(page_last < static_cast<std::size_t>(bank.range_start) + bank_size){
+                    const uint16_t page_offset = static_cast<uint16_t>(page_start - bank.range_start);
+                    page.read = bank.memory_bank_->get_direct_read_pointer(page_offset);
+                    page.write = bank.memory_bank_->get_direct_write_pointer(page_offset);
+                    page.dirty = bank.memory_bank_->get_dirty_page_flag(page_offset);
+                    page.bank = &bank;
+                    page.bank_tag = bank.memory_bank_->get_bank_tag(page_offset);
+                    if(const uint32_t* generation_counter = bank.memory_bank_->get_direct_pointer_generation_counter()){
+                        page.generation = generation_counter;
+                        page.built_generation = *generation_counter;
+                    }
+                }
+            }
+            page_table_[page_index] = page;
+        }
+        link_mirror_pages();
+    }
+
+    /// @brief Links the pages sharing their direct read pointer into rings of mirrors.
+    void MemoryController::link_mirror_pages() noexcept{
+        //Direct pages sorted by read pointer, mirrors end up next to each other
+        std::array<std::pair<const uint8_t*, uint16_t>, page_count> direct_pages;
+        std::size_t direct_page_count = 0;
+        for(std::size_t page_index = 0; page_index < page_count; ++page_index){
+            page_table_[page_index].mirror_page = no_mirror_page;
+            if(page_table_[page_index].read != nullptr){
+                direct_pages[direct_page_count++] = {page_table_[page_index].read, static_cast<uint16_t>(page_index)};
+            }
+        }
+        std::sort(direct_pages.begin(), direct_pages.begin() + direct_page_count, [](const auto& lhs, const auto& rhs){
+            return std::less<const uint8_t*>()(lhs.first, rhs.first);
+        });
+        std::size_t first = 0;
+        while(first < direct_page_count){
+            std::size_t last = first;
+            while(last + 1 < direct_page_count && direct_pages[last + 1].first == direct_pages[first].first){
+                ++last;
+            }
+            for(std::size_t mirror = first; last != first && mirror <= last; ++mirror){
+                page_table_[direct_pages[mirror].second].mirror_page = direct_pages[(mirror == last) ? first : mirror + 1].second;
+            }
+            first = last + 1;
+        }
+    }
+
+    /// @brief Reports a write to the observer, at the written address and at its mirrors.
+    /// @param addr Address of the first written byte
+    /// @param size Bytes written, all on the page of the address
+    void MemoryController::notify_write(const uint16_t addr, const uint16_t size) noexcept{
+        if(write_observer_ == nullptr){
+            return;
+        }
+        write_observer_->on_memory_write(addr, size);
+        const uint16_t written_page = addr >> 8;
+        for(uint16_t mirror = page_table_[written_page].mirror_page; mirror != no_mirror_page && mirror != written_page; mirror = page_table_[mirror].mirror_page){
+            write_observer_->on_memory_write(static_cast<uint16_t>((mirror << 8) | (addr & 0xFF)), size);
+        }
+    }
+
     /// @brief Memorybank container
     MemoryController::MemoryBank::MemoryBank(const uint16_t memory_range_start, const uint16_t memory_range_end, bool enabled, std::shared_ptr<SystemMemoryInterface> memory)
-    :range_start(memory_range_start), range_end(memory_range_end), mount_enabled(enabled), memory_bank_(memory){
+    :range_start(memory_range_start), range_end(memory_range_end), mount_enabled(enabled), memory_bank_(memory),
+    direct_pointer_generation(memory->get_direct_pointer_generation()), contents_generation(memory->get_contents_generation()){
     }
 
     /// @brief Checks if the external address falls in the range of the memory memory bank
@@ -5,15 +5,39 @@
 #include <memory> //std::shared_ptr
 #include <mutex> //std::unique_lock
 #include <map> //std::map
+#include <array> //std::array
+#include <span> //std::span
 #include "../memory/system_memory_interface.h" //MemoryInterface
+#include "../memory/memory_write_observer.h" //MemoryWriteObserver
 
 namespace mygbc{
+
+    /// @brief Maps the mounted memories onto the 16-bit bus.
+    /// @details Bus is split into 256 pages of 256 bytes. Pages wholly covered by a memory exposing direct pointers
+    ///          are read and written with a single indexed access, the rest go trough the virtual interface of the memory.
+    ///          Page table is rebuilt on mount, unmount and free, which must not race with accesses. Memories moving their
+    ///          direct pointers on writes they handle, like bank switching cartridges, have their pages rebuilt after the write.
+    ///          Direct writes set the dirty flag of the page when the memory tracks dirty pages. Pages sharing their direct
+    ///          read pointer, like the echo of the work RAM, are linked as mirrors: writes to one are reported to the observer
+    ///          at every mirror too.
     class MemoryController{
         public: 
 
+            //Bytes in a page of the page table
+            static constexpr std::size_t page_size = 0x100;
+
+            //Pages in the page table
+            static constexpr std::size_t page_count = 0x100;
+
             /// @brief Default constructor
             MemoryController();
 
+            //Page table points into the memory banks of this instance
+            MemoryController(const MemoryController&) = delete;
+            MemoryController& operator=(const MemoryController&) = delete;
+            MemoryController(MemoryController&&) = default;
+            MemoryController& operator=(MemoryController&&) = default;
+
             /// @brief Returns the byte located at the given address.
             /// @details Returns the byte located at the given address. Address is zero-based indexed. 
             /// @param addr Zero based address.
@@ -44,6 +68,22 @@ namespace mygbc{
             /// @return Returns status of the set
             Status set_word(const uint16_t addr, const uint16_t value) noexcept;
 
+            /// @brief Reads the block of memory starting at the given address.
+            /// @details Pages with direct pointers are copied with memcpy, the rest is read byte by byte trough the memory.
+            ///          Block may span several mounted memories but must not wrap past 0xFFFF.
+            /// @param addr Zero based address of the first byte.
+            /// @param destination Buffer to read into, its size is the size of the block.
+            /// @return Returns status of the read
+            Status read_block(const uint16_t addr, std::span<uint8_t> destination) noexcept;
+
+            /// @brief Writes the block of memory starting at the given address.
+            /// @details Pages with direct pointers are copied with memcpy and reported to the observer once per page, the rest
+            ///          is written byte by byte trough set_byte. Stops at the first failing byte, the bytes before it stay written.
+            /// @param addr Zero based address of the first byte.
+            /// @param source Bytes to write, its size is the size of the block.
+            /// @return Returns status of the write
+            Status write_block(const uint16_t addr, std::span<const uint8_t> source) noexcept;
+
             /// @brief Clears the memory banks array.
             /// @details Clears the memory banks array.
             void free();
@@ -59,6 +99,43 @@ namespace mygbc{
             /// @return Unmount status
             Status unmount_range(const uint16_t range_start);
 
+            /// @brief Sets the observer notified after successful writes.
+            /// @details Only one observer is supported, nullptr detaches the current one. Observer is kept alive while attached.
+            /// @param observer Observer of the writes or nullptr
+            void set_write_observer(std::shared_ptr<MemoryWriteObserver> observer) noexcept;
+
+            /// @brief Returns the observer notified after successful writes.
+            /// @return Current observer or nullptr.
+            MemoryWriteObserver* get_write_observer() const noexcept;
+
+            /// @brief Returns the generation of the memory mapping.
+            /// @details Changes every time memory is mounted or unmounted. Used to tag data derived from the mapped memory.
+            /// @return Generation of the memory mapping.
+            uint32_t get_mapping_generation() const noexcept;
+
+            /// @brief Returns the tag of the contents mapped at the page of the address and the page after it.
+            /// @details Mapping generation in the high half, bank tags of the two pages in the low half. A bank switch only changes
+            ///          the tag of the switched pages and of the pages right before them. Used to tag data derived from code starting at
+            ///          the address that does not reach past the next page, like decoded instructions and basic blocks.
+            /// @param address Address on the first page
+            /// @return Tag of the contents.
+            uint64_t get_contents_tag(const uint16_t address) noexcept;
+
+            /// @brief Rebuilds the pages of the memories whose direct pointers moved outside of a write trough the controller.
+            /// @details Bumps the mapping generation if the contents of a memory changed.
+            void refresh_direct_pointers() noexcept;
+
+            /// @brief Forks the controller with clones of the mounted memories.
+            /// @details Memories are cloned trough SystemMemoryInterface::clone and mounted at the same addresses, a memory mounted
+            ///          at several addresses is cloned once. Write observer is not carried over. Must not race with accesses.
+            /// @return Controller over the clones or error Status if a memory can't be cloned.
+            StatusOr<MemoryController> clone();
+
+            /// @brief Forks the controller with clones of the mounted memories, see clone.
+            /// @param clones Clones made during the fork, holds the clones of the memories and their owners afterwards
+            /// @return Controller over the clones or error Status if a memory can't be cloned.
+            StatusOr<MemoryController> clone(MemoryCloneMap& clones);
+
             private:
             
             /// @brief Checks wheter the given memory range is unocupied.
@@ -86,19 +163,84 @@ namespace mygbc{
                     uint16_t range_end;
                     bool mount_enabled;
                     std::shared_ptr<SystemMemoryInterface> memory_bank_;
+                    uint32_t direct_pointer_generation; //Generation the pages were built from
+                    uint32_t contents_generation; //Contents generation the mapping generation was bumped for
+            };
+
+            //Generation counter of the pages whose direct pointers never move
+            static constexpr uint32_t fixed_generation = 0;
+
+            //Mirror page of the pages not sharing their storage
+            static constexpr uint16_t no_mirror_page = page_count;
+
+            //Entry of the page table
+            struct Page{
+                const uint8_t* read; //Direct read pointer to the first byte of the page, nullptr if not direct
+                uint8_t* write; //Direct write pointer to the first byte of the page, nullptr if not direct
+                uint8_t* dirty; //Dirty flag set on direct writes, nullptr if the memory does not track dirty pages
+                MemoryBank* bank; //Bank covering the whole page, nullptr if unmapped or split between banks
+                const uint32_t* generation = &fixed_generation; //Direct pointer generation counter of the memory
+                uint32_t built_generation = fixed_generation; //Generation the pointers were taken at
+                uint16_t bank_tag = 0; //Tag of the bank mapped at the page, see SystemMemoryInterface::get_bank_tag
+                uint16_t mirror_page = no_mirror_page; //Next page in the ring of pages with the same direct read pointer
             };
 
+            /// @brief Returns the page of the address, rebuilt first if the direct pointers of its memory moved.
+            /// @details Pointers may move outside of the controller, like by set_memory or free of a mounted memory.
+            /// @param addr Address on the page
+            /// @return Page table entry with current pointers.
+            inline const Page& get_current_page(const uint16_t addr) noexcept{
+                const Page& page = page_table_[addr >> 8];
+                if(*page.generation != page.built_generation) [[unlikely]]{
+                    refresh_direct_pointers();
+                }
+                return page;
+            }
+
             /// @brief Gets the mounted memorybank that controls the address
             /// @param address Memory address
             /// @return mounted memorybank that controls the address
             StatusOr<MemoryBank*> get_addr_memory_bank(const uint16_t address);
 
+            /// @brief Gets the mounted memorybank that controls the address, using the page table when possible.
+            /// @param address Memory address
+            /// @return mounted memorybank that controls the address
+            StatusOr<MemoryBank*> get_page_memory_bank(const uint16_t address);
+
+            /// @brief Rebuilds the pages of the banks whose direct pointers moved.
+            /// @details Called after writes handled by the memory of the given bank.
+            /// @param written_bank Bank that handled the write
+            void refresh_direct_pointers(MemoryBank& written_bank) noexcept;
+
+            /// @brief Rebuilds the page table entries of the pages overlapping the range.
+            /// @details Relinks the mirror pages afterwards.
+            /// @param range_start Start of the range
+            /// @param range_size Size of the range in bytes
+            void rebuild_pages(const uint16_t range_start, const std::size_t range_size) noexcept;
+
+            /// @brief Links the pages sharing their direct read pointer into rings of mirrors.
+            void link_mirror_pages() noexcept;
+
+            /// @brief Reports a write to the observer, at the written address and at its mirrors.
+            /// @param addr Address of the first written byte
+            /// @param size Bytes written, all on the page of the address
+            void notify_write(const uint16_t addr, const uint16_t size) noexcept;
+
             //Memory banks container
             std::map<uint16_t, MemoryBank> memory_banks_;
 
+            //Page => direct pointers and covering bank
+            std::array<Page, page_count> page_table_;
+
             //Read/Write mutex. shared_ptr so its movable
             std::shared_ptr<std::shared_mutex> memory_banks_mutex_;
 
+            //Notified after successful writes
+            std::shared_ptr<MemoryWriteObserver> write_observer_;
+
+            //Bumped on every mount and unmount
+            uint32_t mapping_generation_;
+
     };
 }
 
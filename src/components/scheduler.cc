@@ -0,0 +1,106 @@
+#include "scheduler.h" //Scheduler
+#include <algorithm> //std::push_heap, std::pop_heap
+#include <functional> //std::greater
+
+namespace mygbc{
+
+    /// @brief Initializes the scheduler at tick 0 with no events.
+    Scheduler::Scheduler():current_cycle_(0), next_sequence_(1){
+        pending_sequences_.fill(0);
+        pending_deadlines_.fill(no_deadline);
+    }
+
+    /// @brief Returns the ticks elapsed since the start.
+    /// @return Current tick.
+    uint64_t Scheduler::get_current_cycle() const noexcept{
+        return current_cycle_;
+    }
+
+    /// @brief Advances the tick counter, due events are kept until popped.
+    /// @param cycles Ticks elapsed
+    void Scheduler::advance(const uint64_t cycles) noexcept{
+        current_cycle_ += cycles;
+    }
+
+    /// @brief Schedules the event the given ticks from now, replacing the pending one.
+    /// @param event Event to schedule
+    /// @param cycles Ticks from the current tick
+    void Scheduler::schedule(const SchedulerEvent event, const uint64_t cycles){
+        schedule_at(event, current_cycle_ + cycles);
+    }
+
+    /// @brief Schedules the event at the given tick, replacing the pending one.
+    /// @details Past deadlines are due right away.
+    /// @param event Event to schedule
+    /// @param deadline Tick of the event
+    void Scheduler::schedule_at(const SchedulerEvent event, const uint64_t deadline){
+        const std::size_t index = static_cast<std::size_t>(event);
+        pending_sequences_[index] = next_sequence_;
+        pending_deadlines_[index] = deadline;
+        heap_.push_back(Entry{deadline, next_sequence_++, event});
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<Entry>());
+        drop_stale_entries();
+    }
+
+    /// @brief Cancels the pending event.
+    /// @param event Event to cancel
+    void Scheduler::cancel(const SchedulerEvent event) noexcept{
+        const std::size_t index = static_cast<std::size_t>(event);
+        pending_sequences_[index] = 0;
+        pending_deadlines_[index] = no_deadline;
+        drop_stale_entries();
+    }
+
+    /// @brief Is the event pending?
+    /// @param event Event to check
+    /// @return Event scheduled and not yet popped?
+    bool Scheduler::is_scheduled(const SchedulerEvent event) const noexcept{
+        return pending_sequences_[static_cast<std::size_t>(event)] != 0;
+    }
+
+    /// @brief Returns the deadline of the pending event.
+    /// @param event Event to check
+    /// @return Tick of the event or no_deadline if not scheduled.
+    uint64_t Scheduler::get_event_deadline(const SchedulerEvent event) const noexcept{
+        return pending_deadlines_[static_cast<std::size_t>(event)];
+    }
+
+    /// @brief Returns the deadline of the earliest pending event.
+    /// @return Tick of the next event or no_deadline if nothing is scheduled.
+    uint64_t Scheduler::get_next_deadline() const noexcept{
+        //Top is never stale
+        return heap_.empty() ? no_deadline : heap_.front().deadline;
+    }
+
+    /// @brief Pops the earliest event whose deadline is at or before the current tick.
+    /// @param event Set to the popped event
+    /// @param deadline Set to the tick the event was scheduled at
+    /// @return Was a event due?
+    bool Scheduler::pop_due_event(SchedulerEvent& event, uint64_t& deadline) noexcept{
+        if(heap_.empty() || heap_.front().deadline > current_cycle_){
+            return false;
+        }
+        event = heap_.front().event;
+        deadline = heap_.front().deadline;
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<Entry>());
+        heap_.pop_back();
+        pending_sequences_[static_cast<std::size_t>(event)] = 0;
+        pending_deadlines_[static_cast<std::size_t>(event)] = no_deadline;
+        drop_stale_entries();
+        return true;
+    }
+
+    /// @brief Orders the heap, earliest deadline on top.
+    bool Scheduler::Entry::operator>(const Entry& other) const noexcept{
+        return (deadline != other.deadline) ? deadline > other.deadline : sequence > other.sequence;
+    }
+
+    /// @brief Pops the top entries of cancelled or rescheduled events.
+    void Scheduler::drop_stale_entries() noexcept{
+        while(!heap_.empty() && pending_sequences_[static_cast<std::size_t>(heap_.front().event)] != heap_.front().sequence){
+            std::pop_heap(heap_.begin(), heap_.end(), std::greater<Entry>());
+            heap_.pop_back();
+        }
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,110 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <array> //std::array
+#include <vector> //std::vector
+#include <limits> //std::numeric_limits
+#include <cstdint> //Fixed lenght variables
+
+namespace mygbc{
+
+    //Events of the peripherals, at most one pending of each
+    enum class SchedulerEvent : uint8_t{
+        SCANLINE_END = 0, //End of the current scanline
+        TIMER_OVERFLOW = 1, //Overflow of TIMA
+        SERIAL_BIT = 2, //Bit shifted trough the serial port
+        DMA_COMPLETE = 3, //End of a OAM DMA transfer
+        INTERRUPT = 4, //Interrupt request raised at a given tick
+        COUNT = 5
+    };
+
+    /// @brief Keeps the tick counter and the future events of the peripherals.
+    /// @details Events sit in a min-heap ordered by deadline, ties in scheduling order. Rescheduling or cancelling leaves the old
+    ///          entry in the heap, it is dropped once it reaches the top. The cpu runs until the next deadline, peripherals
+    ///          handle their events then and cost nothing in between.
+    class Scheduler{
+        public:
+
+            //Deadline of a event that is not scheduled
+            static constexpr uint64_t no_deadline = std::numeric_limits<uint64_t>::max();
+
+            /// @brief Initializes the scheduler at tick 0 with no events.
+            Scheduler();
+
+            /// @brief Returns the ticks elapsed since the start.
+            /// @return Current tick.
+            uint64_t get_current_cycle() const noexcept;
+
+            /// @brief Advances the tick counter, due events are kept until popped.
+            /// @param cycles Ticks elapsed
+            void advance(const uint64_t cycles) noexcept;
+
+            /// @brief Schedules the event the given ticks from now, replacing the pending one.
+            /// @param event Event to schedule
+            /// @param cycles Ticks from the current tick
+            void schedule(const SchedulerEvent event, const uint64_t cycles);
+
+            /// @brief Schedules the event at the given tick, replacing the pending one.
+            /// @details Past deadlines are due right away.
+            /// @param event Event to schedule
+            /// @param deadline Tick of the event
+            void schedule_at(const SchedulerEvent event, const uint64_t deadline);
+
+            /// @brief Cancels the pending event.
+            /// @param event Event to cancel
+            void cancel(const SchedulerEvent event) noexcept;
+
+            /// @brief Is the event pending?
+            /// @param event Event to check
+            /// @return Event scheduled and not yet popped?
+            bool is_scheduled(const SchedulerEvent event) const noexcept;
+
+            /// @brief Returns the deadline of the pending event.
+            /// @param event Event to check
+            /// @return Tick of the event or no_deadline if not scheduled.
+            uint64_t get_event_deadline(const SchedulerEvent event) const noexcept;
+
+            /// @brief Returns the deadline of the earliest pending event.
+            /// @return Tick of the next event or no_deadline if nothing is scheduled.
+            uint64_t get_next_deadline() const noexcept;
+
+            /// @brief Pops the earliest event whose deadline is at or before the current tick.
+            /// @param event Set to the popped event
+            /// @param deadline Set to the tick the event was scheduled at
+            /// @return Was a event due?
+            bool pop_due_event(SchedulerEvent& event, uint64_t& deadline) noexcept;
+
+        private:
+
+            //Scheduled event, sequence tells entries of the same event apart
+            struct Entry{
+                uint64_t deadline;
+                uint64_t sequence;
+                SchedulerEvent event;
+
+                /// @brief Orders the heap, earliest deadline on top.
+                bool operator>(const Entry& other) const noexcept;
+            };
+
+            /// @brief Pops the top entries of cancelled or rescheduled events.
+            void drop_stale_entries() noexcept;
+
+            //Ticks since the start
+            uint64_t current_cycle_;
+
+            //Sequence of the next scheduled entry
+            uint64_t next_sequence_;
+
+            //Min-heap of the entries
+            std::vector<Entry> heap_;
+
+            //Event => sequence of its pending entry, 0 if not scheduled
+            std::array<uint64_t, static_cast<std::size_t>(SchedulerEvent::COUNT)> pending_sequences_;
+
+            //Event => deadline of its pending entry
+            std::array<uint64_t, static_cast<std::size_t>(SchedulerEvent::COUNT)> pending_deadlines_;
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -1,24 +1,367 @@
 #include "gbc.h"//GBC
+#include "memory/arena_memory.h" //ArenaMemory
+#include "memory/high_page_memory.h" //HighPageMemory
+#include <array> //std::array
+#include <algorithm> //std::min
+#include <optional> //std::optional
 
 namespace mygbc{
 
+    namespace{
+        //Sizes of the arena regions, in MemoryRegion order
+        const std::vector<std::size_t> memory_region_sizes{0x2000, 0x2000, 0xA0, 0x100};
+
+        //Range of a arena region mounted on the bus
+        struct RegionMount{
+            uint16_t bus_address;
+            GBC::MemoryRegion region;
+            std::size_t region_offset;
+            std::size_t size;
+        };
+
+        //Mounts of the arena regions, the high page is mounted with the interrupt controller
+        constexpr std::array<RegionMount, 4> region_mounts{{
+            {0x8000, GBC::MemoryRegion::VIDEO_RAM, 0x0000, 0x2000},
+            {0xC000, GBC::MemoryRegion::WORK_RAM, 0x0000, 0x2000},
+            {0xE000, GBC::MemoryRegion::WORK_RAM, 0x0000, 0x1E00}, //Echo of the work RAM
+            {0xFE00, GBC::MemoryRegion::OBJECT_ATTRIBUTE_MEMORY, 0x0000, 0xA0}
+        }};
+
+        //Bus address of the high page
+        constexpr uint16_t high_page_address = 0xFF00;
+
+        //Offsets of the I/O registers in the high page
+        constexpr std::size_t scanline_offset = 0x44;
+    }
+
+    /// @brief Initializes the GBC, stop flag cleared.
+    GBC::GBC():GBC(std::make_shared<MemoryArena>(memory_region_sizes)){
+    }
+
+    /// @brief Initializes the GBC over the given memory arena, stop flag cleared.
+    /// @param memory_arena Arena holding the emulated RAM regions
+    GBC::GBC(std::shared_ptr<MemoryArena> memory_arena)
+    :run_flag_(true), memory_arena_(std::move(memory_arena)), memory_arena_mounted_(false),
+    interrupt_controller_(std::make_shared<InterruptController>(memory_arena_, static_cast<std::size_t>(MemoryRegion::HIGH_PAGE))),
+    idle_loop_skipping_(true), idle_loop_{0, 0, 0, false}{
+        scheduler_.schedule(SchedulerEvent::SCANLINE_END, cycles_per_scanline);
+    }
+
     /// @brief Inits the gbc internals.
-    /// @return 
+    /// @details Clears the stop flag and mounts the regions of the memory arena on the first call.
+    /// @return Status of the init.
     Status GBC::init(){
         run_flag_.store(true);
-        
+        if(!memory_arena_mounted_){
+            for(const RegionMount& region_mount : region_mounts){
+                Status mount_status = memory_controller_.mount_memory(
+                    region_mount.bus_address,
+                    std::make_shared<ArenaMemory>(memory_arena_, static_cast<std::size_t>(region_mount.region), region_mount.region_offset, region_mount.size)
+                );
+                if(!mount_status.ok()){
+                    return mount_status;
+                }
+            }
+            Status high_page_mount = memory_controller_.mount_memory(high_page_address, std::make_shared<HighPageMemory>(interrupt_controller_));
+            if(!high_page_mount.ok()){
+                return high_page_mount;
+            }
+            memory_arena_mounted_ = true;
+        }
+        return Status::ok_status();
+    }
+
+    /// @brief Stops the execution of the GBC
+    /// @details Run methods return at the next slice boundary.
+    void GBC::stop(){
+        run_flag_.store(false);
     }
 
     /// @brief Runs the main loop of the GBC.
     /// @return Exit status of the GBC.
     Status GBC::main_loop(){
-        StatusOr<uint8_t> instruction_emulation;
-        while(run_flag_.load()){
-            instruction_emulation = processing_unit.fetch_decode_execute(memory_controller_);
-            if(!instruction_emulation.ok()){
-                return instruction_emulation.status();
+        while(run_flag_.load(std::memory_order_relaxed)){
+            StatusOr<uint64_t> frame_run = run_frames(1);
+            if(!frame_run.ok()){
+                return frame_run.status();
+            }
+        }
+        return Status::ok_status();
+    }
+
+    /// @brief Runs the GBC for the given amount of ticks.
+    /// @details Stops at the first instruction boundary at or past the budget, or at a slice boundary after stop.
+    /// @param cycles Tick budget
+    /// @return Status or Ticks elapsed.
+    StatusOr<uint64_t> GBC::run_for_cycles(const uint64_t cycles){
+        uint64_t elapsed = 0;
+        bool predicate_met = false;
+        while(elapsed < cycles && run_flag_.load(std::memory_order_relaxed)){
+            StatusOr<uint64_t> slice_run = run_slice(std::min(cycles - elapsed, run_slice_cycles), nullptr, predicate_met);
+            if(!slice_run.ok()){
+                return slice_run.status();
+            }
+            elapsed += slice_run.value();
+        }
+        return elapsed;
+    }
+
+    /// @brief Runs the GBC up to the given frame boundary.
+    /// @details Frames are counted from the first tick, a frame already in progress counts as the first one.
+    /// @param frames Frame boundaries to pass
+    /// @return Status or Ticks elapsed.
+    StatusOr<uint64_t> GBC::run_frames(const uint64_t frames){
+        if(frames == 0){
+            return uint64_t{0};
+        }
+        const uint64_t frame_boundary = (get_elapsed_cycles() / cycles_per_frame + frames) * cycles_per_frame;
+        return run_for_cycles(frame_boundary - get_elapsed_cycles());
+    }
+
+    /// @brief Runs the GBC until the predicate holds or the tick limit is reached.
+    /// @details Predicate is checked before the first and after every dispatch of the cpu.
+    /// @param predicate Condition to stop at
+    /// @param cycle_limit Tick budget
+    /// @return Status or Ticks elapsed.
+    StatusOr<uint64_t> GBC::run_until(const std::function<bool(const GBC&)>& predicate, const uint64_t cycle_limit){
+        uint64_t elapsed = 0;
+        bool predicate_met = predicate(*this);
+        while(elapsed < cycle_limit && !predicate_met && run_flag_.load(std::memory_order_relaxed)){
+            StatusOr<uint64_t> slice_run = run_slice(std::min(cycle_limit - elapsed, run_slice_cycles), &predicate, predicate_met);
+            if(!slice_run.ok()){
+                return slice_run.status();
+            }
+            elapsed += slice_run.value();
+        }
+        return elapsed;
+    }
+
+    /// @brief Runs the GBC until the wall clock deadline passes.
+    /// @details Deadline is checked at slice boundaries.
+    /// @param deadline Wall clock deadline
+    /// @return Status or Ticks elapsed.
+    StatusOr<uint64_t> GBC::run_until(const std::chrono::steady_clock::time_point deadline){
+        uint64_t elapsed = 0;
+        bool predicate_met = false;
+        while(std::chrono::steady_clock::now() < deadline && run_flag_.load(std::memory_order_relaxed)){
+            StatusOr<uint64_t> slice_run = run_slice(run_slice_cycles, nullptr, predicate_met);
+            if(!slice_run.ok()){
+                return slice_run.status();
+            }
+            elapsed += slice_run.value();
+        }
+        return elapsed;
+    }
+
+    /// @brief Enables or disables skipping of idle loops.
+    /// @details Once a iteration of a idle loop completes without events, whole iterations up to the next event are
+    ///          skipped. Results match plain stepping. Never skipped while run_until checks a predicate.
+    /// @param enabled Skip idle loops?
+    void GBC::set_idle_loop_skipping(const bool enabled) noexcept{
+        idle_loop_skipping_ = enabled;
+        idle_loop_.tracking = false;
+    }
+
+    /// @brief Is skipping of idle loops enabled?
+    /// @return Skip idle loops?
+    bool GBC::is_idle_loop_skipping() const noexcept{
+        return idle_loop_skipping_;
+    }
+
+    /// @brief Enables or disables the lazy flags mode of the cpu.
+    /// @details Flags of ALU instructions are computed only when read. Results match eager flags, see LR35902::set_lazy_flags.
+    /// @param enabled Lazy flags mode on?
+    void GBC::set_lazy_flags(const bool enabled) noexcept{
+        processing_unit.set_lazy_flags(enabled);
+    }
+
+    /// @brief Is the lazy flags mode of the cpu enabled?
+    /// @return Lazy flags mode on?
+    bool GBC::is_lazy_flags() const noexcept{
+        return processing_unit.is_lazy_flags();
+    }
+
+    /// @brief Forks the GBC from its current state.
+    /// @details Mounted memories are cloned trough MemoryController::clone, the memory arena is copied as a whole.
+    ///          Registers, backend and scheduler are copied, the clone rebuilds its instruction caches on use.
+    ///          Call from the thread running the GBC or while it is stopped.
+    /// @return Clone of the GBC or error Status if a memory can't be cloned.
+    StatusOr<std::unique_ptr<GBC>> GBC::clone(){
+        MemoryCloneMap clones;
+        StatusOr<MemoryController> memory_clone = memory_controller_.clone(clones);
+        if(!memory_clone.ok()){
+            return memory_clone.status();
+        }
+        //Mounted views cloned the arena already
+        auto arena_clone = clones.find(memory_arena_.get());
+        std::unique_ptr<GBC> gbc_clone(new GBC(
+            (arena_clone != clones.end()) ? std::static_pointer_cast<MemoryArena>(arena_clone->second) : memory_arena_->clone()
+        ));
+        gbc_clone->memory_arena_mounted_ = memory_arena_mounted_;
+        //Mounted high page cloned the interrupt controller already
+        auto interrupt_controller_clone = clones.find(interrupt_controller_.get());
+        if(interrupt_controller_clone != clones.end()){
+            gbc_clone->interrupt_controller_ = std::static_pointer_cast<InterruptController>(interrupt_controller_clone->second);
+        }
+        gbc_clone->idle_loop_skipping_ = idle_loop_skipping_;
+        gbc_clone->memory_controller_ = std::move(memory_clone).value();
+        gbc_clone->processing_unit.get_register_file() = processing_unit.get_register_file();
+        gbc_clone->processing_unit.set_execution_backend(processing_unit.get_execution_backend());
+        gbc_clone->scheduler_ = scheduler_;
+        return gbc_clone;
+    }
+
+    /// @brief Returns the ticks elapsed since the GBC was created.
+    /// @return Elapsed ticks.
+    uint64_t GBC::get_elapsed_cycles() const noexcept{
+        return scheduler_.get_current_cycle();
+    }
+
+    /// @brief Grants access to the scheduler keeping the ticks and the peripheral events.
+    /// @return Scheduler.
+    Scheduler& GBC::get_scheduler() noexcept{
+        return scheduler_;
+    }
+
+    /// @brief Runs the cpu for the given budget without checking the stop flag.
+    /// @param cycles Tick budget
+    /// @param predicate Condition to stop at, checked after every dispatch if set
+    /// @param predicate_met Set when the predicate stopped the slice
+    /// @return Status or Ticks elapsed.
+    StatusOr<uint64_t> GBC::run_slice(const uint64_t cycles, const std::function<bool(const GBC&)>* predicate, bool& predicate_met){
+        uint64_t elapsed = 0;
+        run_due_events();
+        while(elapsed < cycles && !predicate_met){
+            //Cpu runs uninterrupted up to the next event or the end of the budget
+            const uint64_t segment = std::min(cycles - elapsed, scheduler_.get_next_deadline() - scheduler_.get_current_cycle());
+            uint64_t segment_elapsed = 0;
+            while(segment_elapsed < segment){
+                uint64_t dispatch_cycles = 0;
+                std::optional<uint16_t> previous_pc;
+                LR35902RegisterFile& register_file = processing_unit.get_register_file();
+                //Single branch on the pending interrupts cached by the controller
+                if(interrupt_controller_->get_pending() != 0){
+                    //Enabled interrupt wakes a halted cpu, regardless of IME
+                    register_file.halted = false;
+                    if(register_file.ime){
+                        StatusOr<uint8_t> service = service_interrupt();
+                        if(!service.ok()){
+                            return service.status();
+                        }
+                        dispatch_cycles = service.value();
+                    }
+                }
+                if(dispatch_cycles != 0){
+                    //Handler starts on the next dispatch, away from any idle loop
+                    idle_loop_.tracking = false;
+                }
+                else if(register_file.halted){
+                    //Only a event can wake the cpu, idle machine cycles up to it are skipped at once
+                    const uint64_t machine_cycle = LR35902::machine_cycle_ticks;
+                    dispatch_cycles = (segment - segment_elapsed + machine_cycle - 1) / machine_cycle * machine_cycle;
+                }
+                else{
+                    //Blocks end before crossing the segment, only the first instruction of a dispatch can overshoot it
+                    previous_pc = register_file.pc.get_word();
+                    const uint16_t cycle_budget = static_cast<uint16_t>(
+                        std::min<uint64_t>(segment - segment_elapsed, LR35902::unbounded_cycle_budget)
+                    );
+                    StatusOr<uint16_t> dispatch = processing_unit.step(memory_controller_, cycle_budget);
+                    if(!dispatch.ok()){
+                        return dispatch.status();
+                    }
+                    dispatch_cycles = dispatch.value();
+                }
+                //HALT does not halt with IME clear and a interrupt already pending, the next opcode byte is read twice
+                if(register_file.halted && !register_file.ime && interrupt_controller_->get_pending() != 0){
+                    register_file.halted = false;
+                    register_file.halt_bug = true;
+                }
+                segment_elapsed += dispatch_cycles;
+                scheduler_.advance(dispatch_cycles);
+                //Predicate must see every dispatch
+                if(previous_pc.has_value() && idle_loop_skipping_ && predicate == nullptr && segment_elapsed < segment){
+                    const uint64_t skipped_cycles = skip_idle_loop(previous_pc.value(), segment - segment_elapsed);
+                    segment_elapsed += skipped_cycles;
+                    scheduler_.advance(skipped_cycles);
+                }
+                if(predicate != nullptr && (*predicate)(*this)){
+                    predicate_met = true;
+                    break;
+                }
             }
-            
+            elapsed += segment_elapsed;
+            run_due_events();
+        }
+        return elapsed;
+    }
+
+    /// @brief Dispatches the highest priority pending interrupt to its handler.
+    /// @details Interrupt is acknowledged in IF.
+    /// @return Status or Ticks of the dispatch.
+    StatusOr<uint8_t> GBC::service_interrupt(){
+        const uint8_t interrupt = InterruptController::get_highest_priority(interrupt_controller_->get_pending());
+        interrupt_controller_->acknowledge(interrupt);
+        return processing_unit.service_interrupt(memory_controller_, InterruptController::get_vector(interrupt));
+    }
+
+    /// @brief Follows the idle loop the cpu is spinning in, skipping its repeated iterations.
+    /// @param previous_pc Pc before the last dispatch
+    /// @param remaining_cycles Ticks left in the segment
+    /// @return Ticks skipped, whole iterations.
+    uint64_t GBC::skip_idle_loop(const uint16_t previous_pc, const uint64_t remaining_cycles){
+        const uint16_t pc = processing_unit.get_register_file().pc.get_word();
+        const uint64_t current_cycle = scheduler_.get_current_cycle();
+        if(idle_loop_.tracking){
+            if(pc < idle_loop_.start_address || pc > idle_loop_.last_address){
+                idle_loop_.tracking = false;
+            }
+            else if(pc == idle_loop_.start_address){
+                //Iteration completed on unchanged memory, the next ones repeat it up to the next event
+                const uint64_t iteration_cycles = current_cycle - idle_loop_.arrival_cycle;
+                const uint64_t skipped_cycles = remaining_cycles / iteration_cycles * iteration_cycles;
+                idle_loop_.arrival_cycle = current_cycle + skipped_cycles;
+                return skipped_cycles;
+            }
+            return 0;
+        }
+        //Loops are entered trough their closing jump, only backward control flow is analysed
+        uint16_t last_address = 0;
+        if(pc <= previous_pc && processing_unit.find_idle_loop(memory_controller_, pc, last_address)){
+            idle_loop_ = IdleLoop{pc, last_address, current_cycle, true};
+        }
+        return 0;
+    }
+
+    /// @brief Handles the events due at the current tick.
+    /// @details Memory polled by a idle loop may change, its next iteration is run again.
+    void GBC::run_due_events(){
+        SchedulerEvent event;
+        uint64_t deadline = 0;
+        while(scheduler_.pop_due_event(event, deadline)){
+            handle_event(event, deadline);
+            idle_loop_.tracking = false;
+        }
+    }
+
+    /// @brief Handles a single event of the scheduler.
+    /// @param event Due event
+    /// @param deadline Tick the event was scheduled at
+    void GBC::handle_event(const SchedulerEvent event, const uint64_t deadline){
+        switch(event){
+            case SchedulerEvent::SCANLINE_END:{
+                //Scanline follows from the tick, late handling does not drift
+                const uint8_t scanline = static_cast<uint8_t>((deadline / cycles_per_scanline) % scanlines_per_frame);
+                memory_arena_->set_byte(memory_arena_->get_region_offset(static_cast<std::size_t>(MemoryRegion::HIGH_PAGE)) + scanline_offset, scanline);
+                if(scanline == vblank_scanline){
+                    interrupt_controller_->request(InterruptController::Interrupt::VBLANK);
+                }
+                scheduler_.schedule_at(SchedulerEvent::SCANLINE_END, deadline + cycles_per_scanline);
+                break;
+            }
+            default:
+                //Peripheral not emulated yet
+                break;
         }
     }
 
@@ -33,5 +376,16 @@ namespace mygbc{
     MemoryController& GBC::get_memory(){
         return memory_controller_;
     }
-}
 
+    /// @brief Grants access to the arena holding the emulated RAM regions.
+    /// @return Memory arena.
+    MemoryArena& GBC::get_memory_arena(){
+        return *memory_arena_;
+    }
+
+    /// @brief Grants access to the controller of IE and IF.
+    /// @return Interrupt controller.
+    InterruptController& GBC::get_interrupt_controller() noexcept{
+        return *interrupt_controller_;
+    }
+}
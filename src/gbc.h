@@ -2,30 +2,131 @@
 #define GBC_H
 
 #include <atomic>
+#include <chrono> //std::chrono::steady_clock
+#include <functional> //std::function
+#include <memory> //std::unique_ptr
 #include "components/memory_controller.h" //MemoryController
 #include "components/lr35902.h" //LR35902
+#include "components/scheduler.h" //Scheduler
+#include "components/interrupt_controller.h" //InterruptController
+#include "memory/memory_arena.h" //MemoryArena
 
 namespace mygbc{
 
     /// @brief Executes the functions of a GBC.
+    /// @details Driven either by main_loop or trough the cycle budgeted run_for_cycles, run_frames and run_until.
+    ///          Run methods stop at the first instruction boundary at or past their target and check the stop flag
+    ///          only between slices of run_slice_cycles. Emulated RAM regions live in a single MemoryArena, mounted by init.
+    ///          Time is kept by the Scheduler, the cpu runs uninterrupted up to the next event and the peripherals handle
+    ///          their events then. Halted cpu is fast-forwarded to the next event unless a interrupt is pending, so is a cpu
+    ///          spinning in a idle loop when idle loop skipping is on. Pending interrupts are checked before every dispatch
+    ///          trough the InterruptController and serviced while IME is set.
     class GBC{
-        
+
         public:
 
+        //Regions of the memory arena, in layout order
+        enum class MemoryRegion : uint8_t{
+            VIDEO_RAM = 0, //0x8000-0x9FFF
+            WORK_RAM = 1, //0xC000-0xDFFF, echoed at 0xE000-0xFDFF
+            OBJECT_ATTRIBUTE_MEMORY = 2, //0xFE00-0xFE9F
+            HIGH_PAGE = 3, //0xFF00-0xFFFF, I/O registers, high RAM and IE
+            COUNT = 4
+        };
+
+        //Ticks in a single scanline
+        static constexpr uint64_t cycles_per_scanline = 456;
+
+        //Scanlines in a single frame, the last 10 in vertical blank
+        static constexpr uint64_t scanlines_per_frame = 154;
+
+        //First scanline of the vertical blank
+        static constexpr uint8_t vblank_scanline = 144;
+
+        //Ticks in a single frame, 154 scanlines of 456 ticks
+        static constexpr uint64_t cycles_per_frame = cycles_per_scanline * scanlines_per_frame;
+
+        //Ticks run between checks of the stop flag and deadline
+        static constexpr uint64_t run_slice_cycles = 4096;
+
+        /// @brief Initializes the GBC, stop flag cleared.
+        GBC();
+
         /// @brief Inits the gbc internals.
-        /// @return 
+        /// @details Clears the stop flag and mounts the regions of the memory arena on the first call.
+        /// @return Status of the init.
         Status init();
 
         /// @brief Starts executing the GBC in its own thread.
         void run();
 
         /// @brief Stops the execution of the GBC
+        /// @details Run methods return at the next slice boundary.
         void stop();
 
         /// @brief Runs the main loop of the GBC.
         /// @return Exit status of the GBC.
         Status main_loop();
 
+        /// @brief Runs the GBC for the given amount of ticks.
+        /// @details Stops at the first instruction boundary at or past the budget, or at a slice boundary after stop.
+        /// @param cycles Tick budget
+        /// @return Status or Ticks elapsed.
+        StatusOr<uint64_t> run_for_cycles(const uint64_t cycles);
+
+        /// @brief Runs the GBC up to the given frame boundary.
+        /// @details Frames are counted from the first tick, a frame already in progress counts as the first one.
+        /// @param frames Frame boundaries to pass
+        /// @return Status or Ticks elapsed.
+        StatusOr<uint64_t> run_frames(const uint64_t frames);
+
+        /// @brief Runs the GBC until the predicate holds or the tick limit is reached.
+        /// @details Predicate is checked before the first and after every dispatch of the cpu.
+        /// @param predicate Condition to stop at
+        /// @param cycle_limit Tick budget
+        /// @return Status or Ticks elapsed.
+        StatusOr<uint64_t> run_until(const std::function<bool(const GBC&)>& predicate, const uint64_t cycle_limit);
+
+        /// @brief Runs the GBC until the wall clock deadline passes.
+        /// @details Deadline is checked at slice boundaries.
+        /// @param deadline Wall clock deadline
+        /// @return Status or Ticks elapsed.
+        StatusOr<uint64_t> run_until(const std::chrono::steady_clock::time_point deadline);
+
+        /// @brief Enables or disables skipping of idle loops.
+        /// @details Once a iteration of a idle loop completes without events, whole iterations up to the next event are
+        ///          skipped. Results match plain stepping. Never skipped while run_until checks a predicate.
+        /// @param enabled Skip idle loops?
+        void set_idle_loop_skipping(const bool enabled) noexcept;
+
+        /// @brief Is skipping of idle loops enabled?
+        /// @return Skip idle loops?
+        bool is_idle_loop_skipping() const noexcept;
+
+        /// @brief Enables or disables the lazy flags mode of the cpu.
+        /// @details Flags of ALU instructions are computed only when read. Results match eager flags, see LR35902::set_lazy_flags.
+        /// @param enabled Lazy flags mode on?
+        void set_lazy_flags(const bool enabled) noexcept;
+
+        /// @brief Is the lazy flags mode of the cpu enabled?
+        /// @return Lazy flags mode on?
+        bool is_lazy_flags() const noexcept;
+
+        /// @brief Forks the GBC from its current state.
+        /// @details Mounted memories are cloned trough MemoryController::clone, the memory arena is copied as a whole.
+        ///          Registers, backend and scheduler are copied, the clone rebuilds its instruction caches on use.
+        ///          Call from the thread running the GBC or while it is stopped.
+        /// @return Clone of the GBC or error Status if a memory can't be cloned.
+        StatusOr<std::unique_ptr<GBC>> clone();
+
+        /// @brief Returns the ticks elapsed since the GBC was created.
+        /// @return Elapsed ticks.
+        uint64_t get_elapsed_cycles() const noexcept;
+
+        /// @brief Grants access to the scheduler keeping the ticks and the peripheral events.
+        /// @return Scheduler.
+        Scheduler& get_scheduler() noexcept;
+
         /// @brief Grants access to the processing unit and its internals.
         /// @return Processing unit.
         LR35902& get_processing_unit();
@@ -34,10 +135,73 @@ namespace mygbc{
         /// @return Memory controller.
         MemoryController& get_memory();
 
+        /// @brief Grants access to the arena holding the emulated RAM regions.
+        /// @return Memory arena.
+        MemoryArena& get_memory_arena();
+
+        /// @brief Grants access to the controller of IE and IF.
+        /// @return Interrupt controller.
+        InterruptController& get_interrupt_controller() noexcept;
+
         private:
 
+        /// @brief Initializes the GBC over the given memory arena, stop flag cleared.
+        /// @param memory_arena Arena holding the emulated RAM regions
+        explicit GBC(std::shared_ptr<MemoryArena> memory_arena);
+
+        /// @brief Runs the cpu for the given budget without checking the stop flag.
+        /// @param cycles Tick budget
+        /// @param predicate Condition to stop at, checked after every dispatch if set
+        /// @param predicate_met Set when the predicate stopped the slice
+        /// @return Status or Ticks elapsed.
+        StatusOr<uint64_t> run_slice(const uint64_t cycles, const std::function<bool(const GBC&)>* predicate, bool& predicate_met);
+
+        /// @brief Dispatches the highest priority pending interrupt to its handler.
+        /// @details Interrupt is acknowledged in IF.
+        /// @return Status or Ticks of the dispatch.
+        StatusOr<uint8_t> service_interrupt();
+
+        /// @brief Follows the idle loop the cpu is spinning in, skipping its repeated iterations.
+        /// @param previous_pc Pc before the last dispatch
+        /// @param remaining_cycles Ticks left in the segment
+        /// @return Ticks skipped, whole iterations.
+        uint64_t skip_idle_loop(const uint16_t previous_pc, const uint64_t remaining_cycles);
+
+        /// @brief Handles the events due at the current tick.
+        /// @details Memory polled by a idle loop may change, its next iteration is run again.
+        void run_due_events();
+
+        /// @brief Handles a single event of the scheduler.
+        /// @param event Due event
+        /// @param deadline Tick the event was scheduled at
+        void handle_event(const SchedulerEvent event, const uint64_t deadline);
+
         std::atomic<bool> run_flag_;
 
+        //Ticks elapsed since creation and the pending peripheral events
+        Scheduler scheduler_;
+
+        //Emulated RAM regions, shared with the mounted views
+        std::shared_ptr<MemoryArena> memory_arena_;
+
+        //Are the regions of the arena mounted?
+        bool memory_arena_mounted_;
+
+        //IE and IF in the high page of the arena, shared with the mounted high page
+        std::shared_ptr<InterruptController> interrupt_controller_;
+
+        //Idle loop the cpu is spinning in
+        struct IdleLoop{
+            uint16_t start_address;
+            uint16_t last_address;
+            uint64_t arrival_cycle; //Tick the cpu last reached the start
+            bool tracking; //Cpu stayed in the loop since the arrival without events
+        };
+
+        //Skip idle loops?
+        bool idle_loop_skipping_;
+        IdleLoop idle_loop_;
+
         //Components of the GBC
         MemoryController memory_controller_;
         LR35902 processing_unit;
@@ -45,4 +209,4 @@ namespace mygbc{
 
 }
 
-#endif
\ No newline at end of file
+#endif
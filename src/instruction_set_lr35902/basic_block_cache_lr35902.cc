@@ -0,0 +1,116 @@
+#include "basic_block_cache_lr35902.h" //BasicBlockCacheLR35902
+#include "instruction_decoder_lr35902.h" //InstructionDecoderLR35902
+#include "instruction_set_lr35902.h" //InstructionSetLR35902
+#include <array> //std::array
+#include <string_view> //std::string_view
+
+namespace mygbc{
+
+    /// @brief Fetches the block starting at the given address, translating it if needed.
+    /// @param memory_controller Memory to translate from
+    /// @param address Address of the first instruction
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @return Current block or error status if the first instruction can't be decoded.
+    StatusOr<const BasicBlockLR35902*> BasicBlockCacheLR35902::get_block(MemoryController& memory_controller, const uint16_t address, PredecodeCacheLR35902& predecode_cache){
+        const uint64_t bank_tag = memory_controller.get_contents_tag(address);
+        auto cached_block = blocks_.find(address);
+        if(cached_block != blocks_.end() && is_current(cached_block->second, bank_tag, predecode_cache)){
+            return &(cached_block->second);
+        }
+        BasicBlockLR35902& block = (cached_block != blocks_.end()) ? cached_block->second : blocks_[address];
+        Status translate_status = translate(memory_controller, address, bank_tag, predecode_cache, block);
+        if(!translate_status.ok()){
+            return translate_status;
+        }
+        return &block;
+    }
+
+    /// @brief Checks that the memory the block was translated from is unchanged.
+    /// @param block Translated block
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @return Block is current?
+    bool BasicBlockCacheLR35902::is_current(const BasicBlockLR35902& block, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) noexcept{
+        return !block.operations.empty() && block.bank_tag == bank_tag &&
+               block.start_page_write_generation == predecode_cache.get_page_write_generation(block.start_address) &&
+               block.last_page_write_generation == predecode_cache.get_page_write_generation(block.last_address);
+    }
+
+    /// @brief Does the instruction end a basic block?
+    /// @details Control flow changes, interupt and power state changes and I/O accesses with a known address end the block.
+    /// @param decoded_instruction Decoded instruction
+    /// @return Ends block?
+    bool BasicBlockCacheLR35902::ends_basic_block(const DecodedInstructionLR35902& decoded_instruction) noexcept{
+        constexpr std::array<std::string_view, 11> block_ending_mnemonics{
+            "JP", "JR", "CALL", "RET", "RETI", "RST", "HALT", "STOP", "EI", "DI", "LDH"
+        };
+        const std::string_view short_mnemonic = InstructionSetLR35902::get_mnemonic(decoded_instruction.descriptor->opcode).short_mnemonic;
+        for(const std::string_view& block_ending_mnemonic : block_ending_mnemonics){
+            if(short_mnemonic == block_ending_mnemonic){
+                return true;
+            }
+        }
+        //LD [a16], A and LD A, [a16] into the I/O range
+        const uint16_t io_range_start = 0xFF00;
+        const uint16_t opcode = decoded_instruction.descriptor->opcode;
+        return (opcode == 0x00EA || opcode == 0x00FA) && decoded_instruction.unsigned_16brv() >= io_range_start;
+    }
+
+    /// @brief Drops every block.
+    void BasicBlockCacheLR35902::clear() noexcept{
+        blocks_.clear();
+    }
+
+    /// @brief Returns the number of translated blocks.
+    /// @return Blocks in the cache.
+    std::size_t BasicBlockCacheLR35902::get_block_count() const noexcept{
+        return blocks_.size();
+    }
+
+    /// @brief Translates the block starting at the given address.
+    /// @details Reuses the operation storage of the block.
+    /// @param memory_controller Memory to translate from
+    /// @param address Address of the first instruction
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @param block Block to fill
+    /// @return Status of the translation.
+    Status BasicBlockCacheLR35902::translate(MemoryController& memory_controller, const uint16_t address, const uint64_t bank_tag, PredecodeCacheLR35902& predecode_cache, BasicBlockLR35902& block){
+        block.operations.clear();
+        block.start_address = address;
+        block.last_address = address;
+        block.bank_tag = bank_tag;
+        uint16_t instruction_address = address;
+        while(block.operations.size() < BasicBlockLR35902::max_operations){
+            DecodedInstructionLR35902 decoded_instruction;
+            const DecodedInstructionLR35902* cached_instruction = predecode_cache.lookup(instruction_address, bank_tag);
+            if(cached_instruction != nullptr){
+                decoded_instruction = *cached_instruction;
+            }
+            else{
+                Status decode_status = InstructionDecoderLR35902::decode_operation(memory_controller, instruction_address, decoded_instruction);
+                if(!decode_status.ok()){
+                    if(block.operations.empty()){
+                        return decode_status;
+                    }
+                    //Let the interpreter path report it once reached
+                    break;
+                }
+                predecode_cache.store(instruction_address, bank_tag, decoded_instruction);
+            }
+            block.operations.push_back(ThreadedOperationLR35902{
+                InstructionExecutorLR35902::get_execute_function(decoded_instruction.descriptor->opcode), decoded_instruction
+            });
+            block.last_address = instruction_address + (decoded_instruction.descriptor->size_in_bytes - 1);
+            instruction_address += decoded_instruction.descriptor->size_in_bytes;
+            //Stay within the start page, write generations are tracked per page
+            if(ends_basic_block(decoded_instruction) || instruction_address / PredecodeCacheLR35902::page_size != address / PredecodeCacheLR35902::page_size){
+                break;
+            }
+        }
+        block.start_page_write_generation = predecode_cache.get_page_write_generation(block.start_address);
+        block.last_page_write_generation = predecode_cache.get_page_write_generation(block.last_address);
+        return Status::ok_status();
+    }
+
+}//namespace_mygbc
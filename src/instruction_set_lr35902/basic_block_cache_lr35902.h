@@ -0,0 +1,68 @@
+#ifndef BASIC_BLOCK_CACHE_LR35902_H
+#define BASIC_BLOCK_CACHE_LR35902_H
+
+#include <cstddef> //std::size_t
+#include <cstdint> //Fixed lenght variables
+#include <unordered_map> //std::unordered_map
+#include "basic_block_lr35902.h" //BasicBlockLR35902
+#include "predecode_cache_lr35902.h" //PredecodeCacheLR35902
+#include "../components/memory_controller.h" //MemoryController
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Translates and caches basic blocks by their start address.
+    /// @details Instructions are decoded trough the predecode cache. Blocks are checked against the contents tag and
+    ///          the write generations of the predecode cache, stale blocks are translated again in place.
+    class BasicBlockCacheLR35902{
+        public:
+
+        /// @brief Initializes a empty cache.
+        BasicBlockCacheLR35902() = default;
+
+        /// @brief Fetches the block starting at the given address, translating it if needed.
+        /// @param memory_controller Memory to translate from
+        /// @param address Address of the first instruction
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @return Current block or error status if the first instruction can't be decoded.
+        StatusOr<const BasicBlockLR35902*> get_block(MemoryController& memory_controller, const uint16_t address, PredecodeCacheLR35902& predecode_cache);
+
+        /// @brief Checks that the memory the block was translated from is unchanged.
+        /// @param block Translated block
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @return Block is current?
+        static bool is_current(const BasicBlockLR35902& block, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) noexcept;
+
+        /// @brief Does the instruction end a basic block?
+        /// @details Control flow changes, interupt and power state changes and I/O accesses with a known address end the block.
+        /// @param decoded_instruction Decoded instruction
+        /// @return Ends block?
+        static bool ends_basic_block(const DecodedInstructionLR35902& decoded_instruction) noexcept;
+
+        /// @brief Drops every block.
+        void clear() noexcept;
+
+        /// @brief Returns the number of translated blocks.
+        /// @return Blocks in the cache.
+        std::size_t get_block_count() const noexcept;
+
+        private:
+
+        /// @brief Translates the block starting at the given address.
+        /// @details Reuses the operation storage of the block.
+        /// @param memory_controller Memory to translate from
+        /// @param address Address of the first instruction
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @param block Block to fill
+        /// @return Status of the translation.
+        static Status translate(MemoryController& memory_controller, const uint16_t address, const uint64_t bank_tag, PredecodeCacheLR35902& predecode_cache, BasicBlockLR35902& block);
+
+        //Start address => block
+        std::unordered_map<uint16_t, BasicBlockLR35902> blocks_;
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef BASIC_BLOCK_LR35902_H
+#define BASIC_BLOCK_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <cstddef> //std::size_t
+#include <vector> //std::vector
+#include "decoded_instruction_lr35902.h" //DecodedInstructionLR35902
+#include "instruction_executor_lr35902.h" //InstructionExecutorLR35902
+
+namespace mygbc{
+
+    /// @brief Decoded instruction bound to its executor function.
+    struct ThreadedOperationLR35902{
+        //Executor of the instruction, resolved at translation
+        InstructionExecutorLR35902::ExecuteFunction execute;
+
+        //Decoded instruction passed to the executor
+        DecodedInstructionLR35902 decoded_instruction;
+    };
+
+    /// @brief Straight line run of instructions executed with a single dispatch.
+    /// @details Ends at a instruction that may change the control flow or touch I/O, or at the end of the start page.
+    ///          Valid as long as the contents tag and the write generations of the pages it covers stay the same.
+    struct BasicBlockLR35902{
+        //Most instructions translated into a single block
+        static constexpr std::size_t max_operations = 64;
+
+        //Address of the first instruction
+        uint16_t start_address;
+
+        //Address of the last byte of the last instruction
+        uint16_t last_address;
+
+        //Contents tag the block was translated from
+        uint64_t bank_tag;
+
+        //Write generations of the pages holding the first and the last byte
+        uint32_t start_page_write_generation;
+        uint32_t last_page_write_generation;
+
+        //Pre-bound instructions in execution order
+        std::vector<ThreadedOperationLR35902> operations;
+    };
+
+}//namespace_mygbc
+
+#endif
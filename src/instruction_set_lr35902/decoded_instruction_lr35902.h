@@ -0,0 +1,41 @@
+#ifndef DECODED_INSTRUCTION_LR35902_H
+#define DECODED_INSTRUCTION_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <type_traits> //std::is_trivially_copyable_v
+#include "instruction_descriptor_lr35902.h" //InstructionDescriptorLR35902
+
+namespace mygbc{
+
+    /// @brief Fixed size record of a decoded instruction.
+    /// @details Points into the constexpr instruction table and carries the read value, filled in by the decoder.
+    ///          Trivially copyable, decoding into it does not allocate.
+    struct DecodedInstructionLR35902{
+        //Descriptor of the instruction in the instruction table
+        const InstructionDescriptorLR35902* descriptor;
+
+        //Immidiate bytes following the opcode
+        uint16_t read_value;
+
+        /// @brief Helper to get the 8-bit unsiged read value.
+        /// @return returns read value as a 8-bit unsigned value.
+        constexpr uint8_t unsigned_8brv() const noexcept{ return static_cast<uint8_t>(read_value); }
+
+        /// @brief Helper to get the 8-bit siged read value.
+        /// @return returns read value as a 8-bit siged value.
+        constexpr int8_t signed_8brv() const noexcept{ return static_cast<int8_t>(read_value); }
+
+        /// @brief Helper to get the 16-bit unsigned read value.
+        /// @return returns read value as a 16-bit unsigned value.
+        constexpr uint16_t unsigned_16brv() const noexcept{ return read_value; }
+
+        /// @brief Helper to get the 16-bit signed read value.
+        /// @return returns read value as a 16-bit siged value.
+        constexpr int16_t signed_16brv() const noexcept{ return static_cast<int16_t>(read_value); }
+    };
+
+    static_assert(std::is_trivially_copyable_v<DecodedInstructionLR35902>);
+
+}//namespace_mygbc
+
+#endif
@@ -0,0 +1,194 @@
+#include "idle_loop_detector_lr35902.h" //IdleLoopDetectorLR35902
+#include "instruction_decoder_lr35902.h" //InstructionDecoderLR35902
+#include "instruction_set_lr35902.h" //InstructionSetLR35902
+#include <array> //std::array
+#include <string_view> //std::string_view
+
+namespace mygbc{
+
+    namespace{
+        //State read or written by a instruction, one bit per 8-bit register and per flag
+        constexpr uint16_t flag_z_unit = 0x0100;
+        constexpr uint16_t flag_n_unit = 0x0200;
+        constexpr uint16_t flag_h_unit = 0x0400;
+        constexpr uint16_t flag_c_unit = 0x0800;
+        constexpr uint16_t flag_units = flag_z_unit | flag_n_unit | flag_h_unit | flag_c_unit;
+
+        //Register id => units of the register, indexed by the id value
+        constexpr std::array<uint16_t, lr35902_register_id_count> register_units{
+            0x0000,
+            0x0001, flag_units, //A, F
+            0x0002, 0x0004, //B, C
+            0x0008, 0x0010, //D, E
+            0x0020, 0x0040, //H, L
+            0x0001 | flag_units, 0x0006, 0x0018, 0x0060, //AF, BC, DE, HL
+            0x0080, 0x0000 //SP, PC
+        };
+
+        //Instructions a idle loop may contain besides the closing jump
+        constexpr std::array<std::string_view, 7> idle_mnemonics{
+            "NOP", "LD", "LDH", "CP", "AND", "OR", "XOR"
+        };
+
+        /// @brief Returns the flags the instruction sets.
+        /// @param descriptor Descriptor of the instruction
+        /// @return Flag units written.
+        constexpr uint16_t get_flag_writes(const InstructionDescriptorLR35902& descriptor) noexcept{
+            return ((descriptor.effect_on_flag_z() != InstructionLR35902::FlagOperation::NO_CHANGE) ? flag_z_unit : 0) |
+                   ((descriptor.effect_on_flag_n() != InstructionLR35902::FlagOperation::NO_CHANGE) ? flag_n_unit : 0) |
+                   ((descriptor.effect_on_flag_h() != InstructionLR35902::FlagOperation::NO_CHANGE) ? flag_h_unit : 0) |
+                   ((descriptor.effect_on_flag_c() != InstructionLR35902::FlagOperation::NO_CHANGE) ? flag_c_unit : 0);
+        }
+
+        /// @brief Returns the flag read by the condition of the instruction.
+        /// @param descriptor Descriptor of the instruction
+        /// @return Flag unit read.
+        constexpr uint16_t get_condition_reads(const InstructionDescriptorLR35902& descriptor) noexcept{
+            switch(descriptor.execution_condition){
+                case InstructionLR35902::ExecutionCondition::ZERO_SET:
+                case InstructionLR35902::ExecutionCondition::ZERO_NOT_SET:
+                    return flag_z_unit;
+                case InstructionLR35902::ExecutionCondition::CARRY_SET:
+                case InstructionLR35902::ExecutionCondition::CARRY_NOT_SET:
+                    return flag_c_unit;
+                default:
+                    return 0;
+            }
+        }
+    }
+
+    /// @brief Is the code starting at the given address a idle loop?
+    /// @param memory_controller Memory to decode from
+    /// @param address Address of the first instruction
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @param last_address Set to the address of the last byte of the loop if idle
+    /// @return Idle loop?
+    bool IdleLoopDetectorLR35902::find_idle_loop(MemoryController& memory_controller, const uint16_t address, PredecodeCacheLR35902& predecode_cache, uint16_t& last_address){
+        const uint64_t bank_tag = memory_controller.get_contents_tag(address);
+        auto cached_analysis = analyses_.find(address);
+        if(cached_analysis == analyses_.end() || cached_analysis->second.bank_tag != bank_tag ||
+           cached_analysis->second.start_page_write_generation != predecode_cache.get_page_write_generation(address) ||
+           cached_analysis->second.last_page_write_generation != predecode_cache.get_page_write_generation(cached_analysis->second.last_address)){
+            LoopAnalysis& analysis = (cached_analysis != analyses_.end()) ? cached_analysis->second : analyses_[address];
+            analyse(memory_controller, address, bank_tag, predecode_cache, analysis);
+            last_address = analysis.last_address;
+            return analysis.idle;
+        }
+        last_address = cached_analysis->second.last_address;
+        return cached_analysis->second.idle;
+    }
+
+    /// @brief Drops every result.
+    void IdleLoopDetectorLR35902::clear() noexcept{
+        analyses_.clear();
+    }
+
+    /// @brief Analyses the code starting at the given address.
+    /// @param memory_controller Memory to decode from
+    /// @param address Address of the first instruction
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @param analysis Analysis to fill
+    void IdleLoopDetectorLR35902::analyse(MemoryController& memory_controller, const uint16_t address, const uint64_t bank_tag, PredecodeCacheLR35902& predecode_cache, LoopAnalysis& analysis){
+        analysis.last_address = address;
+        analysis.idle = false;
+        analysis.bank_tag = bank_tag;
+        //Units read and written by each instruction, in loop order
+        std::array<uint16_t, max_loop_instructions> reads{};
+        std::array<uint16_t, max_loop_instructions> writes{};
+        std::size_t instruction_count = 0;
+        bool closed = false;
+        uint16_t instruction_address = address;
+        while(instruction_count < max_loop_instructions && !closed){
+            DecodedInstructionLR35902 decoded_instruction;
+            //Loop may continue on the next page, instructions are tagged like the interpreter tags them
+            const uint64_t instruction_tag = memory_controller.get_contents_tag(instruction_address);
+            const DecodedInstructionLR35902* cached_instruction = predecode_cache.lookup(instruction_address, instruction_tag);
+            if(cached_instruction != nullptr){
+                decoded_instruction = *cached_instruction;
+            }
+            else if(InstructionDecoderLR35902::decode_operation(memory_controller, instruction_address, decoded_instruction).ok()){
+                predecode_cache.store(instruction_address, instruction_tag, decoded_instruction);
+            }
+            else{
+                break;
+            }
+            const InstructionDescriptorLR35902& descriptor = *decoded_instruction.descriptor;
+            const std::string_view short_mnemonic = InstructionSetLR35902::get_mnemonic(descriptor.opcode).short_mnemonic;
+            const uint16_t next_address = instruction_address + descriptor.size_in_bytes;
+            analysis.last_address = next_address - 1;
+            instruction_address = next_address;
+            if(short_mnemonic == "JR" || short_mnemonic == "JP"){
+                //Only a jump back to the start closes the loop, JP HL has no known target
+                const uint16_t target = (short_mnemonic == "JR") ? static_cast<uint16_t>(next_address + decoded_instruction.signed_8brv()) : decoded_instruction.unsigned_16brv();
+                if(!descriptor.has_read_value() || target != address){
+                    break;
+                }
+                reads[instruction_count] = get_condition_reads(descriptor);
+                writes[instruction_count++] = 0;
+                closed = true;
+                continue;
+            }
+            bool allowed = false;
+            for(const std::string_view& idle_mnemonic : idle_mnemonics){
+                allowed = allowed || short_mnemonic == idle_mnemonic;
+            }
+            if(!allowed){
+                break;
+            }
+            uint16_t instruction_reads = 0;
+            uint16_t instruction_writes = get_flag_writes(descriptor);
+            bool writes_memory = false;
+            const bool loads = short_mnemonic == "LD" || short_mnemonic == "LDH";
+            for(const InstructionDescriptorLR35902::OperandRegister& operand : descriptor.operand_registers){
+                if(!operand.is_present()){
+                    continue;
+                }
+                //Post increments and decrements change the address register every iteration
+                if(operand.increment() || operand.decrement()){
+                    writes_memory = true;
+                }
+                const uint16_t units = register_units[static_cast<uint8_t>(operand.id)];
+                if(loads && operand.operand_position() == 0){
+                    //Destination of a load, a store if used as address
+                    writes_memory = writes_memory || operand.address_mode();
+                    instruction_writes |= units;
+                }
+                else{
+                    instruction_reads |= units;
+                }
+            }
+            //Loads without a destination register store into the read address
+            if(loads && (instruction_writes & ~flag_units) == 0){
+                writes_memory = true;
+            }
+            if(short_mnemonic == "CP" || short_mnemonic == "AND" || short_mnemonic == "OR" || short_mnemonic == "XOR"){
+                instruction_reads |= register_units[static_cast<uint8_t>(LR35902RegisterId::A)];
+                if(short_mnemonic != "CP"){
+                    instruction_writes |= register_units[static_cast<uint8_t>(LR35902RegisterId::A)];
+                }
+            }
+            if(writes_memory){
+                break;
+            }
+            reads[instruction_count] = instruction_reads;
+            writes[instruction_count++] = instruction_writes;
+        }
+        if(closed){
+            //Reads must not see values of the previous iteration
+            uint16_t loop_writes = 0;
+            for(std::size_t index = 0; index < instruction_count; ++index){
+                loop_writes |= writes[index];
+            }
+            uint16_t iteration_writes = 0;
+            analysis.idle = true;
+            for(std::size_t index = 0; index < instruction_count; ++index){
+                analysis.idle = analysis.idle && (reads[index] & loop_writes & ~iteration_writes) == 0;
+                iteration_writes |= writes[index];
+            }
+        }
+        analysis.start_page_write_generation = predecode_cache.get_page_write_generation(address);
+        analysis.last_page_write_generation = predecode_cache.get_page_write_generation(analysis.last_address);
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,68 @@
+#ifndef IDLE_LOOP_DETECTOR_LR35902_H
+#define IDLE_LOOP_DETECTOR_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <cstddef> //std::size_t
+#include <unordered_map> //std::unordered_map
+#include "decoded_instruction_lr35902.h" //DecodedInstructionLR35902
+#include "predecode_cache_lr35902.h" //PredecodeCacheLR35902
+#include "../components/memory_controller.h" //MemoryController
+
+namespace mygbc{
+
+    /// @brief Recognizes side-effect-free polling loops and caches the result by start address.
+    /// @details A idle loop is a straight line of NOPs, loads into registers, compares and logic operations, closed by a
+    ///          jump back to its start. Bit tests are not accepted, BIT has no executor yet. It never writes memory, and every register or flag it reads is either set earlier in
+    ///          the same iteration or never set by the loop. Once a iteration completes, the following ones repeat it until
+    ///          memory changes. Results are checked against the contents tag and write generations like basic blocks.
+    class IdleLoopDetectorLR35902{
+        public:
+
+        //Most instructions in a idle loop
+        static constexpr std::size_t max_loop_instructions = 8;
+
+        /// @brief Initializes a empty cache.
+        IdleLoopDetectorLR35902() = default;
+
+        /// @brief Is the code starting at the given address a idle loop?
+        /// @param memory_controller Memory to decode from
+        /// @param address Address of the first instruction
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @param last_address Set to the address of the last byte of the loop if idle
+        /// @return Idle loop?
+        bool find_idle_loop(MemoryController& memory_controller, const uint16_t address, PredecodeCacheLR35902& predecode_cache, uint16_t& last_address);
+
+        /// @brief Drops every result.
+        void clear() noexcept;
+
+        private:
+
+        //Analysis of the code at a start address
+        struct LoopAnalysis{
+            //Address of the last byte of the analysed code
+            uint16_t last_address;
+
+            //Is the code a idle loop?
+            bool idle;
+
+            //Contents tag and write generations of the first and last page the analysis was made with
+            uint64_t bank_tag;
+            uint32_t start_page_write_generation;
+            uint32_t last_page_write_generation;
+        };
+
+        /// @brief Analyses the code starting at the given address.
+        /// @param memory_controller Memory to decode from
+        /// @param address Address of the first instruction
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @param analysis Analysis to fill
+        static void analyse(MemoryController& memory_controller, const uint16_t address, const uint64_t bank_tag, PredecodeCacheLR35902& predecode_cache, LoopAnalysis& analysis);
+
+        //Start address => analysis
+        std::unordered_map<uint16_t, LoopAnalysis> analyses_;
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -9,6 +9,7 @@
 #include "../components/memory_controller.h" //MemoryController
 #include "../util/status/status_or.h" //StatusOr
 #include "instruction_set_lr35902.h" //InstructionSetLR35902
+#include "decoded_instruction_lr35902.h" //DecodedInstructionLR35902
 
 namespace mygbc{
 
@@ -43,8 +44,67 @@ namespace mygbc{
                 return instruction_fetch.status();
             }
 
+            /// @brief Tries to decode the instruction from the given address into the caller owned record.
+            /// @details Allocation free decode used by the cpu. If the given address is not valid instruction returns a status.
+            /// @tparam T typename implementing the SystemMemoryInterfaceConcept concept.
+            /// @param memory AddressableMemory derived container
+            /// @param address Address of the instruction
+            /// @param decoded_instruction Record filled with the decoded instruction
+            /// @return Status of the decode
+            template <typename T>
+            requires (std::is_same_v<T, MemoryController> || SystemMemoryInterfaceConcept<T>)
+            static Status decode_operation(T& memory, const uint16_t address, DecodedInstructionLR35902& decoded_instruction) noexcept{
+                StatusOr<uint16_t> opcode_fetch = get_opcode_from_address(memory, address);
+                if(!opcode_fetch.ok()){
+                    return opcode_fetch.status();
+                }
+                const InstructionDescriptorLR35902& descriptor = InstructionSetLR35902::get_descriptor(opcode_fetch.value());
+                if(!descriptor.is_valid()){
+                    return Status::invalid_opcode_error(
+                        "Read value was not a valid opcode! Read value: " + std::to_string(opcode_fetch.value())
+                    );
+                }
+                decoded_instruction.descriptor = &descriptor;
+                decoded_instruction.read_value = 0;
+                if(descriptor.has_read_value()){
+                    //Determine the address of read by determining the size of the opcode (total size - value size)
+                    const uint16_t value_address = (address + (descriptor.size_in_bytes - descriptor.read_value_size_in_bytes));
+                    StatusOr<uint16_t> value_fetch = get_value_from_address(memory, value_address, descriptor.read_value_size_in_bytes);
+                    if(!value_fetch.ok()){
+                        return value_fetch.status();
+                    }
+                    decoded_instruction.read_value = value_fetch.value();
+                }
+                return Status::ok_status();
+            }
+
             private:
 
+            /// @brief Fetches the opcode present at the given address.
+            /// @details Reads the second byte only for 0xCB prefixed opcodes. If memory fetches fail returns error state.
+            /// @tparam T T typename implementing the SystemMemoryInterfaceConcept concept.
+            /// @param memory AddressableMemory derived container.
+            /// @param address Address of the instruction.
+            /// @return Opcode or error status.
+            template <typename T>
+            requires (std::is_same_v<T, MemoryController> || SystemMemoryInterfaceConcept<T>)
+            static StatusOr<uint16_t> get_opcode_from_address(T& memory, const uint16_t address) noexcept{
+                StatusOr<uint8_t> non_prefixed_opcode_fetch = memory.get_byte(address);
+                if(!non_prefixed_opcode_fetch.ok()){
+                    return non_prefixed_opcode_fetch.status();
+                }
+                //If first byte is 0xCB, we need second byte to determine the opcode.
+                const uint8_t two_byte_opcode_prefix_ = 0xCB;
+                if(non_prefixed_opcode_fetch.value() == two_byte_opcode_prefix_){
+                    StatusOr<uint8_t> prefixed_opcode_fetch = memory.get_byte(address + 1);
+                    if(!prefixed_opcode_fetch.ok()){
+                        return prefixed_opcode_fetch.status();
+                    }
+                    return static_cast<uint16_t>((two_byte_opcode_prefix_ << 8) | prefixed_opcode_fetch.value());
+                }
+                return static_cast<uint16_t>(non_prefixed_opcode_fetch.value());
+            }
+
             /// @brief Fetches the instruction info matching to the opcode present at the given address.
             /// @details If memory fetches or opcode at the address is invalid returns error state.
             /// @tparam T T typename implementing the SystemMemoryInterfaceConcept concept.
@@ -54,23 +114,12 @@ namespace mygbc{
             template <typename T>
             requires (std::is_same_v<T, MemoryController> || SystemMemoryInterfaceConcept<T>)
             static StatusOr<InstructionLR35902> get_instruction_from_address(T& memory, const uint16_t address, const InstructionSetLR35902& instruction_set) noexcept{
-                StatusOr<uint8_t> non_prefixed_opcode_fetch = memory.get_byte(address);
-                if(non_prefixed_opcode_fetch.ok()){
-                    uint16_t opcode = static_cast<uint16_t>(non_prefixed_opcode_fetch.value());
-                    //If first byte is 0xCB, we need second byte to determine the opcode.
-                    const uint8_t two_byte_opcode_prefix_ = 0xCB;
-                    if(opcode == two_byte_opcode_prefix_){
-                        StatusOr<uint16_t> prefixed_opcode_fetch = memory.get_word(address);
-                        //If we could not read the word, return the status of the read
-                        if(!prefixed_opcode_fetch.ok()){
-                            return prefixed_opcode_fetch.status();
-                        }
-                        opcode = prefixed_opcode_fetch.value();
-                    }
+                StatusOr<uint16_t> opcode_fetch = get_opcode_from_address(memory, address);
+                if(opcode_fetch.ok()){
                     //Fetch details from the instruction set
-                    return instruction_set.get_by_opcode(opcode);
+                    return instruction_set.get_by_opcode(opcode_fetch.value());
                 }
-                return non_prefixed_opcode_fetch.status();
+                return opcode_fetch.status();
             }
 
             /// @brief Fetches the value present at the given address.
@@ -0,0 +1,196 @@
+#ifndef INSTRUCTION_DESCRIPTOR_LR35902_H
+#define INSTRUCTION_DESCRIPTOR_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <array> //std::array
+#include <string_view> //std::string_view
+#include <type_traits> //std::is_trivially_copyable_v
+#include "instruction_lr35902.h" //InstructionLR35902
+#include "../components/lr35902_register_id.h" //LR35902RegisterId
+
+namespace mygbc{
+
+    /// @brief Compact, trivially copyable description of a single LR35902 instruction.
+    /// @details Holds the same information as InstructionLR35902 minus the mnemonics and the read value.
+    ///          Lives in the constexpr instruction table, mnemonics live in InstructionMnemonicLR35902.
+    struct InstructionDescriptorLR35902{
+
+        //Registers available as operands
+        using RegisterId = LR35902RegisterId;
+
+        //Register operand. Attributes packed into bits
+        struct OperandRegister{
+            RegisterId id; //Register id, NONE if operand is not present
+            uint8_t attributes; //See the attribute bits
+
+            //Attribute bits
+            static constexpr uint8_t position_bit = 0x01; //Order of appearance
+            static constexpr uint8_t address_mode_bit = 0x02; // Use as address
+            static constexpr uint8_t decrement_bit = 0x04; // Decremented after value is used
+            static constexpr uint8_t increment_bit = 0x08; // Incremented after value is used
+            static constexpr uint8_t value_operand_modified_bit = 0x10; // -/+ given value operand, before use
+
+            /// @brief Is the operand present?
+            /// @return Operand present?
+            constexpr bool is_present() const noexcept{ return id != RegisterId::NONE; }
+
+            /// @brief Position of the operand in the asm instruction.
+            /// @return Order of appearance.
+            constexpr uint8_t operand_position() const noexcept{ return attributes & position_bit; }
+
+            /// @brief Is the register used as a address?
+            /// @return Use as address?
+            constexpr bool address_mode() const noexcept{ return attributes & address_mode_bit; }
+
+            /// @brief Is the register decremented after the value is used?
+            /// @return Decremented after use?
+            constexpr bool decrement() const noexcept{ return attributes & decrement_bit; }
+
+            /// @brief Is the register incremented after the value is used?
+            /// @return Incremented after use?
+            constexpr bool increment() const noexcept{ return attributes & increment_bit; }
+
+            /// @brief Is the register value modified by the read value before use?
+            /// @return Modified by read value?
+            constexpr bool value_operand_modified() const noexcept{ return attributes & value_operand_modified_bit; }
+        };
+
+        //Constant value operand. Attributes packed into bits
+        struct OperandConstValue{
+            uint8_t value; //Value of operand
+            uint8_t attributes; //See the attribute bits
+
+            //Attribute bits
+            static constexpr uint8_t position_bit = 0x01; //Order of appearance
+            static constexpr uint8_t present_bit = 0x80; //Operand is present
+
+            /// @brief Is the operand present?
+            /// @return Operand present?
+            constexpr bool is_present() const noexcept{ return attributes & present_bit; }
+
+            /// @brief Position of the operand in the asm instruction.
+            /// @return Order of appearance.
+            constexpr uint8_t operand_position() const noexcept{ return attributes & position_bit; }
+        };
+
+        //0xCB start = 16bit, otherwise 8 bit opcode.
+        uint16_t opcode;
+
+        //Size in bytes, 0 for illegal opcodes
+        uint8_t size_in_bytes;
+
+        //Immidiate bytes, filled in by decoder
+        uint8_t read_value_size_in_bytes;
+        uint8_t read_value_operand_position;
+        InstructionLR35902::OperandValueInterpHint read_value_operand_interp_hint;
+
+        //Condition of the execution
+        InstructionLR35902::ExecutionCondition execution_condition;
+
+        //Effects on flags, two bits each. Z:7-6, N:5-4, H:3-2, C:1-0
+        uint8_t flag_effects;
+
+        //Register and constant operands
+        std::array<OperandRegister, 2> operand_registers;
+        OperandConstValue operand_const_value;
+
+        //Execute cycles for executing and skipping the instruction, skip cost 0 when not conditional
+        std::array<uint8_t, 2> t_cycles_costs;
+
+        /// @brief Is the descriptor a legal instruction?
+        /// @return Legal instruction?
+        constexpr bool is_valid() const noexcept{ return size_in_bytes != 0; }
+
+        /// @brief Does the instruction have a read value following the opcode?
+        /// @return Has read value?
+        constexpr bool has_read_value() const noexcept{ return read_value_size_in_bytes != 0; }
+
+        /// @brief Effect of the instruction on the zero flag.
+        /// @return Flag operation for Z.
+        constexpr InstructionLR35902::FlagOperation effect_on_flag_z() const noexcept{ return get_flag_effect(6); }
+
+        /// @brief Effect of the instruction on the subtraction flag.
+        /// @return Flag operation for N.
+        constexpr InstructionLR35902::FlagOperation effect_on_flag_n() const noexcept{ return get_flag_effect(4); }
+
+        /// @brief Effect of the instruction on the half carry flag.
+        /// @return Flag operation for H.
+        constexpr InstructionLR35902::FlagOperation effect_on_flag_h() const noexcept{ return get_flag_effect(2); }
+
+        /// @brief Effect of the instruction on the carry flag.
+        /// @return Flag operation for C.
+        constexpr InstructionLR35902::FlagOperation effect_on_flag_c() const noexcept{ return get_flag_effect(0); }
+
+        /// @brief Builds a register operand.
+        /// @param reg_id Id of the register
+        /// @param op_pos_asm Position of the operand (Assembly)
+        /// @param is_address Value is to be treated as address
+        /// @param dec_post_op Decrement register after operation is done
+        /// @param inc_post_op Increment register after operation is done
+        /// @param val_op_mod Value of register is modified by the read value before op
+        /// @return Packed register operand.
+        static constexpr OperandRegister register_operand(const RegisterId reg_id, const uint8_t op_pos_asm, const bool is_address, const bool dec_post_op, const bool inc_post_op, const bool val_op_mod) noexcept{
+            return OperandRegister{
+                reg_id,
+                static_cast<uint8_t>(
+                    (op_pos_asm ? OperandRegister::position_bit : 0) |
+                    (is_address ? OperandRegister::address_mode_bit : 0) |
+                    (dec_post_op ? OperandRegister::decrement_bit : 0) |
+                    (inc_post_op ? OperandRegister::increment_bit : 0) |
+                    (val_op_mod ? OperandRegister::value_operand_modified_bit : 0)
+                )
+            };
+        }
+
+        /// @brief Builds a constant operand.
+        /// @param val Value of the constant operand
+        /// @param op_pos_asm Position of the operand in the asm instruction
+        /// @return Packed constant operand.
+        static constexpr OperandConstValue const_operand(const uint8_t val, const uint8_t op_pos_asm) noexcept{
+            return OperandConstValue{val, static_cast<uint8_t>(OperandConstValue::present_bit | (op_pos_asm ? OperandConstValue::position_bit : 0))};
+        }
+
+        /// @brief Packs the flag effects into a single byte.
+        /// @param eff_flag_z Effect on Zero flag
+        /// @param eff_flag_n Effect on Subtract flag
+        /// @param eff_flag_h Effect on Half carry flag
+        /// @param eff_flag_c Effect on Carry flag
+        /// @return Packed flag effects.
+        static constexpr uint8_t flag_effects_of(const InstructionLR35902::FlagOperation eff_flag_z, const InstructionLR35902::FlagOperation eff_flag_n, const InstructionLR35902::FlagOperation eff_flag_h, const InstructionLR35902::FlagOperation eff_flag_c) noexcept{
+            return static_cast<uint8_t>(
+                (static_cast<uint8_t>(eff_flag_z) << 6) | (static_cast<uint8_t>(eff_flag_n) << 4) |
+                (static_cast<uint8_t>(eff_flag_h) << 2) | static_cast<uint8_t>(eff_flag_c)
+            );
+        }
+
+        /// @brief Returns the assembly name of the register.
+        /// @param reg_id Id of the register
+        /// @return Name of the register, empty for NONE.
+        static constexpr std::string_view get_register_name(const RegisterId reg_id) noexcept{
+            return lr35902_register_names[static_cast<uint8_t>(reg_id)];
+        }
+
+        private:
+
+        /// @brief Unpacks the flag effect at the given bit offset.
+        /// @param offset Bit offset of the flag effect
+        /// @return Flag operation.
+        constexpr InstructionLR35902::FlagOperation get_flag_effect(const uint8_t offset) const noexcept{
+            return static_cast<InstructionLR35902::FlagOperation>((flag_effects >> offset) & 0x03);
+        }
+    };
+
+    //Descriptors are copied around freely and kept in read only data
+    static_assert(std::is_trivially_copyable_v<InstructionDescriptorLR35902>);
+    static_assert(sizeof(InstructionDescriptorLR35902) <= 16);
+
+    /// @brief Assembly mnemonics of a instruction. Used only by disassembly and logging.
+    struct InstructionMnemonicLR35902{
+        std::string_view short_mnemonic;
+        std::string_view full_mnemonic;
+        std::string_view replace_mnenomic;
+    };
+
+}//namespace_mygbc
+
+#endif
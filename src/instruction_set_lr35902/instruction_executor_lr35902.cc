@@ -1,12 +1,16 @@
 #include "../util/io/log_message.h" //LOG
 #include "instruction_executor_lr35902.h" //InstructionExecutorLR35902
+#include <unordered_map> //std::unordered_map
+#include <string_view> //std::string_view
+#include <string> //std::string
+#include "instruction_set_lr35902.h" //InstructionSetLR35902
 
 namespace mygbc{
 
-    /// @brief Initializes the executor and fetches the jump table.
-    /// @details Fetches the jump table to avoid link issues.
+    /// @brief Initializes the executor and fetches the dispatch table.
+    /// @details Dispatch table is shared by all executors and built only once.
     InstructionExecutorLR35902::InstructionExecutorLR35902()
-    :jump_map_(std::move(get_jump_table())){
+    :dispatch_table_(get_dispatch_table()){
     }
 
     /// @brief Executes the instruction if valid instruction. 
@@ -14,67 +18,233 @@ namespace mygbc{
     /// @param register_file Registers of the cpu.
     /// @param memory_controller Memory controller.
     /// @return Execution time in ticks or Status if can't execute. 
-    StatusOr<uint8_t> InstructionExecutorLR35902::execute_instruction(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller) const{
-        //Check executor table
-        if(jump_map_.find(instruction.short_mnemonic) != jump_map_.end()){
-            return jump_map_.at(instruction.short_mnemonic)(instruction, register_file, memory_controller);
-        }
-        return Status::invalid_index_error(
-            "Could not find a executor for instruction " + instruction.full_mnemonic
-        );
+    StatusOr<uint8_t> InstructionExecutorLR35902::execute_instruction(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller) const{
+        //Opcodes without executor land in exec_invalid
+        return dispatch_table_[get_dispatch_index(instruction.descriptor->opcode)](instruction, register_file, memory_controller);
+    }
+
+    /// @brief Returns the executor function of the opcode.
+    /// @details Used to pre-bind executors ahead of execution. Opcodes without executor return the error slot.
+    /// @param opcode Opcode 1-2 bytes long
+    /// @return Executor function of the opcode.
+    InstructionExecutorLR35902::ExecuteFunction InstructionExecutorLR35902::get_execute_function(const uint16_t opcode){
+        return get_dispatch_table()[get_dispatch_index(opcode)];
+    }
+
+    /// @brief Returns the dispatch table shared by all executors.
+    /// @details Table is built on first use and stays alive for the lifetime of the program.
+    /// @return Dispatch table for instruction execution functions.
+    const InstructionExecutorLR35902::DispatchTable& InstructionExecutorLR35902::get_dispatch_table(){
+        static const DispatchTable dispatch_table = build_dispatch_table();
+        return dispatch_table;
     }
 
-    /// @brief Returns a built jump table containing executor functions for instructions
-    /// @details Each function is keyd by the short mnemonic of the instruction
-    /// @return jump table for instruction execution functions
-    std::unordered_map<std::string, std::function<StatusOr<uint8_t>(const InstructionLR35902&, LR35902RegisterFile&, MemoryController&)>> InstructionExecutorLR35902::get_jump_table() const{
-        //Jump map for executes
-        return std::unordered_map<std::string, std::function<StatusOr<uint8_t>(const InstructionLR35902&, LR35902RegisterFile&, MemoryController&)>>{
+    /// @brief Builds the dispatch table containing executor functions for instructions
+    /// @details Each function is indexed by the opcode of the instruction. Opcodes without a executor point at exec_invalid.
+    /// @return Dispatch table for instruction execution functions
+    InstructionExecutorLR35902::DispatchTable InstructionExecutorLR35902::build_dispatch_table(){
+        //Mnemonic => Execute function, only used while building the table
+        const std::unordered_map<std::string_view, ExecuteFunction> mnemonic_executors{
+            {"NOP", InstructionExecutorLR35902::exec_nop}, //NOP No operation.
+            {"LD", InstructionExecutorLR35902::exec_ld}, //LD 8-bit and 16-bit loads.
+            {"LDH", InstructionExecutorLR35902::exec_ld}, //LDH loads from and to the high page.
             {"JP", InstructionExecutorLR35902::exec_jp}, //JP Absolute jump. Conditional. HL or Ruint16.
             {"JR", InstructionExecutorLR35902::exec_jr}, //JR Relative jump. Conditional. Rint8.
             {"CALL", InstructionExecutorLR35902::exec_call}, //CALL subroutine jump. Conditional. Ruint16.
             {"RET", InstructionExecutorLR35902::exec_ret}, //RET subroutine return. Conditional.
-            {"RETI", InstructionExecutorLR35902::exec_reti} //RETI subroutine return, enable interupts.
-
+            {"RETI", InstructionExecutorLR35902::exec_reti}, //RETI subroutine return, enable interupts.
+            {"HALT", InstructionExecutorLR35902::exec_halt}, //HALT wait for interupt.
+            {"STOP", InstructionExecutorLR35902::exec_halt}, //STOP wait for interupt, no joypad to wake it.
+            {"EI", InstructionExecutorLR35902::exec_ei}, //EI enable interupts after the next instruction.
+            {"DI", InstructionExecutorLR35902::exec_di}, //DI disable interupts.
+            {"ADD", InstructionExecutorLR35902::exec_add}, //ADD 8-bit to A, 16-bit to HL or SP.
+            {"ADC", InstructionExecutorLR35902::exec_adc}, //ADC 8-bit add with carry to A.
+            {"SUB", InstructionExecutorLR35902::exec_sub}, //SUB 8-bit subtract from A.
+            {"SBC", InstructionExecutorLR35902::exec_sbc}, //SBC 8-bit subtract with carry from A.
+            {"AND", InstructionExecutorLR35902::exec_and}, //AND bitwise and into A.
+            {"XOR", InstructionExecutorLR35902::exec_xor}, //XOR bitwise exclusive or into A.
+            {"OR", InstructionExecutorLR35902::exec_or}, //OR bitwise or into A.
+            {"CP", InstructionExecutorLR35902::exec_cp}, //CP compare with A.
+            {"INC", InstructionExecutorLR35902::exec_inc}, //INC 8-bit or 16-bit increment.
+            {"DEC", InstructionExecutorLR35902::exec_dec}, //DEC 8-bit or 16-bit decrement.
+            {"DAA", InstructionExecutorLR35902::exec_daa}, //DAA decimal adjust A.
+            {"CPL", InstructionExecutorLR35902::exec_cpl}, //CPL complement A.
+            {"SCF", InstructionExecutorLR35902::exec_scf}, //SCF set carry.
+            {"CCF", InstructionExecutorLR35902::exec_ccf}, //CCF complement carry.
+            {"RLCA", InstructionExecutorLR35902::exec_rotate_accumulator<ShiftOperation::RLC>}, //RLCA rotate A left.
+            {"RRCA", InstructionExecutorLR35902::exec_rotate_accumulator<ShiftOperation::RRC>}, //RRCA rotate A right.
+            {"RLA", InstructionExecutorLR35902::exec_rotate_accumulator<ShiftOperation::RL>}, //RLA rotate A left trough carry.
+            {"RRA", InstructionExecutorLR35902::exec_rotate_accumulator<ShiftOperation::RR>}, //RRA rotate A right trough carry.
+            {"RLC", InstructionExecutorLR35902::exec_shift<ShiftOperation::RLC>}, //RLC rotate left.
+            {"RRC", InstructionExecutorLR35902::exec_shift<ShiftOperation::RRC>}, //RRC rotate right.
+            {"RL", InstructionExecutorLR35902::exec_shift<ShiftOperation::RL>}, //RL rotate left trough carry.
+            {"RR", InstructionExecutorLR35902::exec_shift<ShiftOperation::RR>}, //RR rotate right trough carry.
+            {"SLA", InstructionExecutorLR35902::exec_shift<ShiftOperation::SLA>}, //SLA arithmetic shift left.
+            {"SRA", InstructionExecutorLR35902::exec_shift<ShiftOperation::SRA>}, //SRA arithmetic shift right.
+            {"SRL", InstructionExecutorLR35902::exec_shift<ShiftOperation::SRL>}, //SRL logical shift right.
+            {"SWAP", InstructionExecutorLR35902::exec_shift<ShiftOperation::SWAP>} //SWAP swap nibbles.
         };
+        DispatchTable dispatch_table;
+        dispatch_table.fill(InstructionExecutorLR35902::exec_invalid);
+        //Resolve each opcode of the instruction table to its executor
+        for(std::size_t index = 0; index < dispatch_table_size; ++index){
+            if(InstructionTableLR35902::descriptors[index].is_valid()){
+                auto executor = mnemonic_executors.find(InstructionTableLR35902::mnemonics[index].short_mnemonic);
+                if(executor != mnemonic_executors.end()){
+                    dispatch_table[index] = executor->second;
+                }
+            }
+        }
+        return dispatch_table;
+    }
+
+    /// @brief Executor for opcodes with no executor.
+    /// @details Single error slot for all of the opcodes not supported by the executor.
+    /// @param instruction Unsupported instruction
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Status describing the missing executor.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_invalid(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        return Status::invalid_index_error(
+            "Could not find a executor for instruction " + std::string(InstructionSetLR35902::get_mnemonic(instruction.descriptor->opcode).full_mnemonic)
+        );
     }
 
     /// @brief Checks the common flag conditionals: Z, C, NZ, NC
     /// @param instruction Instruction info
     /// @param register_file Cpu register file
     /// @return Is the flag condition met that is specified by the instruction?
-    StatusOr<bool> InstructionExecutorLR35902::helper_common_flag_check(const InstructionLR35902& instruction, LR35902RegisterFile& register_file){
-        StatusOr<bool> flag_fetch;
-        bool condition_value = false;
+    bool InstructionExecutorLR35902::helper_common_flag_check(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file){
         //Check Z, C, NZ, NC
-        switch (instruction.execution_condition)
+        switch (instruction.descriptor->execution_condition)
         {
         case InstructionLR35902::ExecutionCondition::ZERO_SET:
-            flag_fetch = register_file.get_zero_flag(); 
-            condition_value = true;
-            break;
+            return register_file.get_zero_flag();
         case InstructionLR35902::ExecutionCondition::CARRY_SET:
-            flag_fetch = register_file.get_carry_flag(); 
-            condition_value = true;
-            break;
+            return register_file.get_carry_flag();
         case InstructionLR35902::ExecutionCondition::ZERO_NOT_SET:
-            flag_fetch = register_file.get_zero_flag(); 
-            condition_value = false;
-            break;
+            return !register_file.get_zero_flag();
         case InstructionLR35902::ExecutionCondition::CARRY_NOT_SET:
-            flag_fetch = register_file.get_carry_flag(); 
-            condition_value = false;
-            break;
+            return !register_file.get_carry_flag();
         default:
             //Crash us out, unexpected value
             LOG(FATAL) << "Invalid value in conditional switch! " 
-                    << instruction.full_mnemonic << " : " << std::to_string(instruction.opcode) << ", Condition: "
-                    << std::to_string(static_cast<int>(instruction.execution_condition));
+                    << InstructionSetLR35902::get_mnemonic(instruction.descriptor->opcode).full_mnemonic << " : " << std::to_string(instruction.descriptor->opcode) << ", Condition: "
+                    << std::to_string(static_cast<int>(instruction.descriptor->execution_condition));
+        }
+        return false;
+    }
+
+    /// @brief Builds the error for a instruction lacking the operands needed for execution.
+    /// @param instruction Instruction info
+    /// @return Status describing the missing operands.
+    Status InstructionExecutorLR35902::helper_missing_operands(const DecodedInstructionLR35902& instruction){
+        return Status::unkown_error(
+            "Instruction lacked operands for execution. " + std::to_string(instruction.descriptor->opcode)
+        );
+    }
+
+    /// @brief Returns the address held by the register operand.
+    /// @details 8-bit registers address the high page (LDH [C]), register pairs the whole address space.
+    /// @param operand Register operand in address mode
+    /// @param register_file CPU register file
+    /// @return Address held by the operand.
+    uint16_t InstructionExecutorLR35902::helper_operand_address(const InstructionDescriptorLR35902::OperandRegister& operand, const LR35902RegisterFile& register_file) noexcept{
+        const uint16_t high_page_start = 0xFF00;
+        const uint16_t value = register_file.get_register_value(operand.id);
+        return (get_register_width(operand.id) == LR35902RegisterWidth::WORD) ? value : static_cast<uint16_t>(high_page_start | value);
+    }
+
+    /// @brief Reads the 8-bit register operand or the byte at the address it holds.
+    /// @param operand Register operand
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Value of the operand or Status if can't read.
+    StatusOr<uint8_t> InstructionExecutorLR35902::helper_read_operand_8bit(const InstructionDescriptorLR35902::OperandRegister& operand, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        if(operand.address_mode()){
+            return memory_controller.get_byte(helper_operand_address(operand, register_file));
+        }
+        return static_cast<uint8_t>(register_file.get_register_value(operand.id));
+    }
+
+    /// @brief Writes the 8-bit register operand or the byte at the address it holds.
+    /// @param operand Register operand
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @param value Byte, New value.
+    /// @return Status of the write.
+    Status InstructionExecutorLR35902::helper_write_operand_8bit(const InstructionDescriptorLR35902::OperandRegister& operand, LR35902RegisterFile& register_file, MemoryController& memory_controller, const uint8_t value){
+        if(operand.address_mode()){
+            return memory_controller.set_byte(helper_operand_address(operand, register_file), value);
         }
-        if(!flag_fetch.ok()){
-            return flag_fetch.status();
+        register_file.set_register_value(operand.id, value);
+        return Status::ok_status();
+    }
+
+    /// @brief Reads the source of a 8-bit ALU instruction.
+    /// @details Read value if present, otherwise the second register operand or the only one.
+    /// @param instruction Instruction info
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Value of the source or Status if can't read.
+    StatusOr<uint8_t> InstructionExecutorLR35902::helper_read_source_8bit(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        if(instruction.descriptor->has_read_value()){
+            return instruction.unsigned_8brv();
+        }
+        const std::array<InstructionDescriptorLR35902::OperandRegister, 2>& operands = instruction.descriptor->operand_registers;
+        const InstructionDescriptorLR35902::OperandRegister& source = operands[1].is_present() ? operands[1] : operands[0];
+        if(!source.is_present()){
+            return helper_missing_operands(instruction);
         }
-        return (flag_fetch.value() == condition_value);
+        return helper_read_operand_8bit(source, register_file, memory_controller);
+    }
+
+    /// @brief Rotates or shifts the value.
+    /// @param operation Rotate or shift
+    /// @param value Value to rotate or shift
+    /// @param carry_flag Carry flag before, set to the carry flag bit after
+    /// @return Rotated or shifted value.
+    uint8_t InstructionExecutorLR35902::helper_shift(const ShiftOperation operation, const uint8_t value, uint8_t& carry_flag) noexcept{
+        //Bit shifted out lands in the carry flag bit
+        const uint8_t carry_in = carry_flag ? 1 : 0;
+        const uint8_t high_bit_out = static_cast<uint8_t>((value >> 3) & LR35902FlagTables::carry_flag_mask);
+        const uint8_t low_bit_out = static_cast<uint8_t>((value << 4) & LR35902FlagTables::carry_flag_mask);
+        switch(operation){
+            case ShiftOperation::RLC:
+                carry_flag = high_bit_out;
+                return static_cast<uint8_t>((value << 1) | (value >> 7));
+            case ShiftOperation::RRC:
+                carry_flag = low_bit_out;
+                return static_cast<uint8_t>((value >> 1) | (value << 7));
+            case ShiftOperation::RL:
+                carry_flag = high_bit_out;
+                return static_cast<uint8_t>((value << 1) | carry_in);
+            case ShiftOperation::RR:
+                carry_flag = low_bit_out;
+                return static_cast<uint8_t>((value >> 1) | (carry_in << 7));
+            case ShiftOperation::SLA:
+                carry_flag = high_bit_out;
+                return static_cast<uint8_t>(value << 1);
+            case ShiftOperation::SRA:
+                carry_flag = low_bit_out;
+                return static_cast<uint8_t>((value >> 1) | (value & 0x80));
+            case ShiftOperation::SRL:
+                carry_flag = low_bit_out;
+                return static_cast<uint8_t>(value >> 1);
+            default:
+                carry_flag = 0;
+                return static_cast<uint8_t>((value << 4) | (value >> 4));
+        }
+    }
+
+    /// @brief Executor for the NOP instruction
+    /// @details Does nothing
+    /// @param instruction NOP
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_nop(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
     /// @brief Executor for all of the JP instructions
@@ -83,124 +253,86 @@ namespace mygbc{
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_jp(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_jp(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
         bool jump_condition_satisfied = true;
-        if(instruction.execution_condition != InstructionLR35902::ExecutionCondition::NONE){
+        if(instruction.descriptor->execution_condition != InstructionLR35902::ExecutionCondition::NONE){
             //JP exists with common flag conditionals (C, Z, NC, NZ)
-            StatusOr<bool> flag_check = helper_common_flag_check(instruction, register_file);
-            if(!flag_check.ok()){
-                return flag_check.status();
-            }
-            jump_condition_satisfied = flag_check.value();
-        }
-        //Modify the pc accordingly
-        uint16_t execution_ticks = instruction.t_cycles_costs[0];
-        if(jump_condition_satisfied){
-            //JP either uses a unsigned 16-bit read value or the register HL
-            if(instruction.has_read_value && instruction.read_value_operand_interp_hint == InstructionLR35902::OperandValueInterpHint::ADDRESS){
-                //Read value jump
-                register_file.pc.set_word(instruction.unsigned_16brv());
-            }
-            else if(instruction.operand_registers.size() > 0 && instruction.operand_registers[0].id == "HL"){
-                //HL jump
-                register_file.pc.set_word(register_file.h_l.get_word());
-            }
-            else{
-                return Status::unkown_error("Instruction lacked operands for execution. " + instruction.opcode);
-            }
+            jump_condition_satisfied = helper_common_flag_check(instruction, register_file);
+        }
+        if(!jump_condition_satisfied){
+            //No jump, pc already points at the next instruction
+            return instruction.descriptor->t_cycles_costs[1];
+        }
+        //JP either uses a unsigned 16-bit read value or the register HL
+        if(instruction.descriptor->has_read_value()){
+            //Read value jump
+            register_file.pc.set_word(instruction.unsigned_16brv());
+        }
+        else if(instruction.descriptor->operand_registers[0].id == InstructionDescriptorLR35902::RegisterId::HL){
+            //HL jump
+            register_file.pc.set_word(register_file.h_l.get_word());
         }
         else{
-            //No jump inc pc and fetch potential missed exec timing
-            register_file.pc.increment(1);
-            if(instruction.t_cycles_costs.size() > 1){
-                execution_ticks = instruction.t_cycles_costs[1];
-            }
+            return helper_missing_operands(instruction);
         }
-        return execution_ticks;
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
     /// @brief Executor for all of the JR instructions
-    /// @details Handles and executes all of the relative jump variations
+    /// @details Handles and executes all of the relative jump variations. Jump is relative to the address of the next instruction.
     /// @param instruction JR variation
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_jr(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_jr(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
         bool jump_condition_satisfied = true;
-        if(instruction.execution_condition != InstructionLR35902::ExecutionCondition::NONE){
+        if(instruction.descriptor->execution_condition != InstructionLR35902::ExecutionCondition::NONE){
             //JR exists with common flag conditionals (C, Z, NC, NZ)
-            StatusOr<bool> flag_check = helper_common_flag_check(instruction, register_file);
-            if(!flag_check.ok()){
-                return flag_check.status();
-            }
-            jump_condition_satisfied = flag_check.value();
-        }
-        //Modify the pc accordingly
-        uint16_t pc = register_file.pc.get_word(); //Potential promo issues
-        uint16_t execution_ticks = instruction.t_cycles_costs[0];
-        if(jump_condition_satisfied){
-            //JR only has a signed 8bit variant
-            if(instruction.has_read_value && instruction.read_value_operand_interp_hint == InstructionLR35902::OperandValueInterpHint::SIGNED){
-                int8_t relative_jump = instruction.signed_8brv();
-                pc += relative_jump; //Int promo issue?
-            }
-            else{
-                return Status::unkown_error("Instruction lacked operands for execution. " + instruction.opcode);
-            }
+            jump_condition_satisfied = helper_common_flag_check(instruction, register_file);
         }
-        else{
-            //No jump inc pc and fetch potential missed exec timing
-            ++pc; 
-            if(instruction.t_cycles_costs.size() > 1){
-                execution_ticks = instruction.t_cycles_costs[1];
-            }
+        if(!jump_condition_satisfied){
+            //No jump, pc already points at the next instruction
+            return instruction.descriptor->t_cycles_costs[1];
+        }
+        //JR only has a signed 8bit variant
+        if(instruction.descriptor->read_value_operand_interp_hint != InstructionLR35902::OperandValueInterpHint::SIGNED){
+            return helper_missing_operands(instruction);
         }
+        uint16_t pc = register_file.pc.get_word();
+        pc = static_cast<uint16_t>(pc + instruction.signed_8brv());
         register_file.pc.set_word(pc);
-        return execution_ticks;
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
     /// @brief Executor for all of the CALL instructions
-    /// @details Handles and executes all of the subroutine calls
+    /// @details Handles and executes all of the subroutine calls. Pushes the address of the next instruction.
     /// @param instruction CALL variation
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_call(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_call(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
         bool jump_condition_satisfied = true;
-        if(instruction.execution_condition != InstructionLR35902::ExecutionCondition::NONE){
+        if(instruction.descriptor->execution_condition != InstructionLR35902::ExecutionCondition::NONE){
             //CALL exists with common flag conditionals (C, Z, NC, NZ)
-            StatusOr<bool> flag_check = helper_common_flag_check(instruction, register_file);
-            if(!flag_check.ok()){
-                return flag_check.status();
-            }
-            jump_condition_satisfied = flag_check.value();
-        }
-        //Modify the pc and sp accordingly
-        uint16_t execution_ticks = instruction.t_cycles_costs[0];
-        if(jump_condition_satisfied){
-            //CALL only has a 16-bit address variant
-            if(instruction.has_read_value && instruction.read_value_operand_interp_hint == InstructionLR35902::OperandValueInterpHint::ADDRESS){
-                //Push pc to stack
-                Status pc_push = memory_controller.set_word(register_file.sp.get_word(), register_file.pc.get_word());
-                if(!pc_push.ok()){
-                    return pc_push;
-                }
-                register_file.sp.increment(2);
-                //Jump to subroutine
-                register_file.pc.set_word(instruction.unsigned_16brv());
-            }
-            else{
-                return Status::unkown_error("Instruction lacked operands for execution. " + instruction.opcode);
-            }
+            jump_condition_satisfied = helper_common_flag_check(instruction, register_file);
         }
-        else{
-            //No jump inc pc and fetch potential missed exec timing
-            register_file.pc.increment(1);
-            if(instruction.t_cycles_costs.size() > 1){
-                execution_ticks = instruction.t_cycles_costs[1];
-            }
+        if(!jump_condition_satisfied){
+            //No jump, pc already points at the next instruction
+            return instruction.descriptor->t_cycles_costs[1];
+        }
+        //CALL only has a 16-bit address variant
+        if(!instruction.descriptor->has_read_value()){
+            return helper_missing_operands(instruction);
+        }
+        //Push pc to stack
+        Status pc_push = memory_controller.set_word(register_file.sp.get_word(), register_file.pc.get_word());
+        if(!pc_push.ok()){
+            return pc_push;
         }
-        return execution_ticks;
+        register_file.sp.increment(2);
+        //Jump to subroutine
+        register_file.pc.set_word(instruction.unsigned_16brv());
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
     /// @brief Executor for all of the RET instructions
@@ -209,36 +341,25 @@ namespace mygbc{
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ret(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ret(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
         bool jump_condition_satisfied = true;
-        if(instruction.execution_condition != InstructionLR35902::ExecutionCondition::NONE){
+        if(instruction.descriptor->execution_condition != InstructionLR35902::ExecutionCondition::NONE){
             //RET exists with common flag conditionals (C, Z, NC, NZ)
-            StatusOr<bool> flag_check = helper_common_flag_check(instruction, register_file);
-            if(!flag_check.ok()){
-                return flag_check.status();
-            }
-            jump_condition_satisfied = flag_check.value();
-        }
-        //Modify the pc and sp accordingly
-        uint16_t execution_ticks = instruction.t_cycles_costs[0];
-        if(jump_condition_satisfied){
-            //Read PC from stack and jump to it
-            uint16_t sp = register_file.sp.get_word() - 2; //Modify sp
-            StatusOr<uint16_t> pc_read = memory_controller.get_word(sp);
-            if(!pc_read.ok()){
-                return pc_read.status();
-            }
-            register_file.sp.set_word(sp); //Modify sp
-            register_file.pc.set_word(pc_read.value());
+            jump_condition_satisfied = helper_common_flag_check(instruction, register_file);
         }
-        else{
-            //No jump inc pc and fetch potential missed exec timing
-            register_file.pc.increment(1);
-            if(instruction.t_cycles_costs.size() > 1){
-                execution_ticks = instruction.t_cycles_costs[1];
-            }
+        if(!jump_condition_satisfied){
+            //No jump, pc already points at the next instruction
+            return instruction.descriptor->t_cycles_costs[1];
         }
-        return execution_ticks;
+        //Read PC from stack and jump to it
+        uint16_t sp = register_file.sp.get_word() - 2; //Modify sp
+        StatusOr<uint16_t> pc_read = memory_controller.get_word(sp);
+        if(!pc_read.ok()){
+            return pc_read.status();
+        }
+        register_file.sp.set_word(sp); //Modify sp
+        register_file.pc.set_word(pc_read.value());
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
     /// @brief Executor for all of the RETI instructions
@@ -247,9 +368,8 @@ namespace mygbc{
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_reti(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_reti(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
         //RETI has no conditions or variations. It just pops pc from stack and enables interupts.
-        uint16_t execution_ticks = instruction.t_cycles_costs[0];
         //Read PC from stack and jump to it
         uint16_t sp = register_file.sp.get_word() - 2; //Modify sp
         StatusOr<uint16_t> pc_read = memory_controller.get_word(sp);
@@ -258,18 +378,425 @@ namespace mygbc{
         }
         register_file.pc.set_word(pc_read.value());
         register_file.sp.set_word(sp); //Modify sp
-        register_file.ime.store(true); //Enable interupts
-        return instruction.t_cycles_costs[0];
+        register_file.ime = true; //Enable interupts
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
-    /// @brief Executor for all of the LD instructions
-    /// @details Handles and executes of load instructions
-    /// @param instruction LD variation
+    /// @brief Executor for all of the LD and LDH instructions
+    /// @details 8-bit loads between registers, immidiates and memory, 16-bit loads of register pairs. LD HL, SP + e8 has no executor yet.
+    /// @param instruction LD or LDH variation
     /// @param register_file CPU register file
     /// @param memory_controller Memory access
     /// @return Execution time in ticks or Status if can't execute.
-    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ld(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
-        //Split into 16-bit LD, 8-bit LD
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ld(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const InstructionDescriptorLR35902& descriptor = *instruction.descriptor;
+        const InstructionDescriptorLR35902::OperandRegister* destination = nullptr;
+        const InstructionDescriptorLR35902::OperandRegister* source = nullptr;
+        for(const InstructionDescriptorLR35902::OperandRegister& operand : descriptor.operand_registers){
+            if(operand.is_present()){
+                (operand.operand_position() == 0 ? destination : source) = &operand;
+            }
+        }
+        //LD HL, SP + e8 carries no read value in the instruction table
+        if(source != nullptr && source->value_operand_modified()){
+            return exec_invalid(instruction, register_file, memory_controller);
+        }
+        const bool read_value_is_source = descriptor.has_read_value() && descriptor.read_value_operand_position != 0;
+        if(!read_value_is_source && source == nullptr){
+            return helper_missing_operands(instruction);
+        }
+        //Read value in address mode, a8 of LDH addresses the high page
+        const uint16_t high_page_start = 0xFF00;
+        const uint16_t read_value_address = (descriptor.read_value_size_in_bytes > 1) ?
+            instruction.unsigned_16brv() : static_cast<uint16_t>(high_page_start | instruction.unsigned_8brv());
+        const bool read_value_is_address = descriptor.read_value_operand_interp_hint == InstructionLR35902::OperandValueInterpHint::ADDRESS;
+        const auto is_register_pair = [](const InstructionDescriptorLR35902::OperandRegister* operand){
+            return operand != nullptr && !operand->address_mode() && get_register_width(operand->id) == LR35902RegisterWidth::WORD;
+        };
+        if(is_register_pair(destination) || is_register_pair(source)){
+            //LD rr, n16, LD SP, HL and LD [a16], SP
+            const uint16_t value = read_value_is_source ? instruction.unsigned_16brv() : register_file.get_register_value(source->id);
+            if(destination == nullptr){
+                Status word_write = memory_controller.set_word(read_value_address, value);
+                if(!word_write.ok()){
+                    return word_write;
+                }
+            }
+            else{
+                register_file.set_register_value(destination->id, value);
+            }
+            return descriptor.t_cycles_costs[0];
+        }
+        uint8_t value = 0;
+        if(read_value_is_source){
+            if(read_value_is_address){
+                StatusOr<uint8_t> memory_read = memory_controller.get_byte(read_value_address);
+                if(!memory_read.ok()){
+                    return memory_read.status();
+                }
+                value = memory_read.value();
+            }
+            else{
+                value = instruction.unsigned_8brv();
+            }
+        }
+        else{
+            StatusOr<uint8_t> source_read = helper_read_operand_8bit(*source, register_file, memory_controller);
+            if(!source_read.ok()){
+                return source_read.status();
+            }
+            value = source_read.value();
+        }
+        Status destination_write = (destination != nullptr) ?
+            helper_write_operand_8bit(*destination, register_file, memory_controller, value) :
+            memory_controller.set_byte(read_value_address, value);
+        if(!destination_write.ok()){
+            return destination_write;
+        }
+        //HL+ and HL- move the address register after the access
+        for(const InstructionDescriptorLR35902::OperandRegister* operand : {destination, source}){
+            if(operand != nullptr && (operand->increment() || operand->decrement())){
+                const uint16_t address = register_file.get_register_value(operand->id);
+                register_file.set_register_value(operand->id, static_cast<uint16_t>(operand->increment() ? address + 1 : address - 1));
+            }
+        }
+        return descriptor.t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the HALT and STOP instructions
+    /// @details Halts the cpu until a interrupt is pending, the system skips the halted ticks
+    /// @param instruction HALT or STOP
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_halt(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        register_file.halted = true;
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the EI instruction
+    /// @details Schedules the interupts to be enabled after the next instruction
+    /// @param instruction EI
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ei(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        //LR35902 applies the schedule once the next instruction is done
+        register_file.ime_scheduled = true;
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the DI instruction
+    /// @details Disables the interupts right away, cancels a pending EI
+    /// @param instruction DI
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_di(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        register_file.ime = false;
+        register_file.ime_scheduled = false;
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the ADD instructions
+    /// @details Handles ADD A, x, ADD HL, rr and ADD SP, e8
+    /// @param instruction ADD variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_add(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const std::array<InstructionDescriptorLR35902::OperandRegister, 2>& operands = instruction.descriptor->operand_registers;
+        if(operands[0].id == InstructionDescriptorLR35902::RegisterId::HL){
+            //ADD HL, rr
+            const uint16_t hl = register_file.h_l.get_word();
+            const uint16_t source = register_file.get_register_value(operands[1].id);
+            register_file.h_l.set_word(static_cast<uint16_t>(hl + source));
+            register_file.record_flags(LR35902LazyFlags::Operation::ADD_16BIT, hl, source);
+            return instruction.descriptor->t_cycles_costs[0];
+        }
+        if(operands[0].id == InstructionDescriptorLR35902::RegisterId::SP){
+            //ADD SP, e8, flags of the unsigned low byte addition
+            const uint16_t sp = register_file.sp.get_word();
+            register_file.sp.set_word(static_cast<uint16_t>(sp + instruction.signed_8brv()));
+            register_file.record_flags(LR35902LazyFlags::Operation::ADD_SP_8BIT, sp, instruction.unsigned_8brv());
+            return instruction.descriptor->t_cycles_costs[0];
+        }
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t a = register_file.a_f.get_high();
+        register_file.a_f.set_high(static_cast<uint8_t>(a + source_read.value()));
+        register_file.record_flags(LR35902LazyFlags::Operation::ADD_8BIT, a, source_read.value());
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the ADC instructions
+    /// @details Adds the source and the carry to A
+    /// @param instruction ADC variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_adc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t a = register_file.a_f.get_high();
+        const uint8_t carry = register_file.get_carry_flag() ? 1 : 0;
+        register_file.a_f.set_high(static_cast<uint8_t>(a + source_read.value() + carry));
+        register_file.record_flags(LR35902LazyFlags::Operation::ADC_8BIT, a, source_read.value(), carry);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the SUB instructions
+    /// @details Subtracts the source from A
+    /// @param instruction SUB variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_sub(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t a = register_file.a_f.get_high();
+        register_file.a_f.set_high(static_cast<uint8_t>(a - source_read.value()));
+        register_file.record_flags(LR35902LazyFlags::Operation::SUB_8BIT, a, source_read.value());
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the SBC instructions
+    /// @details Subtracts the source and the carry from A
+    /// @param instruction SBC variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_sbc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t a = register_file.a_f.get_high();
+        const uint8_t carry = register_file.get_carry_flag() ? 1 : 0;
+        register_file.a_f.set_high(static_cast<uint8_t>(a - source_read.value() - carry));
+        register_file.record_flags(LR35902LazyFlags::Operation::SBC_8BIT, a, source_read.value(), carry);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the AND instructions
+    /// @details Bitwise and of A and the source into A
+    /// @param instruction AND variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_and(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t result = register_file.a_f.get_high() & source_read.value();
+        register_file.a_f.set_high(result);
+        register_file.record_flags(LR35902LazyFlags::Operation::AND_8BIT, result, 0);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the XOR instructions
+    /// @details Bitwise exclusive or of A and the source into A
+    /// @param instruction XOR variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_xor(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t result = register_file.a_f.get_high() ^ source_read.value();
+        register_file.a_f.set_high(result);
+        //XOR sets the flags like OR
+        register_file.record_flags(LR35902LazyFlags::Operation::OR_8BIT, result, 0);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the OR instructions
+    /// @details Bitwise or of A and the source into A
+    /// @param instruction OR variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_or(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        const uint8_t result = register_file.a_f.get_high() | source_read.value();
+        register_file.a_f.set_high(result);
+        register_file.record_flags(LR35902LazyFlags::Operation::OR_8BIT, result, 0);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the CP instructions
+    /// @details Subtracts the source from A for the flags only
+    /// @param instruction CP variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_cp(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        StatusOr<uint8_t> source_read = helper_read_source_8bit(instruction, register_file, memory_controller);
+        if(!source_read.ok()){
+            return source_read.status();
+        }
+        register_file.record_flags(LR35902LazyFlags::Operation::SUB_8BIT, register_file.a_f.get_high(), source_read.value());
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the INC instructions
+    /// @details 8-bit variations set the flags, 16-bit variations leave them alone
+    /// @param instruction INC variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_inc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const InstructionDescriptorLR35902::OperandRegister& target = instruction.descriptor->operand_registers[0];
+        if(!target.is_present()){
+            return helper_missing_operands(instruction);
+        }
+        if(!target.address_mode() && get_register_width(target.id) == LR35902RegisterWidth::WORD){
+            register_file.set_register_value(target.id, static_cast<uint16_t>(register_file.get_register_value(target.id) + 1));
+            return instruction.descriptor->t_cycles_costs[0];
+        }
+        StatusOr<uint8_t> target_read = helper_read_operand_8bit(target, register_file, memory_controller);
+        if(!target_read.ok()){
+            return target_read.status();
+        }
+        Status target_write = helper_write_operand_8bit(target, register_file, memory_controller, static_cast<uint8_t>(target_read.value() + 1));
+        if(!target_write.ok()){
+            return target_write;
+        }
+        register_file.record_flags(LR35902LazyFlags::Operation::INC_8BIT, target_read.value(), 0);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the DEC instructions
+    /// @details 8-bit variations set the flags, 16-bit variations leave them alone
+    /// @param instruction DEC variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_dec(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const InstructionDescriptorLR35902::OperandRegister& target = instruction.descriptor->operand_registers[0];
+        if(!target.is_present()){
+            return helper_missing_operands(instruction);
+        }
+        if(!target.address_mode() && get_register_width(target.id) == LR35902RegisterWidth::WORD){
+            register_file.set_register_value(target.id, static_cast<uint16_t>(register_file.get_register_value(target.id) - 1));
+            return instruction.descriptor->t_cycles_costs[0];
+        }
+        StatusOr<uint8_t> target_read = helper_read_operand_8bit(target, register_file, memory_controller);
+        if(!target_read.ok()){
+            return target_read.status();
+        }
+        Status target_write = helper_write_operand_8bit(target, register_file, memory_controller, static_cast<uint8_t>(target_read.value() - 1));
+        if(!target_write.ok()){
+            return target_write;
+        }
+        register_file.record_flags(LR35902LazyFlags::Operation::DEC_8BIT, target_read.value(), 0);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the DAA instruction
+    /// @details Corrects A into binary coded decimal after a addition or subtraction, looked up from the DAA table
+    /// @param instruction DAA
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_daa(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const uint16_t adjusted = LR35902FlagTables::daa_table[LR35902FlagTables::get_daa_index(register_file.a_f.get_high(), register_file.get_flags())];
+        register_file.a_f.set_high(static_cast<uint8_t>(adjusted >> 8));
+        register_file.set_flags(static_cast<uint8_t>(adjusted));
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the CPL instruction
+    /// @details Complements A
+    /// @param instruction CPL
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_cpl(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        register_file.a_f.set_high(static_cast<uint8_t>(~register_file.a_f.get_high()));
+        register_file.set_flags(static_cast<uint8_t>(
+            (register_file.get_flags() & (LR35902FlagTables::zero_flag_mask | LR35902FlagTables::carry_flag_mask)) |
+            LR35902FlagTables::sub_flag_mask | LR35902FlagTables::half_carry_flag_mask
+        ));
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the SCF instruction
+    /// @details Sets the carry flag
+    /// @param instruction SCF
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_scf(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        register_file.set_flags(static_cast<uint8_t>((register_file.get_flags() & LR35902FlagTables::zero_flag_mask) | LR35902FlagTables::carry_flag_mask));
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the CCF instruction
+    /// @details Complements the carry flag
+    /// @param instruction CCF
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_ccf(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        register_file.set_flags(static_cast<uint8_t>(
+            (register_file.get_flags() & (LR35902FlagTables::zero_flag_mask | LR35902FlagTables::carry_flag_mask)) ^ LR35902FlagTables::carry_flag_mask
+        ));
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for the RLCA, RRCA, RLA and RRA instructions
+    /// @details Rotates A, the zero flag is cleared
+    /// @tparam operation Rotate of the instruction
+    /// @param instruction Rotate of A
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks.
+    template <InstructionExecutorLR35902::ShiftOperation operation>
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_rotate_accumulator(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        uint8_t carry_flag = register_file.get_flags() & LR35902FlagTables::carry_flag_mask;
+        register_file.a_f.set_high(helper_shift(operation, register_file.a_f.get_high(), carry_flag));
+        register_file.set_flags(carry_flag);
+        return instruction.descriptor->t_cycles_costs[0];
+    }
+
+    /// @brief Executor for all of the 0xCB prefixed rotates, shifts and SWAP
+    /// @details Rotates or shifts the register or the byte at HL
+    /// @tparam operation Rotate or shift of the instruction
+    /// @param instruction Rotate or shift variation
+    /// @param register_file CPU register file
+    /// @param memory_controller Memory access
+    /// @return Execution time in ticks or Status if can't execute.
+    template <InstructionExecutorLR35902::ShiftOperation operation>
+    StatusOr<uint8_t> InstructionExecutorLR35902::exec_shift(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller){
+        const InstructionDescriptorLR35902::OperandRegister& target = instruction.descriptor->operand_registers[0];
+        if(!target.is_present()){
+            return helper_missing_operands(instruction);
+        }
+        StatusOr<uint8_t> target_read = helper_read_operand_8bit(target, register_file, memory_controller);
+        if(!target_read.ok()){
+            return target_read.status();
+        }
+        uint8_t carry_flag = register_file.get_flags() & LR35902FlagTables::carry_flag_mask;
+        const uint8_t result = helper_shift(operation, target_read.value(), carry_flag);
+        Status target_write = helper_write_operand_8bit(target, register_file, memory_controller, result);
+        if(!target_write.ok()){
+            return target_write;
+        }
+        register_file.set_flags(LR35902FlagTables::zero_flags[result] | carry_flag);
+        return instruction.descriptor->t_cycles_costs[0];
     }
 
 }
\ No newline at end of file
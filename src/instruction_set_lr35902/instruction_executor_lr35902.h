@@ -2,44 +2,143 @@
 #define INSTRUCTION_EXECUTOR_LR35902_H
 
 #include "instruction_lr35902.h"
+#include "decoded_instruction_lr35902.h" //DecodedInstructionLR35902
+#include "instruction_table_lr35902.h" //InstructionTableLR35902
 #include "../util/status/status_or.h"
 #include "../components/lr35902_register_file.h"
 #include "../components/memory_controller.h"
-#include <unordered_map> //std::unordered_map
-#include <functional> //std::function
-#include <string> //std::string
+#include <array> //std::array
+#include <cstddef> //std::size_t
 
 namespace mygbc{
 
     class InstructionExecutorLR35902{
         public:
 
-        /// @brief Initializes the executor and fetches the jump table.
-        /// @details Fetches the jump table to avoid link issues.
+        //Executor function for a instruction
+        using ExecuteFunction = StatusOr<uint8_t>(*)(const DecodedInstructionLR35902&, LR35902RegisterFile&, MemoryController&);
+
+        //256 unprefixed opcodes followed by 256 0xCB prefixed opcodes
+        static constexpr std::size_t dispatch_table_size = InstructionTableLR35902::table_size;
+
+        //Opcode index => Execute function
+        using DispatchTable = std::array<ExecuteFunction, dispatch_table_size>;
+
+        /// @brief Initializes the executor and fetches the dispatch table.
+        /// @details Dispatch table is shared by all executors and built only once.
         InstructionExecutorLR35902();
 
+        /// @brief Translates a opcode into its index in the dispatch table.
+        /// @details Unprefixed opcodes map to 0x000-0x0FF and 0xCB prefixed opcodes to 0x100-0x1FF.
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Index of the opcode in the dispatch table.
+        static constexpr std::size_t get_dispatch_index(const uint16_t opcode) noexcept{
+            return InstructionTableLR35902::get_table_index(opcode);
+        }
+
         /// @brief Executes the instruction if valid instruction. 
         /// @param instruction Instruction to execute.
         /// @param register_file Registers of the cpu.
         /// @param memory_controller Memory controller.
         /// @return Execution time in ticks or Status if can't execute. 
-        StatusOr<uint8_t> execute_instruction(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller) const;
+        StatusOr<uint8_t> execute_instruction(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller) const;
+
+        /// @brief Returns the executor function of the opcode.
+        /// @details Used to pre-bind executors ahead of execution. Opcodes without executor return the error slot.
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Executor function of the opcode.
+        static ExecuteFunction get_execute_function(const uint16_t opcode);
         
         private:
 
-        /// @brief Returns a built jump table containing executor functions for instructions
-        /// @details Each function is keyd by the short mnemonic of the instruction
-        /// @return jump table for instruction execution functions
-        std::unordered_map<std::string, std::function<StatusOr<uint8_t>(const InstructionLR35902&, LR35902RegisterFile&, MemoryController&)>> get_jump_table() const;
+        /// @brief Returns the dispatch table shared by all executors.
+        /// @details Table is built on first use and stays alive for the lifetime of the program.
+        /// @return Dispatch table for instruction execution functions.
+        static const DispatchTable& get_dispatch_table();
+
+        /// @brief Builds the dispatch table containing executor functions for instructions
+        /// @details Each function is indexed by the opcode of the instruction. Opcodes without a executor point at exec_invalid.
+        /// @return Dispatch table for instruction execution functions
+        static DispatchTable build_dispatch_table();
 
-        //Mnemonic => Execute function jump table
-        std::unordered_map<std::string, std::function<StatusOr<uint8_t>(const InstructionLR35902&, LR35902RegisterFile&, MemoryController&)>> jump_map_;
+        //Opcode index => Execute function dispatch table
+        const DispatchTable& dispatch_table_;
+
+        /// @brief Executor for opcodes with no executor.
+        /// @details Single error slot for all of the opcodes not supported by the executor.
+        /// @param instruction Unsupported instruction
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Status describing the missing executor.
+        static StatusOr<uint8_t> exec_invalid(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Checks the common flag conditionals: Z, C, NZ, NC
         /// @param instruction Instruction info
         /// @param register_file Cpu register file
         /// @return Is the flag condition met that is specified by the instruction?
-        static StatusOr<bool> helper_common_flag_check(const InstructionLR35902& instruction, LR35902RegisterFile& register_file);
+        static bool helper_common_flag_check(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file);
+
+        /// @brief Builds the error for a instruction lacking the operands needed for execution.
+        /// @param instruction Instruction info
+        /// @return Status describing the missing operands.
+        static Status helper_missing_operands(const DecodedInstructionLR35902& instruction);
+
+        //Rotates and shifts of the ALU
+        enum class ShiftOperation : uint8_t{
+            RLC = 0, //Rotate left, bit 7 to carry and bit 0
+            RRC = 1, //Rotate right, bit 0 to carry and bit 7
+            RL = 2, //Rotate left trough carry
+            RR = 3, //Rotate right trough carry
+            SLA = 4, //Shift left, bit 0 cleared
+            SRA = 5, //Shift right, bit 7 kept
+            SRL = 6, //Shift right, bit 7 cleared
+            SWAP = 7 //Swap the nibbles, carry cleared
+        };
+
+        /// @brief Returns the address held by the register operand.
+        /// @details 8-bit registers address the high page (LDH [C]), register pairs the whole address space.
+        /// @param operand Register operand in address mode
+        /// @param register_file CPU register file
+        /// @return Address held by the operand.
+        static uint16_t helper_operand_address(const InstructionDescriptorLR35902::OperandRegister& operand, const LR35902RegisterFile& register_file) noexcept;
+
+        /// @brief Reads the 8-bit register operand or the byte at the address it holds.
+        /// @param operand Register operand
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Value of the operand or Status if can't read.
+        static StatusOr<uint8_t> helper_read_operand_8bit(const InstructionDescriptorLR35902::OperandRegister& operand, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Writes the 8-bit register operand or the byte at the address it holds.
+        /// @param operand Register operand
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @param value Byte, New value.
+        /// @return Status of the write.
+        static Status helper_write_operand_8bit(const InstructionDescriptorLR35902::OperandRegister& operand, LR35902RegisterFile& register_file, MemoryController& memory_controller, const uint8_t value);
+
+        /// @brief Reads the source of a 8-bit ALU instruction.
+        /// @details Read value if present, otherwise the second register operand or the only one.
+        /// @param instruction Instruction info
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Value of the source or Status if can't read.
+        static StatusOr<uint8_t> helper_read_source_8bit(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Rotates or shifts the value.
+        /// @param operation Rotate or shift
+        /// @param value Value to rotate or shift
+        /// @param carry_flag Carry flag before, set to the carry flag bit after
+        /// @return Rotated or shifted value.
+        static uint8_t helper_shift(const ShiftOperation operation, const uint8_t value, uint8_t& carry_flag) noexcept;
+
+        /// @brief Executor for the NOP instruction
+        /// @details Does nothing
+        /// @param instruction NOP
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_nop(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Executor for all of the JP instructions
         /// @details Handles and executes all of the absolute jump variations
@@ -47,7 +146,7 @@ namespace mygbc{
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_jp(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        static StatusOr<uint8_t> exec_jp(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Executor for all of the JR instructions
         /// @details Handles and executes all of the relative jump variations
@@ -55,7 +154,7 @@ namespace mygbc{
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_jr(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        static StatusOr<uint8_t> exec_jr(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Executor for all of the CALL instructions
         /// @details Handles and executes all of the subroutine calls
@@ -63,7 +162,7 @@ namespace mygbc{
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_call(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        static StatusOr<uint8_t> exec_call(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Executor for all of the RET instructions
         /// @details Handles and executes all of the returns from subroutines
@@ -71,7 +170,7 @@ namespace mygbc{
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_ret(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        static StatusOr<uint8_t> exec_ret(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
         /// @brief Executor for all of the RETI instructions
         /// @details Handles and executes of the return from subroutine while enabling interupts
@@ -79,15 +178,171 @@ namespace mygbc{
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_reti(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        static StatusOr<uint8_t> exec_reti(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the LD and LDH instructions
+        /// @details 8-bit loads between registers, immidiates and memory, 16-bit loads of register pairs. LD HL, SP + e8 has no executor yet.
+        /// @param instruction LD or LDH variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_ld(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the HALT and STOP instructions
+        /// @details Halts the cpu until a interrupt is pending, the system skips the halted ticks
+        /// @param instruction HALT or STOP
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_halt(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the EI instruction
+        /// @details Schedules the interupts to be enabled after the next instruction
+        /// @param instruction EI
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_ei(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the DI instruction
+        /// @details Disables the interupts right away, cancels a pending EI
+        /// @param instruction DI
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_di(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the ADD instructions
+        /// @details Handles ADD A, x, ADD HL, rr and ADD SP, e8
+        /// @param instruction ADD variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_add(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the ADC instructions
+        /// @details Adds the source and the carry to A
+        /// @param instruction ADC variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_adc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the SUB instructions
+        /// @details Subtracts the source from A
+        /// @param instruction SUB variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_sub(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the SBC instructions
+        /// @details Subtracts the source and the carry from A
+        /// @param instruction SBC variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_sbc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the AND instructions
+        /// @details Bitwise and of A and the source into A
+        /// @param instruction AND variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_and(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the XOR instructions
+        /// @details Bitwise exclusive or of A and the source into A
+        /// @param instruction XOR variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_xor(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the OR instructions
+        /// @details Bitwise or of A and the source into A
+        /// @param instruction OR variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_or(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the CP instructions
+        /// @details Subtracts the source from A for the flags only
+        /// @param instruction CP variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_cp(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the INC instructions
+        /// @details 8-bit variations set the flags, 16-bit variations leave them alone
+        /// @param instruction INC variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_inc(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for all of the DEC instructions
+        /// @details 8-bit variations set the flags, 16-bit variations leave them alone
+        /// @param instruction DEC variation
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks or Status if can't execute.
+        static StatusOr<uint8_t> exec_dec(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the DAA instruction
+        /// @details Corrects A into binary coded decimal after a addition or subtraction, looked up from the DAA table
+        /// @param instruction DAA
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_daa(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the CPL instruction
+        /// @details Complements A
+        /// @param instruction CPL
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_cpl(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the SCF instruction
+        /// @details Sets the carry flag
+        /// @param instruction SCF
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_scf(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the CCF instruction
+        /// @details Complements the carry flag
+        /// @param instruction CCF
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        static StatusOr<uint8_t> exec_ccf(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+
+        /// @brief Executor for the RLCA, RRCA, RLA and RRA instructions
+        /// @details Rotates A, the zero flag is cleared
+        /// @tparam operation Rotate of the instruction
+        /// @param instruction Rotate of A
+        /// @param register_file CPU register file
+        /// @param memory_controller Memory access
+        /// @return Execution time in ticks.
+        template <ShiftOperation operation>
+        static StatusOr<uint8_t> exec_rotate_accumulator(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
-        /// @brief Executor for all of the LD instructions
-        /// @details Handles and executes of load instructions
-        /// @param instruction LD variation
+        /// @brief Executor for all of the 0xCB prefixed rotates, shifts and SWAP
+        /// @details Rotates or shifts the register or the byte at HL
+        /// @tparam operation Rotate or shift of the instruction
+        /// @param instruction Rotate or shift variation
         /// @param register_file CPU register file
         /// @param memory_controller Memory access
         /// @return Execution time in ticks or Status if can't execute.
-        static StatusOr<uint8_t> exec_ld(const InstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
+        template <ShiftOperation operation>
+        static StatusOr<uint8_t> exec_shift(const DecodedInstructionLR35902& instruction, LR35902RegisterFile& register_file, MemoryController& memory_controller);
 
     };
 }//namespace_mygbc
@@ -10,7 +10,7 @@ namespace mygbc{
     /// @brief Represents a single instruction in the LR35902 instruction set.
     struct InstructionLR35902{
                 
-        enum class FlagOperation{
+        enum class FlagOperation : uint8_t{
             SET = 0,  // Set to 1
             RESET = 1, // Set to 0
             DICTATE = 2,  // As dicated by the instruction
@@ -69,7 +69,7 @@ namespace mygbc{
         uint16_t read_value;
 
         //Some instructions deal with the value operands differently
-        enum class OperandValueInterpHint{ 
+        enum class OperandValueInterpHint : uint8_t{
             NONE = 0,
             VALUE = 1,
             ADDRESS = 2,
@@ -77,7 +77,7 @@ namespace mygbc{
         } const read_value_operand_interp_hint;
         
         //Some instructions have conditions to their execution
-        enum class ExecutionCondition{
+        enum class ExecutionCondition : uint8_t{
             NONE = 0,
             CARRY_SET = 1,
             CARRY_NOT_SET = 2,
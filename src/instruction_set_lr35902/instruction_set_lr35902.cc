@@ -1,535 +1,79 @@
 #include "instruction_set_lr35902.h"
-#include <utility>
+#include <string> //std::string
+#include <vector> //std::vector
 
 namespace mygbc{
 
-    /// @brief Initializes the decoder and fetches the instruction table.
-    /// @details Fetches the instruction table.
-    InstructionSetLR35902::InstructionSetLR35902()
-    :instruction_table_(std::move(get_instruction_table())){
-    }
-
     /// @brief Fetches instruction details by given opcode.
-    /// @details If opcode is illegal returns a error status.
+    /// @details If opcode is illegal returns a error status. Builds the full instruction with mnemonics, meant for disassembly and logging.
     /// @return Instruction details or error status.
     StatusOr<InstructionLR35902> InstructionSetLR35902::get_by_opcode(uint16_t opcode) const noexcept{
         //Check legitimacy of the opcode
-        if(instruction_table_.find(opcode) != instruction_table_.end()){
-            return instruction_table_.at(opcode);
+        if(!is_legal_opcode(opcode)){
+            //Valid opcode was not found for the input
+            return Status::invalid_opcode_error(
+                "Read value was not a valid opcode! Read value: " + std::to_string(opcode)
+            );
+        }
+        const InstructionDescriptorLR35902& descriptor = get_descriptor(opcode);
+        const InstructionMnemonicLR35902& mnemonic = get_mnemonic(opcode);
+        //Expand the compact operands
+        std::vector<InstructionLR35902::OperandRegister> operand_registers;
+        for(const InstructionDescriptorLR35902::OperandRegister& operand : descriptor.operand_registers){
+            if(operand.is_present()){
+                operand_registers.emplace_back(
+                    std::string(InstructionDescriptorLR35902::get_register_name(operand.id)), operand.operand_position(),
+                    operand.address_mode(), operand.decrement(), operand.increment(), operand.value_operand_modified()
+                );
+            }
         }
-        //Valid opcode was not found for the input
-        return Status::invalid_opcode_error(
-            "Read value was not a valid opcode! Read value: " + std::to_string(opcode)
+        std::vector<InstructionLR35902::OperandConstValue> operand_const_values;
+        if(descriptor.operand_const_value.is_present()){
+            operand_const_values.emplace_back(descriptor.operand_const_value.value, descriptor.operand_const_value.operand_position());
+        }
+        std::vector<uint8_t> t_cycles_costs{descriptor.t_cycles_costs[0]};
+        if(descriptor.t_cycles_costs[1] != 0){
+            t_cycles_costs.push_back(descriptor.t_cycles_costs[1]);
+        }
+        return InstructionLR35902(
+            descriptor.opcode, descriptor.size_in_bytes, operand_registers, operand_const_values,
+            descriptor.has_read_value(), descriptor.read_value_size_in_bytes, descriptor.read_value_operand_position,
+            descriptor.read_value_operand_interp_hint, descriptor.execution_condition,
+            std::string(mnemonic.short_mnemonic), std::string(mnemonic.full_mnemonic), std::string(mnemonic.replace_mnenomic),
+            t_cycles_costs, descriptor.effect_on_flag_z(), descriptor.effect_on_flag_n(), descriptor.effect_on_flag_h(), descriptor.effect_on_flag_c()
         );
     }
 
-    /// @brief Returns a built instruction table.
-    /// @return Instruction table, keyd by hex represatation of opcodes.
-    std::unordered_map<uint16_t, InstructionLR35902> InstructionSetLR35902::get_instruction_table() const{
-        //Map based on the information profided by https://gbdev.io/gb-opcodes//optables/dark
-        return std::unordered_map<uint16_t, InstructionLR35902>{
-            {0x0000, InstructionLR35902(0x0000,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"NOP","NOP","NOP",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0001, InstructionLR35902(0x0001,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD BC, n16","LD BC, %1",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0002, InstructionLR35902(0x0002,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, true, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [BC], A","LD [BC], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0003, InstructionLR35902(0x0003,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC BC","INC BC",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0004, InstructionLR35902(0x0004,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC B","INC B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0005, InstructionLR35902(0x0005,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC B","DEC B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0006, InstructionLR35902(0x0006,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, n8","LD B, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0007, InstructionLR35902(0x0007,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLCA","RLCA","RLCA",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0008, InstructionLR35902(0x0008,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 0, InstructionLR35902::OperandValueInterpHint::ADDRESS,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [a16], SP","LD [%0], SP",std::vector<uint8_t>{20},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0009, InstructionLR35902(0x0009,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false),InstructionLR35902::OperandRegister("BC", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD HL, BC","ADD HL, BC",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x000A, InstructionLR35902(0x000A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("BC", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [BC]","LD A, [BC]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x000B, InstructionLR35902(0x000B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC BC","DEC BC",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x000C, InstructionLR35902(0x000C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC C","INC C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x000D, InstructionLR35902(0x000D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC C","DEC C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x000E, InstructionLR35902(0x000E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, n8","LD C, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x000F, InstructionLR35902(0x000F,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRCA","RRCA","RRCA",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0010, InstructionLR35902(0x0010,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 0, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"STOP","STOP n8","STOP %0",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0011, InstructionLR35902(0x0011,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD DE, n16","LD DE, %1",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0012, InstructionLR35902(0x0012,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, true, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [DE], A","LD [DE], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0013, InstructionLR35902(0x0013,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC DE","INC DE",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0014, InstructionLR35902(0x0014,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC D","INC D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0015, InstructionLR35902(0x0015,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC D","DEC D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0016, InstructionLR35902(0x0016,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, n8","LD D, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0017, InstructionLR35902(0x0017,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLA","RLA","RLA",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0018, InstructionLR35902(0x0018,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 0, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::NONE,"JR","JR e8","JR %0",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0019, InstructionLR35902(0x0019,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false),InstructionLR35902::OperandRegister("DE", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD HL, DE","ADD HL, DE",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x001A, InstructionLR35902(0x001A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("DE", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [DE]","LD A, [DE]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x001B, InstructionLR35902(0x001B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC DE","DEC DE",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x001C, InstructionLR35902(0x001C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC E","INC E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x001D, InstructionLR35902(0x001D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC E","DEC E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x001E, InstructionLR35902(0x001E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, n8","LD E, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x001F, InstructionLR35902(0x001F,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRA","RRA","RRA",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0020, InstructionLR35902(0x0020,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::ZERO_NOT_SET,"JR","JR NZ, e8","JR NZ, %1",std::vector<uint8_t>{12,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0021, InstructionLR35902(0x0021,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD HL, n16","LD HL, %1",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0022, InstructionLR35902(0x0022,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, true, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL+], A","LD [HL+], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0023, InstructionLR35902(0x0023,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC HL","INC HL",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0024, InstructionLR35902(0x0024,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC H","INC H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0025, InstructionLR35902(0x0025,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC H","DEC H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0026, InstructionLR35902(0x0026,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, n8","LD H, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0027, InstructionLR35902(0x0027,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DAA","DAA","DAA",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0028, InstructionLR35902(0x0028,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::ZERO_SET,"JR","JR Z, e8","JR Z, %1",std::vector<uint8_t>{12,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0029, InstructionLR35902(0x0029,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD HL, HL","ADD HL, HL",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x002A, InstructionLR35902(0x002A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, true, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [HL+]","LD A, [HL+]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x002B, InstructionLR35902(0x002B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC HL","DEC HL",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x002C, InstructionLR35902(0x002C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC L","INC L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x002D, InstructionLR35902(0x002D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC L","DEC L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x002E, InstructionLR35902(0x002E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, n8","LD L, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x002F, InstructionLR35902(0x002F,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CPL","CPL","CPL",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0030, InstructionLR35902(0x0030,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::CARRY_NOT_SET,"JR","JR NC, e8","JR NC, %1",std::vector<uint8_t>{12,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0031, InstructionLR35902(0x0031,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD SP, n16","LD SP, %1",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0032, InstructionLR35902(0x0032,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, true, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL-], A","LD [HL-], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0033, InstructionLR35902(0x0033,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC SP","INC SP",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0034, InstructionLR35902(0x0034,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC [HL]","INC [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0035, InstructionLR35902(0x0035,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC [HL]","DEC [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0036, InstructionLR35902(0x0036,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], n8","LD [HL], %1",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0037, InstructionLR35902(0x0037,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SCF","SCF","SCF",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET)},
-            {0x0038, InstructionLR35902(0x0038,2,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::CARRY_SET,"JR","JR C, e8","JR C, %1",std::vector<uint8_t>{12,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0039, InstructionLR35902(0x0039,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false),InstructionLR35902::OperandRegister("SP", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD HL, SP","ADD HL, SP",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x003A, InstructionLR35902(0x003A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, true, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [HL-]","LD A, [HL-]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x003B, InstructionLR35902(0x003B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC SP","DEC SP",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x003C, InstructionLR35902(0x003C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"INC","INC A","INC A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x003D, InstructionLR35902(0x003D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DEC","DEC A","DEC A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x003E, InstructionLR35902(0x003E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, n8","LD A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x003F, InstructionLR35902(0x003F,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CCF","CCF","CCF",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0040, InstructionLR35902(0x0040,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, B","LD B, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0041, InstructionLR35902(0x0041,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, C","LD B, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0042, InstructionLR35902(0x0042,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, D","LD B, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0043, InstructionLR35902(0x0043,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, E","LD B, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0044, InstructionLR35902(0x0044,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, H","LD B, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0045, InstructionLR35902(0x0045,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, L","LD B, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0046, InstructionLR35902(0x0046,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, [HL]","LD B, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0047, InstructionLR35902(0x0047,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD B, A","LD B, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0048, InstructionLR35902(0x0048,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, B","LD C, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0049, InstructionLR35902(0x0049,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, C","LD C, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004A, InstructionLR35902(0x004A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, D","LD C, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004B, InstructionLR35902(0x004B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, E","LD C, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004C, InstructionLR35902(0x004C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, H","LD C, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004D, InstructionLR35902(0x004D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, L","LD C, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004E, InstructionLR35902(0x004E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, [HL]","LD C, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x004F, InstructionLR35902(0x004F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD C, A","LD C, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0050, InstructionLR35902(0x0050,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, B","LD D, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0051, InstructionLR35902(0x0051,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, C","LD D, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0052, InstructionLR35902(0x0052,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, D","LD D, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0053, InstructionLR35902(0x0053,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, E","LD D, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0054, InstructionLR35902(0x0054,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, H","LD D, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0055, InstructionLR35902(0x0055,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, L","LD D, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0056, InstructionLR35902(0x0056,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, [HL]","LD D, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0057, InstructionLR35902(0x0057,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD D, A","LD D, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0058, InstructionLR35902(0x0058,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, B","LD E, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0059, InstructionLR35902(0x0059,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, C","LD E, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005A, InstructionLR35902(0x005A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, D","LD E, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005B, InstructionLR35902(0x005B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, E","LD E, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005C, InstructionLR35902(0x005C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, H","LD E, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005D, InstructionLR35902(0x005D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, L","LD E, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005E, InstructionLR35902(0x005E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, [HL]","LD E, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x005F, InstructionLR35902(0x005F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD E, A","LD E, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0060, InstructionLR35902(0x0060,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, B","LD H, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0061, InstructionLR35902(0x0061,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, C","LD H, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0062, InstructionLR35902(0x0062,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, D","LD H, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0063, InstructionLR35902(0x0063,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, E","LD H, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0064, InstructionLR35902(0x0064,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, H","LD H, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0065, InstructionLR35902(0x0065,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, L","LD H, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0066, InstructionLR35902(0x0066,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, [HL]","LD H, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0067, InstructionLR35902(0x0067,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD H, A","LD H, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0068, InstructionLR35902(0x0068,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, B","LD L, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0069, InstructionLR35902(0x0069,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, C","LD L, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006A, InstructionLR35902(0x006A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, D","LD L, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006B, InstructionLR35902(0x006B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, E","LD L, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006C, InstructionLR35902(0x006C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, H","LD L, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006D, InstructionLR35902(0x006D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, L","LD L, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006E, InstructionLR35902(0x006E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, [HL]","LD L, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x006F, InstructionLR35902(0x006F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD L, A","LD L, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0070, InstructionLR35902(0x0070,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], B","LD [HL], B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0071, InstructionLR35902(0x0071,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], C","LD [HL], C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0072, InstructionLR35902(0x0072,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], D","LD [HL], D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0073, InstructionLR35902(0x0073,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], E","LD [HL], E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0074, InstructionLR35902(0x0074,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], H","LD [HL], H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0075, InstructionLR35902(0x0075,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], L","LD [HL], L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0076, InstructionLR35902(0x0076,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"HALT","HALT","HALT",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0077, InstructionLR35902(0x0077,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [HL], A","LD [HL], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0078, InstructionLR35902(0x0078,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, B","LD A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0079, InstructionLR35902(0x0079,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, C","LD A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007A, InstructionLR35902(0x007A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, D","LD A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007B, InstructionLR35902(0x007B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, E","LD A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007C, InstructionLR35902(0x007C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, H","LD A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007D, InstructionLR35902(0x007D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, L","LD A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007E, InstructionLR35902(0x007E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [HL]","LD A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x007F, InstructionLR35902(0x007F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, A","LD A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x0080, InstructionLR35902(0x0080,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, B","ADD A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0081, InstructionLR35902(0x0081,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, C","ADD A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0082, InstructionLR35902(0x0082,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, D","ADD A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0083, InstructionLR35902(0x0083,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, E","ADD A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0084, InstructionLR35902(0x0084,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, H","ADD A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0085, InstructionLR35902(0x0085,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, L","ADD A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0086, InstructionLR35902(0x0086,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, [HL]","ADD A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0087, InstructionLR35902(0x0087,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, A","ADD A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0088, InstructionLR35902(0x0088,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, B","ADC A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0089, InstructionLR35902(0x0089,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, C","ADC A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008A, InstructionLR35902(0x008A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, D","ADC A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008B, InstructionLR35902(0x008B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, E","ADC A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008C, InstructionLR35902(0x008C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, H","ADC A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008D, InstructionLR35902(0x008D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, L","ADC A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008E, InstructionLR35902(0x008E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, [HL]","ADC A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x008F, InstructionLR35902(0x008F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, A","ADC A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0090, InstructionLR35902(0x0090,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, B","SUB A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0091, InstructionLR35902(0x0091,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, C","SUB A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0092, InstructionLR35902(0x0092,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, D","SUB A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0093, InstructionLR35902(0x0093,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, E","SUB A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0094, InstructionLR35902(0x0094,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, H","SUB A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0095, InstructionLR35902(0x0095,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, L","SUB A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0096, InstructionLR35902(0x0096,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, [HL]","SUB A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0097, InstructionLR35902(0x0097,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, A","SUB A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x0098, InstructionLR35902(0x0098,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, B","SBC A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x0099, InstructionLR35902(0x0099,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, C","SBC A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009A, InstructionLR35902(0x009A,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, D","SBC A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009B, InstructionLR35902(0x009B,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, E","SBC A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009C, InstructionLR35902(0x009C,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, H","SBC A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009D, InstructionLR35902(0x009D,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, L","SBC A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009E, InstructionLR35902(0x009E,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, [HL]","SBC A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x009F, InstructionLR35902(0x009F,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, A","SBC A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00A0, InstructionLR35902(0x00A0,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, B","AND A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A1, InstructionLR35902(0x00A1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, C","AND A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A2, InstructionLR35902(0x00A2,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, D","AND A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A3, InstructionLR35902(0x00A3,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, E","AND A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A4, InstructionLR35902(0x00A4,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, H","AND A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A5, InstructionLR35902(0x00A5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, L","AND A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A6, InstructionLR35902(0x00A6,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, [HL]","AND A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A7, InstructionLR35902(0x00A7,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, A","AND A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A8, InstructionLR35902(0x00A8,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, B","XOR A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00A9, InstructionLR35902(0x00A9,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, C","XOR A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AA, InstructionLR35902(0x00AA,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, D","XOR A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AB, InstructionLR35902(0x00AB,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, E","XOR A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AC, InstructionLR35902(0x00AC,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, H","XOR A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AD, InstructionLR35902(0x00AD,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, L","XOR A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AE, InstructionLR35902(0x00AE,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, [HL]","XOR A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00AF, InstructionLR35902(0x00AF,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, A","XOR A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B0, InstructionLR35902(0x00B0,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, B","OR A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B1, InstructionLR35902(0x00B1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, C","OR A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B2, InstructionLR35902(0x00B2,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, D","OR A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B3, InstructionLR35902(0x00B3,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, E","OR A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B4, InstructionLR35902(0x00B4,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, H","OR A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B5, InstructionLR35902(0x00B5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, L","OR A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B6, InstructionLR35902(0x00B6,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, [HL]","OR A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B7, InstructionLR35902(0x00B7,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, A","OR A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00B8, InstructionLR35902(0x00B8,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, B","CP A, B",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00B9, InstructionLR35902(0x00B9,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, C","CP A, C",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BA, InstructionLR35902(0x00BA,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, D","CP A, D",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BB, InstructionLR35902(0x00BB,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, E","CP A, E",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BC, InstructionLR35902(0x00BC,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, H","CP A, H",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BD, InstructionLR35902(0x00BD,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, L","CP A, L",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BE, InstructionLR35902(0x00BE,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, [HL]","CP A, [HL]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00BF, InstructionLR35902(0x00BF,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, A","CP A, A",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00C0, InstructionLR35902(0x00C0,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::ZERO_NOT_SET,"RET","RET NZ","RET NZ",std::vector<uint8_t>{20,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C1, InstructionLR35902(0x00C1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"POP","POP BC","POP BC",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C2, InstructionLR35902(0x00C2,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::ZERO_NOT_SET,"JP","JP NZ, a16","JP NZ, %1",std::vector<uint8_t>{16,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C3, InstructionLR35902(0x00C3,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 0, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"JP","JP a16","JP %0",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C4, InstructionLR35902(0x00C4,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::ZERO_NOT_SET,"CALL","CALL NZ, a16","CALL NZ, %1",std::vector<uint8_t>{24,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C5, InstructionLR35902(0x00C5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("BC", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"PUSH","PUSH BC","PUSH BC",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C6, InstructionLR35902(0x00C6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD A, n8","ADD A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00C7, InstructionLR35902(0x00C7,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x00, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $00","RST $00",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C8, InstructionLR35902(0x00C8,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::ZERO_SET,"RET","RET Z","RET Z",std::vector<uint8_t>{20,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00C9, InstructionLR35902(0x00C9,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RET","RET","RET",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00CA, InstructionLR35902(0x00CA,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::ZERO_SET,"JP","JP Z, a16","JP Z, %1",std::vector<uint8_t>{16,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00CB, InstructionLR35902(0x00CB,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"PREFIX","PREFIX","PREFIX",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00CC, InstructionLR35902(0x00CC,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::ZERO_SET,"CALL","CALL Z, a16","CALL Z, %1",std::vector<uint8_t>{24,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00CD, InstructionLR35902(0x00CD,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 0, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"CALL","CALL a16","CALL %0",std::vector<uint8_t>{24},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00CE, InstructionLR35902(0x00CE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"ADC","ADC A, n8","ADC A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00CF, InstructionLR35902(0x00CF,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x08, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $08","RST $08",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D0, InstructionLR35902(0x00D0,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::CARRY_NOT_SET,"RET","RET NC","RET NC",std::vector<uint8_t>{20,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D1, InstructionLR35902(0x00D1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"POP","POP DE","POP DE",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D2, InstructionLR35902(0x00D2,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::CARRY_NOT_SET,"JP","JP NC, a16","JP NC, %1",std::vector<uint8_t>{16,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D4, InstructionLR35902(0x00D4,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::CARRY_NOT_SET,"CALL","CALL NC, a16","CALL NC, %1",std::vector<uint8_t>{24,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D5, InstructionLR35902(0x00D5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"PUSH","PUSH DE","PUSH DE",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D6, InstructionLR35902(0x00D6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"SUB","SUB A, n8","SUB A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00D7, InstructionLR35902(0x00D7,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x10, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $10","RST $10",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D8, InstructionLR35902(0x00D8,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RET","RET C","RET C",std::vector<uint8_t>{20,8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00D9, InstructionLR35902(0x00D9,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RETI","RETI","RETI",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00DA, InstructionLR35902(0x00DA,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::CARRY_SET,"JP","JP C, a16","JP C, %1",std::vector<uint8_t>{16,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00DC, InstructionLR35902(0x00DC,3,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::CARRY_SET,"CALL","CALL C, a16","CALL C, %1",std::vector<uint8_t>{24,12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00DE, InstructionLR35902(0x00DE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"SBC","SBC A, n8","SBC A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00DF, InstructionLR35902(0x00DF,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x18, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $18","RST $18",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E0, InstructionLR35902(0x00E0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 0, InstructionLR35902::OperandValueInterpHint::ADDRESS,InstructionLR35902::ExecutionCondition::NONE,"LDH","LDH [a8], A","LDH [%0], A",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E1, InstructionLR35902(0x00E1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"POP","POP HL","POP HL",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E2, InstructionLR35902(0x00E2,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, true, false, false, false),InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LDH","LDH [C], A","LDH [C], A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E5, InstructionLR35902(0x00E5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"PUSH","PUSH HL","PUSH HL",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E6, InstructionLR35902(0x00E6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"AND","AND A, n8","AND A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00E7, InstructionLR35902(0x00E7,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x20, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $20","RST $20",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00E8, InstructionLR35902(0x00E8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::SIGNED,InstructionLR35902::ExecutionCondition::NONE,"ADD","ADD SP, e8","ADD SP, %1",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00E9, InstructionLR35902(0x00E9,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"JP","JP HL","JP HL",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00EA, InstructionLR35902(0x00EA,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 0, InstructionLR35902::OperandValueInterpHint::ADDRESS,InstructionLR35902::ExecutionCondition::NONE,"LD","LD [a16], A","LD [%0], A",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00EE, InstructionLR35902(0x00EE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"XOR","XOR A, n8","XOR A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00EF, InstructionLR35902(0x00EF,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x28, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $28","RST $28",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F0, InstructionLR35902(0x00F0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::ADDRESS,InstructionLR35902::ExecutionCondition::NONE,"LDH","LDH A, [a8]","LDH A, [%1]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F1, InstructionLR35902(0x00F1,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("AF", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"POP","POP AF","POP AF",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00F2, InstructionLR35902(0x00F2,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false),InstructionLR35902::OperandRegister("C", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LDH","LDH A, [C]","LDH A, [C]",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F3, InstructionLR35902(0x00F3,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"DI","DI","DI",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F5, InstructionLR35902(0x00F5,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("AF", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"PUSH","PUSH AF","PUSH AF",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F6, InstructionLR35902(0x00F6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"OR","OR A, n8","OR A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0x00F7, InstructionLR35902(0x00F7,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x30, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $30","RST $30",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00F8, InstructionLR35902(0x00F8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, false, false, false, true),InstructionLR35902::OperandRegister("SP", 1, false, false, true, true)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD HL, SP + e8","LD HL, SP + e8",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00F9, InstructionLR35902(0x00F9,1,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("SP", 0, false, false, false, false),InstructionLR35902::OperandRegister("HL", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"LD","LD SP, HL","LD SP, HL",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00FA, InstructionLR35902(0x00FA,3,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 2, 1, InstructionLR35902::OperandValueInterpHint::ADDRESS,InstructionLR35902::ExecutionCondition::NONE,"LD","LD A, [a16]","LD A, [%1]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00FB, InstructionLR35902(0x00FB,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"EI","EI","EI",std::vector<uint8_t>{4},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0x00FE, InstructionLR35902(0x00FE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},true, 1, 1, InstructionLR35902::OperandValueInterpHint::VALUE,InstructionLR35902::ExecutionCondition::NONE,"CP","CP A, n8","CP A, %1",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::DICTATE)},
-            {0x00FF, InstructionLR35902(0x00FF,1,std::vector<InstructionLR35902::OperandRegister>{},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0x38, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RST","RST $38","RST $38",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB00, InstructionLR35902(0xCB00,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC B","RLC B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB01, InstructionLR35902(0xCB01,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC C","RLC C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB02, InstructionLR35902(0xCB02,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC D","RLC D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB03, InstructionLR35902(0xCB03,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC E","RLC E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB04, InstructionLR35902(0xCB04,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC H","RLC H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB05, InstructionLR35902(0xCB05,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC L","RLC L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB06, InstructionLR35902(0xCB06,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC [HL]","RLC [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB07, InstructionLR35902(0xCB07,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RLC","RLC A","RLC A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB08, InstructionLR35902(0xCB08,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC B","RRC B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB09, InstructionLR35902(0xCB09,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC C","RRC C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0A, InstructionLR35902(0xCB0A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC D","RRC D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0B, InstructionLR35902(0xCB0B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC E","RRC E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0C, InstructionLR35902(0xCB0C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC H","RRC H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0D, InstructionLR35902(0xCB0D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC L","RRC L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0E, InstructionLR35902(0xCB0E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC [HL]","RRC [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB0F, InstructionLR35902(0xCB0F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RRC","RRC A","RRC A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB10, InstructionLR35902(0xCB10,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL B","RL B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB11, InstructionLR35902(0xCB11,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL C","RL C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB12, InstructionLR35902(0xCB12,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL D","RL D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB13, InstructionLR35902(0xCB13,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL E","RL E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB14, InstructionLR35902(0xCB14,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL H","RL H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB15, InstructionLR35902(0xCB15,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL L","RL L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB16, InstructionLR35902(0xCB16,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL [HL]","RL [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB17, InstructionLR35902(0xCB17,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RL","RL A","RL A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB18, InstructionLR35902(0xCB18,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR B","RR B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB19, InstructionLR35902(0xCB19,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR C","RR C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1A, InstructionLR35902(0xCB1A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR D","RR D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1B, InstructionLR35902(0xCB1B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR E","RR E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1C, InstructionLR35902(0xCB1C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR H","RR H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1D, InstructionLR35902(0xCB1D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR L","RR L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1E, InstructionLR35902(0xCB1E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR [HL]","RR [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB1F, InstructionLR35902(0xCB1F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RR","RR A","RR A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB20, InstructionLR35902(0xCB20,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA B","SLA B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB21, InstructionLR35902(0xCB21,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA C","SLA C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB22, InstructionLR35902(0xCB22,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA D","SLA D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB23, InstructionLR35902(0xCB23,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA E","SLA E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB24, InstructionLR35902(0xCB24,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA H","SLA H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB25, InstructionLR35902(0xCB25,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA L","SLA L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB26, InstructionLR35902(0xCB26,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA [HL]","SLA [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB27, InstructionLR35902(0xCB27,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SLA","SLA A","SLA A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB28, InstructionLR35902(0xCB28,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA B","SRA B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB29, InstructionLR35902(0xCB29,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA C","SRA C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2A, InstructionLR35902(0xCB2A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA D","SRA D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2B, InstructionLR35902(0xCB2B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA E","SRA E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2C, InstructionLR35902(0xCB2C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA H","SRA H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2D, InstructionLR35902(0xCB2D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA L","SRA L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2E, InstructionLR35902(0xCB2E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA [HL]","SRA [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB2F, InstructionLR35902(0xCB2F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRA","SRA A","SRA A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB30, InstructionLR35902(0xCB30,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP B","SWAP B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB31, InstructionLR35902(0xCB31,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP C","SWAP C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB32, InstructionLR35902(0xCB32,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP D","SWAP D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB33, InstructionLR35902(0xCB33,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP E","SWAP E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB34, InstructionLR35902(0xCB34,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP H","SWAP H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB35, InstructionLR35902(0xCB35,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP L","SWAP L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB36, InstructionLR35902(0xCB36,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP [HL]","SWAP [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB37, InstructionLR35902(0xCB37,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SWAP","SWAP A","SWAP A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET)},
-            {0xCB38, InstructionLR35902(0xCB38,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL B","SRL B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB39, InstructionLR35902(0xCB39,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL C","SRL C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3A, InstructionLR35902(0xCB3A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL D","SRL D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3B, InstructionLR35902(0xCB3B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL E","SRL E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3C, InstructionLR35902(0xCB3C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL H","SRL H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3D, InstructionLR35902(0xCB3D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL L","SRL L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3E, InstructionLR35902(0xCB3E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 0, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL [HL]","SRL [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB3F, InstructionLR35902(0xCB3F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 0, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SRL","SRL A","SRL A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::DICTATE)},
-            {0xCB40, InstructionLR35902(0xCB40,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, B","BIT 0, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB41, InstructionLR35902(0xCB41,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, C","BIT 0, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB42, InstructionLR35902(0xCB42,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, D","BIT 0, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB43, InstructionLR35902(0xCB43,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, E","BIT 0, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB44, InstructionLR35902(0xCB44,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, H","BIT 0, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB45, InstructionLR35902(0xCB45,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, L","BIT 0, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB46, InstructionLR35902(0xCB46,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, [HL]","BIT 0, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB47, InstructionLR35902(0xCB47,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 0, A","BIT 0, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB48, InstructionLR35902(0xCB48,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, B","BIT 1, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB49, InstructionLR35902(0xCB49,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, C","BIT 1, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4A, InstructionLR35902(0xCB4A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, D","BIT 1, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4B, InstructionLR35902(0xCB4B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, E","BIT 1, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4C, InstructionLR35902(0xCB4C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, H","BIT 1, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4D, InstructionLR35902(0xCB4D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, L","BIT 1, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4E, InstructionLR35902(0xCB4E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, [HL]","BIT 1, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB4F, InstructionLR35902(0xCB4F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 1, A","BIT 1, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB50, InstructionLR35902(0xCB50,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, B","BIT 2, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB51, InstructionLR35902(0xCB51,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, C","BIT 2, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB52, InstructionLR35902(0xCB52,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, D","BIT 2, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB53, InstructionLR35902(0xCB53,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, E","BIT 2, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB54, InstructionLR35902(0xCB54,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, H","BIT 2, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB55, InstructionLR35902(0xCB55,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, L","BIT 2, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB56, InstructionLR35902(0xCB56,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, [HL]","BIT 2, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB57, InstructionLR35902(0xCB57,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 2, A","BIT 2, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB58, InstructionLR35902(0xCB58,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, B","BIT 3, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB59, InstructionLR35902(0xCB59,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, C","BIT 3, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5A, InstructionLR35902(0xCB5A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, D","BIT 3, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5B, InstructionLR35902(0xCB5B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, E","BIT 3, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5C, InstructionLR35902(0xCB5C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, H","BIT 3, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5D, InstructionLR35902(0xCB5D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, L","BIT 3, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5E, InstructionLR35902(0xCB5E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, [HL]","BIT 3, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB5F, InstructionLR35902(0xCB5F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 3, A","BIT 3, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB60, InstructionLR35902(0xCB60,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, B","BIT 4, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB61, InstructionLR35902(0xCB61,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, C","BIT 4, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB62, InstructionLR35902(0xCB62,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, D","BIT 4, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB63, InstructionLR35902(0xCB63,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, E","BIT 4, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB64, InstructionLR35902(0xCB64,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, H","BIT 4, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB65, InstructionLR35902(0xCB65,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, L","BIT 4, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB66, InstructionLR35902(0xCB66,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, [HL]","BIT 4, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB67, InstructionLR35902(0xCB67,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 4, A","BIT 4, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB68, InstructionLR35902(0xCB68,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, B","BIT 5, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB69, InstructionLR35902(0xCB69,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, C","BIT 5, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6A, InstructionLR35902(0xCB6A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, D","BIT 5, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6B, InstructionLR35902(0xCB6B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, E","BIT 5, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6C, InstructionLR35902(0xCB6C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, H","BIT 5, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6D, InstructionLR35902(0xCB6D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, L","BIT 5, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6E, InstructionLR35902(0xCB6E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, [HL]","BIT 5, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB6F, InstructionLR35902(0xCB6F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 5, A","BIT 5, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB70, InstructionLR35902(0xCB70,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, B","BIT 6, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB71, InstructionLR35902(0xCB71,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, C","BIT 6, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB72, InstructionLR35902(0xCB72,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, D","BIT 6, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB73, InstructionLR35902(0xCB73,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, E","BIT 6, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB74, InstructionLR35902(0xCB74,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, H","BIT 6, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB75, InstructionLR35902(0xCB75,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, L","BIT 6, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB76, InstructionLR35902(0xCB76,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, [HL]","BIT 6, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB77, InstructionLR35902(0xCB77,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 6, A","BIT 6, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB78, InstructionLR35902(0xCB78,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, B","BIT 7, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB79, InstructionLR35902(0xCB79,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, C","BIT 7, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7A, InstructionLR35902(0xCB7A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, D","BIT 7, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7B, InstructionLR35902(0xCB7B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, E","BIT 7, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7C, InstructionLR35902(0xCB7C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, H","BIT 7, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7D, InstructionLR35902(0xCB7D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, L","BIT 7, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7E, InstructionLR35902(0xCB7E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, [HL]","BIT 7, [HL]",std::vector<uint8_t>{12},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB7F, InstructionLR35902(0xCB7F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"BIT","BIT 7, A","BIT 7, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::DICTATE,InstructionLR35902::FlagOperation::RESET,InstructionLR35902::FlagOperation::SET,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB80, InstructionLR35902(0xCB80,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, B","RES 0, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB81, InstructionLR35902(0xCB81,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, C","RES 0, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB82, InstructionLR35902(0xCB82,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, D","RES 0, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB83, InstructionLR35902(0xCB83,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, E","RES 0, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB84, InstructionLR35902(0xCB84,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, H","RES 0, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB85, InstructionLR35902(0xCB85,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, L","RES 0, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB86, InstructionLR35902(0xCB86,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, [HL]","RES 0, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB87, InstructionLR35902(0xCB87,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 0, A","RES 0, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB88, InstructionLR35902(0xCB88,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, B","RES 1, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB89, InstructionLR35902(0xCB89,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, C","RES 1, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8A, InstructionLR35902(0xCB8A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, D","RES 1, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8B, InstructionLR35902(0xCB8B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, E","RES 1, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8C, InstructionLR35902(0xCB8C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, H","RES 1, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8D, InstructionLR35902(0xCB8D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, L","RES 1, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8E, InstructionLR35902(0xCB8E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, [HL]","RES 1, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB8F, InstructionLR35902(0xCB8F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 1, A","RES 1, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB90, InstructionLR35902(0xCB90,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, B","RES 2, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB91, InstructionLR35902(0xCB91,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, C","RES 2, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB92, InstructionLR35902(0xCB92,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, D","RES 2, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB93, InstructionLR35902(0xCB93,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, E","RES 2, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB94, InstructionLR35902(0xCB94,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, H","RES 2, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB95, InstructionLR35902(0xCB95,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, L","RES 2, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB96, InstructionLR35902(0xCB96,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, [HL]","RES 2, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB97, InstructionLR35902(0xCB97,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 2, A","RES 2, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB98, InstructionLR35902(0xCB98,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, B","RES 3, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB99, InstructionLR35902(0xCB99,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, C","RES 3, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9A, InstructionLR35902(0xCB9A,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, D","RES 3, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9B, InstructionLR35902(0xCB9B,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, E","RES 3, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9C, InstructionLR35902(0xCB9C,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, H","RES 3, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9D, InstructionLR35902(0xCB9D,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, L","RES 3, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9E, InstructionLR35902(0xCB9E,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, [HL]","RES 3, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCB9F, InstructionLR35902(0xCB9F,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 3, A","RES 3, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA0, InstructionLR35902(0xCBA0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, B","RES 4, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA1, InstructionLR35902(0xCBA1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, C","RES 4, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA2, InstructionLR35902(0xCBA2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, D","RES 4, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA3, InstructionLR35902(0xCBA3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, E","RES 4, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA4, InstructionLR35902(0xCBA4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, H","RES 4, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA5, InstructionLR35902(0xCBA5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, L","RES 4, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA6, InstructionLR35902(0xCBA6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, [HL]","RES 4, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA7, InstructionLR35902(0xCBA7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 4, A","RES 4, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA8, InstructionLR35902(0xCBA8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, B","RES 5, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBA9, InstructionLR35902(0xCBA9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, C","RES 5, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAA, InstructionLR35902(0xCBAA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, D","RES 5, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAB, InstructionLR35902(0xCBAB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, E","RES 5, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAC, InstructionLR35902(0xCBAC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, H","RES 5, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAD, InstructionLR35902(0xCBAD,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, L","RES 5, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAE, InstructionLR35902(0xCBAE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, [HL]","RES 5, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBAF, InstructionLR35902(0xCBAF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 5, A","RES 5, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB0, InstructionLR35902(0xCBB0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, B","RES 6, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB1, InstructionLR35902(0xCBB1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, C","RES 6, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB2, InstructionLR35902(0xCBB2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, D","RES 6, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB3, InstructionLR35902(0xCBB3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, E","RES 6, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB4, InstructionLR35902(0xCBB4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, H","RES 6, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB5, InstructionLR35902(0xCBB5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, L","RES 6, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB6, InstructionLR35902(0xCBB6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, [HL]","RES 6, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB7, InstructionLR35902(0xCBB7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 6, A","RES 6, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB8, InstructionLR35902(0xCBB8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, B","RES 7, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBB9, InstructionLR35902(0xCBB9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, C","RES 7, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBA, InstructionLR35902(0xCBBA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, D","RES 7, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBB, InstructionLR35902(0xCBBB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, E","RES 7, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBC, InstructionLR35902(0xCBBC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, H","RES 7, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBD, InstructionLR35902(0xCBBD,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, L","RES 7, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBE, InstructionLR35902(0xCBBE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, [HL]","RES 7, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBBF, InstructionLR35902(0xCBBF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"RES","RES 7, A","RES 7, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC0, InstructionLR35902(0xCBC0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, B","SET 0, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC1, InstructionLR35902(0xCBC1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, C","SET 0, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC2, InstructionLR35902(0xCBC2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, D","SET 0, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC3, InstructionLR35902(0xCBC3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, E","SET 0, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC4, InstructionLR35902(0xCBC4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, H","SET 0, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC5, InstructionLR35902(0xCBC5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, L","SET 0, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC6, InstructionLR35902(0xCBC6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, [HL]","SET 0, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC7, InstructionLR35902(0xCBC7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(0, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 0, A","SET 0, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC8, InstructionLR35902(0xCBC8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, B","SET 1, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBC9, InstructionLR35902(0xCBC9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, C","SET 1, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCA, InstructionLR35902(0xCBCA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, D","SET 1, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCB, InstructionLR35902(0xCBCB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, E","SET 1, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCC, InstructionLR35902(0xCBCC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, H","SET 1, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCD, InstructionLR35902(0xCBCD,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, L","SET 1, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCE, InstructionLR35902(0xCBCE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, [HL]","SET 1, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBCF, InstructionLR35902(0xCBCF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(1, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 1, A","SET 1, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD0, InstructionLR35902(0xCBD0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, B","SET 2, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD1, InstructionLR35902(0xCBD1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, C","SET 2, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD2, InstructionLR35902(0xCBD2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, D","SET 2, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD3, InstructionLR35902(0xCBD3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, E","SET 2, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD4, InstructionLR35902(0xCBD4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, H","SET 2, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD5, InstructionLR35902(0xCBD5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, L","SET 2, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD6, InstructionLR35902(0xCBD6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, [HL]","SET 2, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD7, InstructionLR35902(0xCBD7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(2, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 2, A","SET 2, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD8, InstructionLR35902(0xCBD8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, B","SET 3, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBD9, InstructionLR35902(0xCBD9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, C","SET 3, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDA, InstructionLR35902(0xCBDA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, D","SET 3, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDB, InstructionLR35902(0xCBDB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, E","SET 3, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDC, InstructionLR35902(0xCBDC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, H","SET 3, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDD, InstructionLR35902(0xCBDD,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, L","SET 3, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDE, InstructionLR35902(0xCBDE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, [HL]","SET 3, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBDF, InstructionLR35902(0xCBDF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(3, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 3, A","SET 3, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE0, InstructionLR35902(0xCBE0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, B","SET 4, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE1, InstructionLR35902(0xCBE1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, C","SET 4, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE2, InstructionLR35902(0xCBE2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, D","SET 4, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE3, InstructionLR35902(0xCBE3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, E","SET 4, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE4, InstructionLR35902(0xCBE4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, H","SET 4, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE5, InstructionLR35902(0xCBE5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, L","SET 4, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE6, InstructionLR35902(0xCBE6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, [HL]","SET 4, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE7, InstructionLR35902(0xCBE7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(4, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 4, A","SET 4, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE8, InstructionLR35902(0xCBE8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, B","SET 5, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBE9, InstructionLR35902(0xCBE9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, C","SET 5, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBEA, InstructionLR35902(0xCBEA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, D","SET 5, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBEB, InstructionLR35902(0xCBEB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, E","SET 5, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBEC, InstructionLR35902(0xCBEC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, H","SET 5, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBED, InstructionLR35902(0xCBED,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, L","SET 5, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBEE, InstructionLR35902(0xCBEE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, [HL]","SET 5, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBEF, InstructionLR35902(0xCBEF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(5, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 5, A","SET 5, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF0, InstructionLR35902(0xCBF0,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, B","SET 6, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF1, InstructionLR35902(0xCBF1,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, C","SET 6, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF2, InstructionLR35902(0xCBF2,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, D","SET 6, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF3, InstructionLR35902(0xCBF3,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, E","SET 6, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF4, InstructionLR35902(0xCBF4,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, H","SET 6, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF5, InstructionLR35902(0xCBF5,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, L","SET 6, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF6, InstructionLR35902(0xCBF6,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, [HL]","SET 6, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF7, InstructionLR35902(0xCBF7,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(6, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 6, A","SET 6, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF8, InstructionLR35902(0xCBF8,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("B", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, B","SET 7, B",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBF9, InstructionLR35902(0xCBF9,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("C", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, C","SET 7, C",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFA, InstructionLR35902(0xCBFA,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("D", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, D","SET 7, D",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFB, InstructionLR35902(0xCBFB,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("E", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, E","SET 7, E",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFC, InstructionLR35902(0xCBFC,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("H", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, H","SET 7, H",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFD, InstructionLR35902(0xCBFD,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("L", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, L","SET 7, L",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFE, InstructionLR35902(0xCBFE,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("HL", 1, true, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, [HL]","SET 7, [HL]",std::vector<uint8_t>{16},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-            {0xCBFF, InstructionLR35902(0xCBFF,2,std::vector<InstructionLR35902::OperandRegister>{InstructionLR35902::OperandRegister("A", 1, false, false, false, false)},std::vector<InstructionLR35902::OperandConstValue>{InstructionLR35902::OperandConstValue(7, 0)},false, 0, 0, InstructionLR35902::OperandValueInterpHint::NONE,InstructionLR35902::ExecutionCondition::NONE,"SET","SET 7, A","SET 7, A",std::vector<uint8_t>{8},InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE,InstructionLR35902::FlagOperation::NO_CHANGE)},
-        };
+    /// @brief Fetches the compact instruction descriptor by given opcode.
+    /// @details If opcode is illegal returns the descriptor of the illegal opcode 0xED, check is_valid().
+    /// @param opcode Opcode 1-2 bytes long
+    /// @return Reference to the descriptor in the instruction table.
+    const InstructionDescriptorLR35902& InstructionSetLR35902::get_descriptor(const uint16_t opcode) noexcept{
+        const InstructionDescriptorLR35902& descriptor = InstructionTableLR35902::descriptors[InstructionTableLR35902::get_table_index(opcode)];
+        if(descriptor.opcode != opcode){
+            //High byte is neither 0x00 or 0xCB
+            return InstructionTableLR35902::descriptors[illegal_opcode_index];
+        }
+        return descriptor;
+    }
+
+    /// @brief Fetches the mnemonics of the instruction by given opcode.
+    /// @details If opcode is illegal returns the mnemonics of the illegal opcode 0xED.
+    /// @param opcode Opcode 1-2 bytes long
+    /// @return Reference to the mnemonics in the mnemonic table.
+    const InstructionMnemonicLR35902& InstructionSetLR35902::get_mnemonic(const uint16_t opcode) noexcept{
+        if(InstructionTableLR35902::descriptors[InstructionTableLR35902::get_table_index(opcode)].opcode != opcode){
+            //High byte is neither 0x00 or 0xCB
+            return InstructionTableLR35902::mnemonics[illegal_opcode_index];
+        }
+        return InstructionTableLR35902::mnemonics[InstructionTableLR35902::get_table_index(opcode)];
+    }
+
+    /// @brief Checks that the opcode is present in the instruction table.
+    /// @param opcode Opcode 1-2 bytes long
+    /// @return Opcode is a legal instruction?
+    bool InstructionSetLR35902::is_legal_opcode(const uint16_t opcode) noexcept{
+        return get_descriptor(opcode).is_valid();
     }
 
-}//namespace_mygbc
\ No newline at end of file
+}//namespace_mygbc
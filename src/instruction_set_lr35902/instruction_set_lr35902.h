@@ -2,32 +2,47 @@
 #define INSTRUCTION_SET_LR35902_H
 
 #include "instruction_lr35902.h" //InstructionLR35902
+#include "instruction_descriptor_lr35902.h" //InstructionDescriptorLR35902, InstructionMnemonicLR35902
+#include "instruction_table_lr35902.h" //InstructionTableLR35902
 #include "../util/status/status_or.h" //StatusOr
-#include <unordered_map> //std::unordered_map
 
 namespace mygbc{
 
     /// @brief Rerpersents the whole instruction set of the LR35902
+    /// @details Backed by the constexpr InstructionTableLR35902, instances hold no state and share the table.
     class InstructionSetLR35902{
         public:
-        /// @brief Initializes the set by fetching the instruction table.
-        /// @details Fetches the instruction table.
-        InstructionSetLR35902();
+        /// @brief Initializes the set.
+        /// @details Instruction table is constexpr, nothing is built at runtime.
+        InstructionSetLR35902() = default;
 
         /// @brief Fetches instruction details by given opcode.
-        /// @details If opcode is illegal returns a error status.
+        /// @details If opcode is illegal returns a error status. Builds the full instruction with mnemonics, meant for disassembly and logging.
         /// @return Instruction details or error status.
         StatusOr<InstructionLR35902> get_by_opcode(uint16_t opcode) const noexcept;
 
+        /// @brief Fetches the compact instruction descriptor by given opcode.
+        /// @details If opcode is illegal returns the descriptor of the illegal opcode 0xED, check is_valid().
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Reference to the descriptor in the instruction table.
+        static const InstructionDescriptorLR35902& get_descriptor(const uint16_t opcode) noexcept;
+
+        /// @brief Fetches the mnemonics of the instruction by given opcode.
+        /// @details If opcode is illegal returns the mnemonics of the illegal opcode 0xED.
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Reference to the mnemonics in the mnemonic table.
+        static const InstructionMnemonicLR35902& get_mnemonic(const uint16_t opcode) noexcept;
+
         private:
-        /// @brief Returns a built instruction table.
-        /// @return Instruction table, keyd by hex represatation of opcodes.
-        std::unordered_map<uint16_t, InstructionLR35902> get_instruction_table() const;
+        /// @brief Checks that the opcode is present in the instruction table.
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Opcode is a legal instruction?
+        static bool is_legal_opcode(const uint16_t opcode) noexcept;
 
-        //Hex opcode => Instruction details
-        std::unordered_map<uint16_t, InstructionLR35902> instruction_table_;
+        //Index of the illegal opcode used for invalid lookups
+        static constexpr std::size_t illegal_opcode_index = 0xED;
     };
 
 }//namespace_mygbc
 
-#endif
\ No newline at end of file
+#endif
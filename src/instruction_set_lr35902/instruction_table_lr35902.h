@@ -0,0 +1,1083 @@
+#ifndef INSTRUCTION_TABLE_LR35902_H
+#define INSTRUCTION_TABLE_LR35902_H
+
+#include <array> //std::array
+#include <cstddef> //std::size_t
+#include "instruction_descriptor_lr35902.h" //InstructionDescriptorLR35902, InstructionMnemonicLR35902
+
+namespace mygbc{
+
+    /// @brief Compile time tables of the LR35902 instruction set.
+    /// @details Both tables are indexed by table index: unprefixed opcodes at 0x000-0x0FF and 0xCB prefixed opcodes at 0x100-0x1FF.
+    ///          Tables are constexpr and placed in read only data, every instruction set instance shares them.
+    struct InstructionTableLR35902{
+
+        //Number of entries in the tables, 256 unprefixed + 256 0xCB prefixed opcodes
+        static constexpr std::size_t table_size = 512;
+
+        /// @brief Translates a opcode into its index in the tables.
+        /// @details Unprefixed opcodes map to 0x000-0x0FF and 0xCB prefixed opcodes to 0x100-0x1FF.
+        /// @param opcode Opcode 1-2 bytes long
+        /// @return Index of the opcode in the tables.
+        static constexpr std::size_t get_table_index(const uint16_t opcode) noexcept{
+            const uint16_t two_byte_opcode_prefix = 0xCB;
+            return (static_cast<std::size_t>((opcode >> 8) == two_byte_opcode_prefix) << 8) | (opcode & 0xFF);
+        }
+
+        private:
+        using Desc = InstructionDescriptorLR35902;
+        using Reg = InstructionDescriptorLR35902::RegisterId;
+        using Hint = InstructionLR35902::OperandValueInterpHint;
+        using Cond = InstructionLR35902::ExecutionCondition;
+        using Flag = InstructionLR35902::FlagOperation;
+
+        public:
+        //Table index => Instruction descriptor. Based on the information profided by https://gbdev.io/gb-opcodes//optables/dark
+        static constexpr std::array<InstructionDescriptorLR35902, table_size> descriptors{{
+            {0x0000,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //NOP
+            {0x0001,3,2,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,false,false,false,false)},{},{12,0}}, //LD BC, n16
+            {0x0002,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,true,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LD [BC], A
+            {0x0003,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,false,false,false,false)},{},{8,0}}, //INC BC
+            {0x0004,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{4,0}}, //INC B
+            {0x0005,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{4,0}}, //DEC B
+            {0x0006,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //LD B, n8
+            {0x0007,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //RLCA
+            {0x0008,3,2,0,Hint::ADDRESS,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::SP,1,false,false,false,false)},{},{20,0}}, //LD [a16], SP
+            {0x0009,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,false,false,false,false),Desc::register_operand(Reg::BC,1,false,false,false,false)},{},{8,0}}, //ADD HL, BC
+            {0x000A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::BC,1,true,false,false,false)},{},{8,0}}, //LD A, [BC]
+            {0x000B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,false,false,false,false)},{},{8,0}}, //DEC BC
+            {0x000C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{4,0}}, //INC C
+            {0x000D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{4,0}}, //DEC C
+            {0x000E,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //LD C, n8
+            {0x000F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //RRCA
+            {0x0010,2,1,0,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //STOP n8
+            {0x0011,3,2,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,false,false,false,false)},{},{12,0}}, //LD DE, n16
+            {0x0012,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,true,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LD [DE], A
+            {0x0013,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,false,false,false,false)},{},{8,0}}, //INC DE
+            {0x0014,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{4,0}}, //INC D
+            {0x0015,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{4,0}}, //DEC D
+            {0x0016,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //LD D, n8
+            {0x0017,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //RLA
+            {0x0018,2,1,0,Hint::SIGNED,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{12,0}}, //JR e8
+            {0x0019,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,false,false,false,false),Desc::register_operand(Reg::DE,1,false,false,false,false)},{},{8,0}}, //ADD HL, DE
+            {0x001A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::DE,1,true,false,false,false)},{},{8,0}}, //LD A, [DE]
+            {0x001B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,false,false,false,false)},{},{8,0}}, //DEC DE
+            {0x001C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{4,0}}, //INC E
+            {0x001D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{4,0}}, //DEC E
+            {0x001E,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //LD E, n8
+            {0x001F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //RRA
+            {0x0020,2,1,1,Hint::SIGNED,Cond::ZERO_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{12,8}}, //JR NZ, e8
+            {0x0021,3,2,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{12,0}}, //LD HL, n16
+            {0x0022,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,true,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LD [HL+], A
+            {0x0023,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{8,0}}, //INC HL
+            {0x0024,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{4,0}}, //INC H
+            {0x0025,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{4,0}}, //DEC H
+            {0x0026,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //LD H, n8
+            {0x0027,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::NO_CHANGE,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //DAA
+            {0x0028,2,1,1,Hint::SIGNED,Cond::ZERO_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{12,8}}, //JR Z, e8
+            {0x0029,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,false,false,false,false),Desc::register_operand(Reg::HL,1,false,false,false,false)},{},{8,0}}, //ADD HL, HL
+            {0x002A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,true,false)},{},{8,0}}, //LD A, [HL+]
+            {0x002B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{8,0}}, //DEC HL
+            {0x002C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{4,0}}, //INC L
+            {0x002D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{4,0}}, //DEC L
+            {0x002E,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //LD L, n8
+            {0x002F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::SET,Flag::SET,Flag::NO_CHANGE),{},{},{4,0}}, //CPL
+            {0x0030,2,1,1,Hint::SIGNED,Cond::CARRY_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{12,8}}, //JR NC, e8
+            {0x0031,3,2,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::SP,0,false,false,false,false)},{},{12,0}}, //LD SP, n16
+            {0x0032,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,true,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LD [HL-], A
+            {0x0033,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::SP,0,false,false,false,false)},{},{8,0}}, //INC SP
+            {0x0034,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{12,0}}, //INC [HL]
+            {0x0035,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{12,0}}, //DEC [HL]
+            {0x0036,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{12,0}}, //LD [HL], n8
+            {0x0037,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::RESET,Flag::SET),{},{},{4,0}}, //SCF
+            {0x0038,2,1,1,Hint::SIGNED,Cond::CARRY_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{12,8}}, //JR C, e8
+            {0x0039,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,false,false,false,false),Desc::register_operand(Reg::SP,1,false,false,false,false)},{},{8,0}}, //ADD HL, SP
+            {0x003A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,true,false,false)},{},{8,0}}, //LD A, [HL-]
+            {0x003B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::SP,0,false,false,false,false)},{},{8,0}}, //DEC SP
+            {0x003C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{4,0}}, //INC A
+            {0x003D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{4,0}}, //DEC A
+            {0x003E,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //LD A, n8
+            {0x003F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::RESET,Flag::RESET,Flag::DICTATE),{},{},{4,0}}, //CCF
+            {0x0040,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD B, B
+            {0x0041,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD B, C
+            {0x0042,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD B, D
+            {0x0043,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD B, E
+            {0x0044,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD B, H
+            {0x0045,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD B, L
+            {0x0046,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD B, [HL]
+            {0x0047,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD B, A
+            {0x0048,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD C, B
+            {0x0049,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD C, C
+            {0x004A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD C, D
+            {0x004B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD C, E
+            {0x004C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD C, H
+            {0x004D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD C, L
+            {0x004E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD C, [HL]
+            {0x004F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD C, A
+            {0x0050,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD D, B
+            {0x0051,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD D, C
+            {0x0052,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD D, D
+            {0x0053,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD D, E
+            {0x0054,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD D, H
+            {0x0055,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD D, L
+            {0x0056,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD D, [HL]
+            {0x0057,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD D, A
+            {0x0058,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD E, B
+            {0x0059,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD E, C
+            {0x005A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD E, D
+            {0x005B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD E, E
+            {0x005C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD E, H
+            {0x005D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD E, L
+            {0x005E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD E, [HL]
+            {0x005F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD E, A
+            {0x0060,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD H, B
+            {0x0061,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD H, C
+            {0x0062,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD H, D
+            {0x0063,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD H, E
+            {0x0064,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD H, H
+            {0x0065,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD H, L
+            {0x0066,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD H, [HL]
+            {0x0067,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD H, A
+            {0x0068,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD L, B
+            {0x0069,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD L, C
+            {0x006A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD L, D
+            {0x006B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD L, E
+            {0x006C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD L, H
+            {0x006D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD L, L
+            {0x006E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD L, [HL]
+            {0x006F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD L, A
+            {0x0070,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{8,0}}, //LD [HL], B
+            {0x0071,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{8,0}}, //LD [HL], C
+            {0x0072,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{8,0}}, //LD [HL], D
+            {0x0073,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{8,0}}, //LD [HL], E
+            {0x0074,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{8,0}}, //LD [HL], H
+            {0x0075,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{8,0}}, //LD [HL], L
+            {0x0076,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //HALT
+            {0x0077,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,true,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LD [HL], A
+            {0x0078,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //LD A, B
+            {0x0079,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //LD A, C
+            {0x007A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //LD A, D
+            {0x007B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //LD A, E
+            {0x007C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //LD A, H
+            {0x007D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //LD A, L
+            {0x007E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //LD A, [HL]
+            {0x007F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //LD A, A
+            {0x0080,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //ADD A, B
+            {0x0081,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //ADD A, C
+            {0x0082,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //ADD A, D
+            {0x0083,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //ADD A, E
+            {0x0084,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //ADD A, H
+            {0x0085,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //ADD A, L
+            {0x0086,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //ADD A, [HL]
+            {0x0087,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //ADD A, A
+            {0x0088,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //ADC A, B
+            {0x0089,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //ADC A, C
+            {0x008A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //ADC A, D
+            {0x008B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //ADC A, E
+            {0x008C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //ADC A, H
+            {0x008D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //ADC A, L
+            {0x008E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //ADC A, [HL]
+            {0x008F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //ADC A, A
+            {0x0090,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //SUB A, B
+            {0x0091,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //SUB A, C
+            {0x0092,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //SUB A, D
+            {0x0093,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //SUB A, E
+            {0x0094,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //SUB A, H
+            {0x0095,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //SUB A, L
+            {0x0096,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //SUB A, [HL]
+            {0x0097,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::SET,Flag::SET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //SUB A, A
+            {0x0098,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //SBC A, B
+            {0x0099,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //SBC A, C
+            {0x009A,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //SBC A, D
+            {0x009B,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //SBC A, E
+            {0x009C,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //SBC A, H
+            {0x009D,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //SBC A, L
+            {0x009E,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //SBC A, [HL]
+            {0x009F,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //SBC A, A
+            {0x00A0,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //AND A, B
+            {0x00A1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //AND A, C
+            {0x00A2,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //AND A, D
+            {0x00A3,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //AND A, E
+            {0x00A4,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //AND A, H
+            {0x00A5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //AND A, L
+            {0x00A6,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //AND A, [HL]
+            {0x00A7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //AND A, A
+            {0x00A8,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //XOR A, B
+            {0x00A9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //XOR A, C
+            {0x00AA,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //XOR A, D
+            {0x00AB,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //XOR A, E
+            {0x00AC,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //XOR A, H
+            {0x00AD,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //XOR A, L
+            {0x00AE,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //XOR A, [HL]
+            {0x00AF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::SET,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //XOR A, A
+            {0x00B0,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //OR A, B
+            {0x00B1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //OR A, C
+            {0x00B2,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //OR A, D
+            {0x00B3,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //OR A, E
+            {0x00B4,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //OR A, H
+            {0x00B5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //OR A, L
+            {0x00B6,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //OR A, [HL]
+            {0x00B7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //OR A, A
+            {0x00B8,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::B,1,false,false,false,false)},{},{4,0}}, //CP A, B
+            {0x00B9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,false,false,false,false)},{},{4,0}}, //CP A, C
+            {0x00BA,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::D,1,false,false,false,false)},{},{4,0}}, //CP A, D
+            {0x00BB,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::E,1,false,false,false,false)},{},{4,0}}, //CP A, E
+            {0x00BC,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::H,1,false,false,false,false)},{},{4,0}}, //CP A, H
+            {0x00BD,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::L,1,false,false,false,false)},{},{4,0}}, //CP A, L
+            {0x00BE,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::HL,1,true,false,false,false)},{},{8,0}}, //CP A, [HL]
+            {0x00BF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::SET,Flag::SET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{4,0}}, //CP A, A
+            {0x00C0,1,0,0,Hint::NONE,Cond::ZERO_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{20,8}}, //RET NZ
+            {0x00C1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,false,false,false,false)},{},{12,0}}, //POP BC
+            {0x00C2,3,2,1,Hint::VALUE,Cond::ZERO_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,12}}, //JP NZ, a16
+            {0x00C3,3,2,0,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,0}}, //JP a16
+            {0x00C4,3,2,1,Hint::VALUE,Cond::ZERO_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{24,12}}, //CALL NZ, a16
+            {0x00C5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::BC,0,false,false,false,false)},{},{16,0}}, //PUSH BC
+            {0x00C6,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //ADD A, n8
+            {0x00C7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x00,0),{16,0}}, //RST $00
+            {0x00C8,1,0,0,Hint::NONE,Cond::ZERO_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{20,8}}, //RET Z
+            {0x00C9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,0}}, //RET
+            {0x00CA,3,2,1,Hint::VALUE,Cond::ZERO_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,12}}, //JP Z, a16
+            {0x00CB,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //PREFIX
+            {0x00CC,3,2,1,Hint::VALUE,Cond::ZERO_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{24,12}}, //CALL Z, a16
+            {0x00CD,3,2,0,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{24,0}}, //CALL a16
+            {0x00CE,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //ADC A, n8
+            {0x00CF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x08,0),{16,0}}, //RST $08
+            {0x00D0,1,0,0,Hint::NONE,Cond::CARRY_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{20,8}}, //RET NC
+            {0x00D1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,false,false,false,false)},{},{12,0}}, //POP DE
+            {0x00D2,3,2,1,Hint::VALUE,Cond::CARRY_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,12}}, //JP NC, a16
+            {0x00D3,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00D4,3,2,1,Hint::VALUE,Cond::CARRY_NOT_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{24,12}}, //CALL NC, a16
+            {0x00D5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::DE,0,false,false,false,false)},{},{16,0}}, //PUSH DE
+            {0x00D6,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SUB A, n8
+            {0x00D7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x10,0),{16,0}}, //RST $10
+            {0x00D8,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{20,8}}, //RET C
+            {0x00D9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,0}}, //RETI
+            {0x00DA,3,2,1,Hint::VALUE,Cond::CARRY_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{16,12}}, //JP C, a16
+            {0x00DB,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00DC,3,2,1,Hint::VALUE,Cond::CARRY_SET,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{24,12}}, //CALL C, a16
+            {0x00DD,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00DE,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SBC A, n8
+            {0x00DF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x18,0),{16,0}}, //RST $18
+            {0x00E0,2,1,0,Hint::ADDRESS,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},{},{12,0}}, //LDH [a8], A
+            {0x00E1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{12,0}}, //POP HL
+            {0x00E2,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,0,true,false,false,false),Desc::register_operand(Reg::A,1,false,false,false,false)},{},{8,0}}, //LDH [C], A
+            {0x00E3,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00E4,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00E5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{16,0}}, //PUSH HL
+            {0x00E6,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //AND A, n8
+            {0x00E7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x20,0),{16,0}}, //RST $20
+            {0x00E8,2,1,1,Hint::SIGNED,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::SP,0,false,false,false,false)},{},{16,0}}, //ADD SP, e8
+            {0x00E9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,0,false,false,false,false)},{},{4,0}}, //JP HL
+            {0x00EA,3,2,0,Hint::ADDRESS,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},{},{16,0}}, //LD [a16], A
+            {0x00EB,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00EC,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00ED,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00EE,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //XOR A, n8
+            {0x00EF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x28,0),{16,0}}, //RST $28
+            {0x00F0,2,1,1,Hint::ADDRESS,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{12,0}}, //LDH A, [a8]
+            {0x00F1,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::DICTATE,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::AF,0,false,false,false,false)},{},{12,0}}, //POP AF
+            {0x00F2,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false),Desc::register_operand(Reg::C,1,true,false,false,false)},{},{8,0}}, //LDH A, [C]
+            {0x00F3,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //DI
+            {0x00F4,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00F5,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::AF,0,false,false,false,false)},{},{16,0}}, //PUSH AF
+            {0x00F6,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //OR A, n8
+            {0x00F7,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x30,0),{16,0}}, //RST $30
+            {0x00F8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::RESET,Flag::RESET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,false,false,false,true),Desc::register_operand(Reg::SP,1,false,false,true,true)},{},{12,0}}, //LD HL, SP + e8
+            {0x00F9,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::SP,0,false,false,false,false),Desc::register_operand(Reg::HL,1,false,false,false,false)},{},{8,0}}, //LD SP, HL
+            {0x00FA,3,2,1,Hint::ADDRESS,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{16,0}}, //LD A, [a16]
+            {0x00FB,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{4,0}}, //EI
+            {0x00FC,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00FD,0,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},{},{0,0}}, //ILLEGAL
+            {0x00FE,2,1,1,Hint::VALUE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::SET,Flag::DICTATE,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //CP A, n8
+            {0x00FF,1,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{},Desc::const_operand(0x38,0),{16,0}}, //RST $38
+            {0xCB00,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //RLC B
+            {0xCB01,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //RLC C
+            {0xCB02,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //RLC D
+            {0xCB03,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //RLC E
+            {0xCB04,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //RLC H
+            {0xCB05,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //RLC L
+            {0xCB06,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //RLC [HL]
+            {0xCB07,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //RLC A
+            {0xCB08,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //RRC B
+            {0xCB09,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //RRC C
+            {0xCB0A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //RRC D
+            {0xCB0B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //RRC E
+            {0xCB0C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //RRC H
+            {0xCB0D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //RRC L
+            {0xCB0E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //RRC [HL]
+            {0xCB0F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //RRC A
+            {0xCB10,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //RL B
+            {0xCB11,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //RL C
+            {0xCB12,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //RL D
+            {0xCB13,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //RL E
+            {0xCB14,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //RL H
+            {0xCB15,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //RL L
+            {0xCB16,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //RL [HL]
+            {0xCB17,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //RL A
+            {0xCB18,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //RR B
+            {0xCB19,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //RR C
+            {0xCB1A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //RR D
+            {0xCB1B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //RR E
+            {0xCB1C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //RR H
+            {0xCB1D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //RR L
+            {0xCB1E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //RR [HL]
+            {0xCB1F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //RR A
+            {0xCB20,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //SLA B
+            {0xCB21,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //SLA C
+            {0xCB22,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //SLA D
+            {0xCB23,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //SLA E
+            {0xCB24,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //SLA H
+            {0xCB25,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //SLA L
+            {0xCB26,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //SLA [HL]
+            {0xCB27,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SLA A
+            {0xCB28,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //SRA B
+            {0xCB29,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //SRA C
+            {0xCB2A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //SRA D
+            {0xCB2B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //SRA E
+            {0xCB2C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //SRA H
+            {0xCB2D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //SRA L
+            {0xCB2E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //SRA [HL]
+            {0xCB2F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SRA A
+            {0xCB30,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //SWAP B
+            {0xCB31,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //SWAP C
+            {0xCB32,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //SWAP D
+            {0xCB33,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //SWAP E
+            {0xCB34,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //SWAP H
+            {0xCB35,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //SWAP L
+            {0xCB36,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //SWAP [HL]
+            {0xCB37,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::RESET),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SWAP A
+            {0xCB38,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::B,0,false,false,false,false)},{},{8,0}}, //SRL B
+            {0xCB39,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::C,0,false,false,false,false)},{},{8,0}}, //SRL C
+            {0xCB3A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::D,0,false,false,false,false)},{},{8,0}}, //SRL D
+            {0xCB3B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::E,0,false,false,false,false)},{},{8,0}}, //SRL E
+            {0xCB3C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::H,0,false,false,false,false)},{},{8,0}}, //SRL H
+            {0xCB3D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::L,0,false,false,false,false)},{},{8,0}}, //SRL L
+            {0xCB3E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::HL,0,true,false,false,false)},{},{16,0}}, //SRL [HL]
+            {0xCB3F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::RESET,Flag::DICTATE),{Desc::register_operand(Reg::A,0,false,false,false,false)},{},{8,0}}, //SRL A
+            {0xCB40,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, B
+            {0xCB41,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, C
+            {0xCB42,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, D
+            {0xCB43,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, E
+            {0xCB44,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, H
+            {0xCB45,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, L
+            {0xCB46,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(0,0),{12,0}}, //BIT 0, [HL]
+            {0xCB47,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //BIT 0, A
+            {0xCB48,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, B
+            {0xCB49,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, C
+            {0xCB4A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, D
+            {0xCB4B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, E
+            {0xCB4C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, H
+            {0xCB4D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, L
+            {0xCB4E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(1,0),{12,0}}, //BIT 1, [HL]
+            {0xCB4F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //BIT 1, A
+            {0xCB50,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, B
+            {0xCB51,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, C
+            {0xCB52,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, D
+            {0xCB53,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, E
+            {0xCB54,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, H
+            {0xCB55,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, L
+            {0xCB56,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(2,0),{12,0}}, //BIT 2, [HL]
+            {0xCB57,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //BIT 2, A
+            {0xCB58,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, B
+            {0xCB59,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, C
+            {0xCB5A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, D
+            {0xCB5B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, E
+            {0xCB5C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, H
+            {0xCB5D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, L
+            {0xCB5E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(3,0),{12,0}}, //BIT 3, [HL]
+            {0xCB5F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //BIT 3, A
+            {0xCB60,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, B
+            {0xCB61,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, C
+            {0xCB62,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, D
+            {0xCB63,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, E
+            {0xCB64,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, H
+            {0xCB65,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, L
+            {0xCB66,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(4,0),{12,0}}, //BIT 4, [HL]
+            {0xCB67,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //BIT 4, A
+            {0xCB68,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, B
+            {0xCB69,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, C
+            {0xCB6A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, D
+            {0xCB6B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, E
+            {0xCB6C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, H
+            {0xCB6D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, L
+            {0xCB6E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(5,0),{12,0}}, //BIT 5, [HL]
+            {0xCB6F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //BIT 5, A
+            {0xCB70,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, B
+            {0xCB71,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, C
+            {0xCB72,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, D
+            {0xCB73,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, E
+            {0xCB74,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, H
+            {0xCB75,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, L
+            {0xCB76,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(6,0),{12,0}}, //BIT 6, [HL]
+            {0xCB77,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //BIT 6, A
+            {0xCB78,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, B
+            {0xCB79,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, C
+            {0xCB7A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, D
+            {0xCB7B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, E
+            {0xCB7C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, H
+            {0xCB7D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, L
+            {0xCB7E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(7,0),{12,0}}, //BIT 7, [HL]
+            {0xCB7F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::DICTATE,Flag::RESET,Flag::SET,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //BIT 7, A
+            {0xCB80,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, B
+            {0xCB81,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, C
+            {0xCB82,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, D
+            {0xCB83,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, E
+            {0xCB84,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, H
+            {0xCB85,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, L
+            {0xCB86,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(0,0),{16,0}}, //RES 0, [HL]
+            {0xCB87,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //RES 0, A
+            {0xCB88,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, B
+            {0xCB89,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, C
+            {0xCB8A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, D
+            {0xCB8B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, E
+            {0xCB8C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, H
+            {0xCB8D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, L
+            {0xCB8E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(1,0),{16,0}}, //RES 1, [HL]
+            {0xCB8F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //RES 1, A
+            {0xCB90,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, B
+            {0xCB91,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, C
+            {0xCB92,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, D
+            {0xCB93,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, E
+            {0xCB94,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, H
+            {0xCB95,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, L
+            {0xCB96,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(2,0),{16,0}}, //RES 2, [HL]
+            {0xCB97,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //RES 2, A
+            {0xCB98,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, B
+            {0xCB99,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, C
+            {0xCB9A,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, D
+            {0xCB9B,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, E
+            {0xCB9C,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, H
+            {0xCB9D,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, L
+            {0xCB9E,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(3,0),{16,0}}, //RES 3, [HL]
+            {0xCB9F,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //RES 3, A
+            {0xCBA0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, B
+            {0xCBA1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, C
+            {0xCBA2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, D
+            {0xCBA3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, E
+            {0xCBA4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, H
+            {0xCBA5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, L
+            {0xCBA6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(4,0),{16,0}}, //RES 4, [HL]
+            {0xCBA7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //RES 4, A
+            {0xCBA8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, B
+            {0xCBA9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, C
+            {0xCBAA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, D
+            {0xCBAB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, E
+            {0xCBAC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, H
+            {0xCBAD,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, L
+            {0xCBAE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(5,0),{16,0}}, //RES 5, [HL]
+            {0xCBAF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //RES 5, A
+            {0xCBB0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, B
+            {0xCBB1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, C
+            {0xCBB2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, D
+            {0xCBB3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, E
+            {0xCBB4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, H
+            {0xCBB5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, L
+            {0xCBB6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(6,0),{16,0}}, //RES 6, [HL]
+            {0xCBB7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //RES 6, A
+            {0xCBB8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, B
+            {0xCBB9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, C
+            {0xCBBA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, D
+            {0xCBBB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, E
+            {0xCBBC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, H
+            {0xCBBD,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, L
+            {0xCBBE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(7,0),{16,0}}, //RES 7, [HL]
+            {0xCBBF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //RES 7, A
+            {0xCBC0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, B
+            {0xCBC1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, C
+            {0xCBC2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, D
+            {0xCBC3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, E
+            {0xCBC4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, H
+            {0xCBC5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, L
+            {0xCBC6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(0,0),{16,0}}, //SET 0, [HL]
+            {0xCBC7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(0,0),{8,0}}, //SET 0, A
+            {0xCBC8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, B
+            {0xCBC9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, C
+            {0xCBCA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, D
+            {0xCBCB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, E
+            {0xCBCC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, H
+            {0xCBCD,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, L
+            {0xCBCE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(1,0),{16,0}}, //SET 1, [HL]
+            {0xCBCF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(1,0),{8,0}}, //SET 1, A
+            {0xCBD0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, B
+            {0xCBD1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, C
+            {0xCBD2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, D
+            {0xCBD3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, E
+            {0xCBD4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, H
+            {0xCBD5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, L
+            {0xCBD6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(2,0),{16,0}}, //SET 2, [HL]
+            {0xCBD7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(2,0),{8,0}}, //SET 2, A
+            {0xCBD8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, B
+            {0xCBD9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, C
+            {0xCBDA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, D
+            {0xCBDB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, E
+            {0xCBDC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, H
+            {0xCBDD,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, L
+            {0xCBDE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(3,0),{16,0}}, //SET 3, [HL]
+            {0xCBDF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(3,0),{8,0}}, //SET 3, A
+            {0xCBE0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, B
+            {0xCBE1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, C
+            {0xCBE2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, D
+            {0xCBE3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, E
+            {0xCBE4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, H
+            {0xCBE5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, L
+            {0xCBE6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(4,0),{16,0}}, //SET 4, [HL]
+            {0xCBE7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(4,0),{8,0}}, //SET 4, A
+            {0xCBE8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, B
+            {0xCBE9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, C
+            {0xCBEA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, D
+            {0xCBEB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, E
+            {0xCBEC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, H
+            {0xCBED,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, L
+            {0xCBEE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(5,0),{16,0}}, //SET 5, [HL]
+            {0xCBEF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(5,0),{8,0}}, //SET 5, A
+            {0xCBF0,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, B
+            {0xCBF1,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, C
+            {0xCBF2,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, D
+            {0xCBF3,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, E
+            {0xCBF4,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, H
+            {0xCBF5,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, L
+            {0xCBF6,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(6,0),{16,0}}, //SET 6, [HL]
+            {0xCBF7,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(6,0),{8,0}}, //SET 6, A
+            {0xCBF8,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::B,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, B
+            {0xCBF9,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::C,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, C
+            {0xCBFA,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::D,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, D
+            {0xCBFB,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::E,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, E
+            {0xCBFC,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::H,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, H
+            {0xCBFD,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::L,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}}, //SET 7, L
+            {0xCBFE,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::HL,1,true,false,false,false)},Desc::const_operand(7,0),{16,0}}, //SET 7, [HL]
+            {0xCBFF,2,0,0,Hint::NONE,Cond::NONE,Desc::flag_effects_of(Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE,Flag::NO_CHANGE),{Desc::register_operand(Reg::A,1,false,false,false,false)},Desc::const_operand(7,0),{8,0}} //SET 7, A
+        }};
+
+        //Table index => Instruction mnemonics
+        static constexpr std::array<InstructionMnemonicLR35902, table_size> mnemonics{{
+            {"NOP","NOP","NOP"},
+            {"LD","LD BC, n16","LD BC, %1"},
+            {"LD","LD [BC], A","LD [BC], A"},
+            {"INC","INC BC","INC BC"},
+            {"INC","INC B","INC B"},
+            {"DEC","DEC B","DEC B"},
+            {"LD","LD B, n8","LD B, %1"},
+            {"RLCA","RLCA","RLCA"},
+            {"LD","LD [a16], SP","LD [%0], SP"},
+            {"ADD","ADD HL, BC","ADD HL, BC"},
+            {"LD","LD A, [BC]","LD A, [BC]"},
+            {"DEC","DEC BC","DEC BC"},
+            {"INC","INC C","INC C"},
+            {"DEC","DEC C","DEC C"},
+            {"LD","LD C, n8","LD C, %1"},
+            {"RRCA","RRCA","RRCA"},
+            {"STOP","STOP n8","STOP %0"},
+            {"LD","LD DE, n16","LD DE, %1"},
+            {"LD","LD [DE], A","LD [DE], A"},
+            {"INC","INC DE","INC DE"},
+            {"INC","INC D","INC D"},
+            {"DEC","DEC D","DEC D"},
+            {"LD","LD D, n8","LD D, %1"},
+            {"RLA","RLA","RLA"},
+            {"JR","JR e8","JR %0"},
+            {"ADD","ADD HL, DE","ADD HL, DE"},
+            {"LD","LD A, [DE]","LD A, [DE]"},
+            {"DEC","DEC DE","DEC DE"},
+            {"INC","INC E","INC E"},
+            {"DEC","DEC E","DEC E"},
+            {"LD","LD E, n8","LD E, %1"},
+            {"RRA","RRA","RRA"},
+            {"JR","JR NZ, e8","JR NZ, %1"},
+            {"LD","LD HL, n16","LD HL, %1"},
+            {"LD","LD [HL+], A","LD [HL+], A"},
+            {"INC","INC HL","INC HL"},
+            {"INC","INC H","INC H"},
+            {"DEC","DEC H","DEC H"},
+            {"LD","LD H, n8","LD H, %1"},
+            {"DAA","DAA","DAA"},
+            {"JR","JR Z, e8","JR Z, %1"},
+            {"ADD","ADD HL, HL","ADD HL, HL"},
+            {"LD","LD A, [HL+]","LD A, [HL+]"},
+            {"DEC","DEC HL","DEC HL"},
+            {"INC","INC L","INC L"},
+            {"DEC","DEC L","DEC L"},
+            {"LD","LD L, n8","LD L, %1"},
+            {"CPL","CPL","CPL"},
+            {"JR","JR NC, e8","JR NC, %1"},
+            {"LD","LD SP, n16","LD SP, %1"},
+            {"LD","LD [HL-], A","LD [HL-], A"},
+            {"INC","INC SP","INC SP"},
+            {"INC","INC [HL]","INC [HL]"},
+            {"DEC","DEC [HL]","DEC [HL]"},
+            {"LD","LD [HL], n8","LD [HL], %1"},
+            {"SCF","SCF","SCF"},
+            {"JR","JR C, e8","JR C, %1"},
+            {"ADD","ADD HL, SP","ADD HL, SP"},
+            {"LD","LD A, [HL-]","LD A, [HL-]"},
+            {"DEC","DEC SP","DEC SP"},
+            {"INC","INC A","INC A"},
+            {"DEC","DEC A","DEC A"},
+            {"LD","LD A, n8","LD A, %1"},
+            {"CCF","CCF","CCF"},
+            {"LD","LD B, B","LD B, B"},
+            {"LD","LD B, C","LD B, C"},
+            {"LD","LD B, D","LD B, D"},
+            {"LD","LD B, E","LD B, E"},
+            {"LD","LD B, H","LD B, H"},
+            {"LD","LD B, L","LD B, L"},
+            {"LD","LD B, [HL]","LD B, [HL]"},
+            {"LD","LD B, A","LD B, A"},
+            {"LD","LD C, B","LD C, B"},
+            {"LD","LD C, C","LD C, C"},
+            {"LD","LD C, D","LD C, D"},
+            {"LD","LD C, E","LD C, E"},
+            {"LD","LD C, H","LD C, H"},
+            {"LD","LD C, L","LD C, L"},
+            {"LD","LD C, [HL]","LD C, [HL]"},
+            {"LD","LD C, A","LD C, A"},
+            {"LD","LD D, B","LD D, B"},
+            {"LD","LD D, C","LD D, C"},
+            {"LD","LD D, D","LD D, D"},
+            {"LD","LD D, E","LD D, E"},
+            {"LD","LD D, H","LD D, H"},
+            {"LD","LD D, L","LD D, L"},
+            {"LD","LD D, [HL]","LD D, [HL]"},
+            {"LD","LD D, A","LD D, A"},
+            {"LD","LD E, B","LD E, B"},
+            {"LD","LD E, C","LD E, C"},
+            {"LD","LD E, D","LD E, D"},
+            {"LD","LD E, E","LD E, E"},
+            {"LD","LD E, H","LD E, H"},
+            {"LD","LD E, L","LD E, L"},
+            {"LD","LD E, [HL]","LD E, [HL]"},
+            {"LD","LD E, A","LD E, A"},
+            {"LD","LD H, B","LD H, B"},
+            {"LD","LD H, C","LD H, C"},
+            {"LD","LD H, D","LD H, D"},
+            {"LD","LD H, E","LD H, E"},
+            {"LD","LD H, H","LD H, H"},
+            {"LD","LD H, L","LD H, L"},
+            {"LD","LD H, [HL]","LD H, [HL]"},
+            {"LD","LD H, A","LD H, A"},
+            {"LD","LD L, B","LD L, B"},
+            {"LD","LD L, C","LD L, C"},
+            {"LD","LD L, D","LD L, D"},
+            {"LD","LD L, E","LD L, E"},
+            {"LD","LD L, H","LD L, H"},
+            {"LD","LD L, L","LD L, L"},
+            {"LD","LD L, [HL]","LD L, [HL]"},
+            {"LD","LD L, A","LD L, A"},
+            {"LD","LD [HL], B","LD [HL], B"},
+            {"LD","LD [HL], C","LD [HL], C"},
+            {"LD","LD [HL], D","LD [HL], D"},
+            {"LD","LD [HL], E","LD [HL], E"},
+            {"LD","LD [HL], H","LD [HL], H"},
+            {"LD","LD [HL], L","LD [HL], L"},
+            {"HALT","HALT","HALT"},
+            {"LD","LD [HL], A","LD [HL], A"},
+            {"LD","LD A, B","LD A, B"},
+            {"LD","LD A, C","LD A, C"},
+            {"LD","LD A, D","LD A, D"},
+            {"LD","LD A, E","LD A, E"},
+            {"LD","LD A, H","LD A, H"},
+            {"LD","LD A, L","LD A, L"},
+            {"LD","LD A, [HL]","LD A, [HL]"},
+            {"LD","LD A, A","LD A, A"},
+            {"ADD","ADD A, B","ADD A, B"},
+            {"ADD","ADD A, C","ADD A, C"},
+            {"ADD","ADD A, D","ADD A, D"},
+            {"ADD","ADD A, E","ADD A, E"},
+            {"ADD","ADD A, H","ADD A, H"},
+            {"ADD","ADD A, L","ADD A, L"},
+            {"ADD","ADD A, [HL]","ADD A, [HL]"},
+            {"ADD","ADD A, A","ADD A, A"},
+            {"ADC","ADC A, B","ADC A, B"},
+            {"ADC","ADC A, C","ADC A, C"},
+            {"ADC","ADC A, D","ADC A, D"},
+            {"ADC","ADC A, E","ADC A, E"},
+            {"ADC","ADC A, H","ADC A, H"},
+            {"ADC","ADC A, L","ADC A, L"},
+            {"ADC","ADC A, [HL]","ADC A, [HL]"},
+            {"ADC","ADC A, A","ADC A, A"},
+            {"SUB","SUB A, B","SUB A, B"},
+            {"SUB","SUB A, C","SUB A, C"},
+            {"SUB","SUB A, D","SUB A, D"},
+            {"SUB","SUB A, E","SUB A, E"},
+            {"SUB","SUB A, H","SUB A, H"},
+            {"SUB","SUB A, L","SUB A, L"},
+            {"SUB","SUB A, [HL]","SUB A, [HL]"},
+            {"SUB","SUB A, A","SUB A, A"},
+            {"SBC","SBC A, B","SBC A, B"},
+            {"SBC","SBC A, C","SBC A, C"},
+            {"SBC","SBC A, D","SBC A, D"},
+            {"SBC","SBC A, E","SBC A, E"},
+            {"SBC","SBC A, H","SBC A, H"},
+            {"SBC","SBC A, L","SBC A, L"},
+            {"SBC","SBC A, [HL]","SBC A, [HL]"},
+            {"SBC","SBC A, A","SBC A, A"},
+            {"AND","AND A, B","AND A, B"},
+            {"AND","AND A, C","AND A, C"},
+            {"AND","AND A, D","AND A, D"},
+            {"AND","AND A, E","AND A, E"},
+            {"AND","AND A, H","AND A, H"},
+            {"AND","AND A, L","AND A, L"},
+            {"AND","AND A, [HL]","AND A, [HL]"},
+            {"AND","AND A, A","AND A, A"},
+            {"XOR","XOR A, B","XOR A, B"},
+            {"XOR","XOR A, C","XOR A, C"},
+            {"XOR","XOR A, D","XOR A, D"},
+            {"XOR","XOR A, E","XOR A, E"},
+            {"XOR","XOR A, H","XOR A, H"},
+            {"XOR","XOR A, L","XOR A, L"},
+            {"XOR","XOR A, [HL]","XOR A, [HL]"},
+            {"XOR","XOR A, A","XOR A, A"},
+            {"OR","OR A, B","OR A, B"},
+            {"OR","OR A, C","OR A, C"},
+            {"OR","OR A, D","OR A, D"},
+            {"OR","OR A, E","OR A, E"},
+            {"OR","OR A, H","OR A, H"},
+            {"OR","OR A, L","OR A, L"},
+            {"OR","OR A, [HL]","OR A, [HL]"},
+            {"OR","OR A, A","OR A, A"},
+            {"CP","CP A, B","CP A, B"},
+            {"CP","CP A, C","CP A, C"},
+            {"CP","CP A, D","CP A, D"},
+            {"CP","CP A, E","CP A, E"},
+            {"CP","CP A, H","CP A, H"},
+            {"CP","CP A, L","CP A, L"},
+            {"CP","CP A, [HL]","CP A, [HL]"},
+            {"CP","CP A, A","CP A, A"},
+            {"RET","RET NZ","RET NZ"},
+            {"POP","POP BC","POP BC"},
+            {"JP","JP NZ, a16","JP NZ, %1"},
+            {"JP","JP a16","JP %0"},
+            {"CALL","CALL NZ, a16","CALL NZ, %1"},
+            {"PUSH","PUSH BC","PUSH BC"},
+            {"ADD","ADD A, n8","ADD A, %1"},
+            {"RST","RST $00","RST $00"},
+            {"RET","RET Z","RET Z"},
+            {"RET","RET","RET"},
+            {"JP","JP Z, a16","JP Z, %1"},
+            {"PREFIX","PREFIX","PREFIX"},
+            {"CALL","CALL Z, a16","CALL Z, %1"},
+            {"CALL","CALL a16","CALL %0"},
+            {"ADC","ADC A, n8","ADC A, %1"},
+            {"RST","RST $08","RST $08"},
+            {"RET","RET NC","RET NC"},
+            {"POP","POP DE","POP DE"},
+            {"JP","JP NC, a16","JP NC, %1"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"CALL","CALL NC, a16","CALL NC, %1"},
+            {"PUSH","PUSH DE","PUSH DE"},
+            {"SUB","SUB A, n8","SUB A, %1"},
+            {"RST","RST $10","RST $10"},
+            {"RET","RET C","RET C"},
+            {"RETI","RETI","RETI"},
+            {"JP","JP C, a16","JP C, %1"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"CALL","CALL C, a16","CALL C, %1"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"SBC","SBC A, n8","SBC A, %1"},
+            {"RST","RST $18","RST $18"},
+            {"LDH","LDH [a8], A","LDH [%0], A"},
+            {"POP","POP HL","POP HL"},
+            {"LDH","LDH [C], A","LDH [C], A"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"PUSH","PUSH HL","PUSH HL"},
+            {"AND","AND A, n8","AND A, %1"},
+            {"RST","RST $20","RST $20"},
+            {"ADD","ADD SP, e8","ADD SP, %1"},
+            {"JP","JP HL","JP HL"},
+            {"LD","LD [a16], A","LD [%0], A"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"XOR","XOR A, n8","XOR A, %1"},
+            {"RST","RST $28","RST $28"},
+            {"LDH","LDH A, [a8]","LDH A, [%1]"},
+            {"POP","POP AF","POP AF"},
+            {"LDH","LDH A, [C]","LDH A, [C]"},
+            {"DI","DI","DI"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"PUSH","PUSH AF","PUSH AF"},
+            {"OR","OR A, n8","OR A, %1"},
+            {"RST","RST $30","RST $30"},
+            {"LD","LD HL, SP + e8","LD HL, SP + e8"},
+            {"LD","LD SP, HL","LD SP, HL"},
+            {"LD","LD A, [a16]","LD A, [%1]"},
+            {"EI","EI","EI"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"ILLEGAL","ILLEGAL","ILLEGAL"},
+            {"CP","CP A, n8","CP A, %1"},
+            {"RST","RST $38","RST $38"},
+            {"RLC","RLC B","RLC B"},
+            {"RLC","RLC C","RLC C"},
+            {"RLC","RLC D","RLC D"},
+            {"RLC","RLC E","RLC E"},
+            {"RLC","RLC H","RLC H"},
+            {"RLC","RLC L","RLC L"},
+            {"RLC","RLC [HL]","RLC [HL]"},
+            {"RLC","RLC A","RLC A"},
+            {"RRC","RRC B","RRC B"},
+            {"RRC","RRC C","RRC C"},
+            {"RRC","RRC D","RRC D"},
+            {"RRC","RRC E","RRC E"},
+            {"RRC","RRC H","RRC H"},
+            {"RRC","RRC L","RRC L"},
+            {"RRC","RRC [HL]","RRC [HL]"},
+            {"RRC","RRC A","RRC A"},
+            {"RL","RL B","RL B"},
+            {"RL","RL C","RL C"},
+            {"RL","RL D","RL D"},
+            {"RL","RL E","RL E"},
+            {"RL","RL H","RL H"},
+            {"RL","RL L","RL L"},
+            {"RL","RL [HL]","RL [HL]"},
+            {"RL","RL A","RL A"},
+            {"RR","RR B","RR B"},
+            {"RR","RR C","RR C"},
+            {"RR","RR D","RR D"},
+            {"RR","RR E","RR E"},
+            {"RR","RR H","RR H"},
+            {"RR","RR L","RR L"},
+            {"RR","RR [HL]","RR [HL]"},
+            {"RR","RR A","RR A"},
+            {"SLA","SLA B","SLA B"},
+            {"SLA","SLA C","SLA C"},
+            {"SLA","SLA D","SLA D"},
+            {"SLA","SLA E","SLA E"},
+            {"SLA","SLA H","SLA H"},
+            {"SLA","SLA L","SLA L"},
+            {"SLA","SLA [HL]","SLA [HL]"},
+            {"SLA","SLA A","SLA A"},
+            {"SRA","SRA B","SRA B"},
+            {"SRA","SRA C","SRA C"},
+            {"SRA","SRA D","SRA D"},
+            {"SRA","SRA E","SRA E"},
+            {"SRA","SRA H","SRA H"},
+            {"SRA","SRA L","SRA L"},
+            {"SRA","SRA [HL]","SRA [HL]"},
+            {"SRA","SRA A","SRA A"},
+            {"SWAP","SWAP B","SWAP B"},
+            {"SWAP","SWAP C","SWAP C"},
+            {"SWAP","SWAP D","SWAP D"},
+            {"SWAP","SWAP E","SWAP E"},
+            {"SWAP","SWAP H","SWAP H"},
+            {"SWAP","SWAP L","SWAP L"},
+            {"SWAP","SWAP [HL]","SWAP [HL]"},
+            {"SWAP","SWAP A","SWAP A"},
+            {"SRL","SRL B","SRL B"},
+            {"SRL","SRL C","SRL C"},
+            {"SRL","SRL D","SRL D"},
+            {"SRL","SRL E","SRL E"},
+            {"SRL","SRL H","SRL H"},
+            {"SRL","SRL L","SRL L"},
+            {"SRL","SRL [HL]","SRL [HL]"},
+            {"SRL","SRL A","SRL A"},
+            {"BIT","BIT 0, B","BIT 0, B"},
+            {"BIT","BIT 0, C","BIT 0, C"},
+            {"BIT","BIT 0, D","BIT 0, D"},
+            {"BIT","BIT 0, E","BIT 0, E"},
+            {"BIT","BIT 0, H","BIT 0, H"},
+            {"BIT","BIT 0, L","BIT 0, L"},
+            {"BIT","BIT 0, [HL]","BIT 0, [HL]"},
+            {"BIT","BIT 0, A","BIT 0, A"},
+            {"BIT","BIT 1, B","BIT 1, B"},
+            {"BIT","BIT 1, C","BIT 1, C"},
+            {"BIT","BIT 1, D","BIT 1, D"},
+            {"BIT","BIT 1, E","BIT 1, E"},
+            {"BIT","BIT 1, H","BIT 1, H"},
+            {"BIT","BIT 1, L","BIT 1, L"},
+            {"BIT","BIT 1, [HL]","BIT 1, [HL]"},
+            {"BIT","BIT 1, A","BIT 1, A"},
+            {"BIT","BIT 2, B","BIT 2, B"},
+            {"BIT","BIT 2, C","BIT 2, C"},
+            {"BIT","BIT 2, D","BIT 2, D"},
+            {"BIT","BIT 2, E","BIT 2, E"},
+            {"BIT","BIT 2, H","BIT 2, H"},
+            {"BIT","BIT 2, L","BIT 2, L"},
+            {"BIT","BIT 2, [HL]","BIT 2, [HL]"},
+            {"BIT","BIT 2, A","BIT 2, A"},
+            {"BIT","BIT 3, B","BIT 3, B"},
+            {"BIT","BIT 3, C","BIT 3, C"},
+            {"BIT","BIT 3, D","BIT 3, D"},
+            {"BIT","BIT 3, E","BIT 3, E"},
+            {"BIT","BIT 3, H","BIT 3, H"},
+            {"BIT","BIT 3, L","BIT 3, L"},
+            {"BIT","BIT 3, [HL]","BIT 3, [HL]"},
+            {"BIT","BIT 3, A","BIT 3, A"},
+            {"BIT","BIT 4, B","BIT 4, B"},
+            {"BIT","BIT 4, C","BIT 4, C"},
+            {"BIT","BIT 4, D","BIT 4, D"},
+            {"BIT","BIT 4, E","BIT 4, E"},
+            {"BIT","BIT 4, H","BIT 4, H"},
+            {"BIT","BIT 4, L","BIT 4, L"},
+            {"BIT","BIT 4, [HL]","BIT 4, [HL]"},
+            {"BIT","BIT 4, A","BIT 4, A"},
+            {"BIT","BIT 5, B","BIT 5, B"},
+            {"BIT","BIT 5, C","BIT 5, C"},
+            {"BIT","BIT 5, D","BIT 5, D"},
+            {"BIT","BIT 5, E","BIT 5, E"},
+            {"BIT","BIT 5, H","BIT 5, H"},
+            {"BIT","BIT 5, L","BIT 5, L"},
+            {"BIT","BIT 5, [HL]","BIT 5, [HL]"},
+            {"BIT","BIT 5, A","BIT 5, A"},
+            {"BIT","BIT 6, B","BIT 6, B"},
+            {"BIT","BIT 6, C","BIT 6, C"},
+            {"BIT","BIT 6, D","BIT 6, D"},
+            {"BIT","BIT 6, E","BIT 6, E"},
+            {"BIT","BIT 6, H","BIT 6, H"},
+            {"BIT","BIT 6, L","BIT 6, L"},
+            {"BIT","BIT 6, [HL]","BIT 6, [HL]"},
+            {"BIT","BIT 6, A","BIT 6, A"},
+            {"BIT","BIT 7, B","BIT 7, B"},
+            {"BIT","BIT 7, C","BIT 7, C"},
+            {"BIT","BIT 7, D","BIT 7, D"},
+            {"BIT","BIT 7, E","BIT 7, E"},
+            {"BIT","BIT 7, H","BIT 7, H"},
+            {"BIT","BIT 7, L","BIT 7, L"},
+            {"BIT","BIT 7, [HL]","BIT 7, [HL]"},
+            {"BIT","BIT 7, A","BIT 7, A"},
+            {"RES","RES 0, B","RES 0, B"},
+            {"RES","RES 0, C","RES 0, C"},
+            {"RES","RES 0, D","RES 0, D"},
+            {"RES","RES 0, E","RES 0, E"},
+            {"RES","RES 0, H","RES 0, H"},
+            {"RES","RES 0, L","RES 0, L"},
+            {"RES","RES 0, [HL]","RES 0, [HL]"},
+            {"RES","RES 0, A","RES 0, A"},
+            {"RES","RES 1, B","RES 1, B"},
+            {"RES","RES 1, C","RES 1, C"},
+            {"RES","RES 1, D","RES 1, D"},
+            {"RES","RES 1, E","RES 1, E"},
+            {"RES","RES 1, H","RES 1, H"},
+            {"RES","RES 1, L","RES 1, L"},
+            {"RES","RES 1, [HL]","RES 1, [HL]"},
+            {"RES","RES 1, A","RES 1, A"},
+            {"RES","RES 2, B","RES 2, B"},
+            {"RES","RES 2, C","RES 2, C"},
+            {"RES","RES 2, D","RES 2, D"},
+            {"RES","RES 2, E","RES 2, E"},
+            {"RES","RES 2, H","RES 2, H"},
+            {"RES","RES 2, L","RES 2, L"},
+            {"RES","RES 2, [HL]","RES 2, [HL]"},
+            {"RES","RES 2, A","RES 2, A"},
+            {"RES","RES 3, B","RES 3, B"},
+            {"RES","RES 3, C","RES 3, C"},
+            {"RES","RES 3, D","RES 3, D"},
+            {"RES","RES 3, E","RES 3, E"},
+            {"RES","RES 3, H","RES 3, H"},
+            {"RES","RES 3, L","RES 3, L"},
+            {"RES","RES 3, [HL]","RES 3, [HL]"},
+            {"RES","RES 3, A","RES 3, A"},
+            {"RES","RES 4, B","RES 4, B"},
+            {"RES","RES 4, C","RES 4, C"},
+            {"RES","RES 4, D","RES 4, D"},
+            {"RES","RES 4, E","RES 4, E"},
+            {"RES","RES 4, H","RES 4, H"},
+            {"RES","RES 4, L","RES 4, L"},
+            {"RES","RES 4, [HL]","RES 4, [HL]"},
+            {"RES","RES 4, A","RES 4, A"},
+            {"RES","RES 5, B","RES 5, B"},
+            {"RES","RES 5, C","RES 5, C"},
+            {"RES","RES 5, D","RES 5, D"},
+            {"RES","RES 5, E","RES 5, E"},
+            {"RES","RES 5, H","RES 5, H"},
+            {"RES","RES 5, L","RES 5, L"},
+            {"RES","RES 5, [HL]","RES 5, [HL]"},
+            {"RES","RES 5, A","RES 5, A"},
+            {"RES","RES 6, B","RES 6, B"},
+            {"RES","RES 6, C","RES 6, C"},
+            {"RES","RES 6, D","RES 6, D"},
+            {"RES","RES 6, E","RES 6, E"},
+            {"RES","RES 6, H","RES 6, H"},
+            {"RES","RES 6, L","RES 6, L"},
+            {"RES","RES 6, [HL]","RES 6, [HL]"},
+            {"RES","RES 6, A","RES 6, A"},
+            {"RES","RES 7, B","RES 7, B"},
+            {"RES","RES 7, C","RES 7, C"},
+            {"RES","RES 7, D","RES 7, D"},
+            {"RES","RES 7, E","RES 7, E"},
+            {"RES","RES 7, H","RES 7, H"},
+            {"RES","RES 7, L","RES 7, L"},
+            {"RES","RES 7, [HL]","RES 7, [HL]"},
+            {"RES","RES 7, A","RES 7, A"},
+            {"SET","SET 0, B","SET 0, B"},
+            {"SET","SET 0, C","SET 0, C"},
+            {"SET","SET 0, D","SET 0, D"},
+            {"SET","SET 0, E","SET 0, E"},
+            {"SET","SET 0, H","SET 0, H"},
+            {"SET","SET 0, L","SET 0, L"},
+            {"SET","SET 0, [HL]","SET 0, [HL]"},
+            {"SET","SET 0, A","SET 0, A"},
+            {"SET","SET 1, B","SET 1, B"},
+            {"SET","SET 1, C","SET 1, C"},
+            {"SET","SET 1, D","SET 1, D"},
+            {"SET","SET 1, E","SET 1, E"},
+            {"SET","SET 1, H","SET 1, H"},
+            {"SET","SET 1, L","SET 1, L"},
+            {"SET","SET 1, [HL]","SET 1, [HL]"},
+            {"SET","SET 1, A","SET 1, A"},
+            {"SET","SET 2, B","SET 2, B"},
+            {"SET","SET 2, C","SET 2, C"},
+            {"SET","SET 2, D","SET 2, D"},
+            {"SET","SET 2, E","SET 2, E"},
+            {"SET","SET 2, H","SET 2, H"},
+            {"SET","SET 2, L","SET 2, L"},
+            {"SET","SET 2, [HL]","SET 2, [HL]"},
+            {"SET","SET 2, A","SET 2, A"},
+            {"SET","SET 3, B","SET 3, B"},
+            {"SET","SET 3, C","SET 3, C"},
+            {"SET","SET 3, D","SET 3, D"},
+            {"SET","SET 3, E","SET 3, E"},
+            {"SET","SET 3, H","SET 3, H"},
+            {"SET","SET 3, L","SET 3, L"},
+            {"SET","SET 3, [HL]","SET 3, [HL]"},
+            {"SET","SET 3, A","SET 3, A"},
+            {"SET","SET 4, B","SET 4, B"},
+            {"SET","SET 4, C","SET 4, C"},
+            {"SET","SET 4, D","SET 4, D"},
+            {"SET","SET 4, E","SET 4, E"},
+            {"SET","SET 4, H","SET 4, H"},
+            {"SET","SET 4, L","SET 4, L"},
+            {"SET","SET 4, [HL]","SET 4, [HL]"},
+            {"SET","SET 4, A","SET 4, A"},
+            {"SET","SET 5, B","SET 5, B"},
+            {"SET","SET 5, C","SET 5, C"},
+            {"SET","SET 5, D","SET 5, D"},
+            {"SET","SET 5, E","SET 5, E"},
+            {"SET","SET 5, H","SET 5, H"},
+            {"SET","SET 5, L","SET 5, L"},
+            {"SET","SET 5, [HL]","SET 5, [HL]"},
+            {"SET","SET 5, A","SET 5, A"},
+            {"SET","SET 6, B","SET 6, B"},
+            {"SET","SET 6, C","SET 6, C"},
+            {"SET","SET 6, D","SET 6, D"},
+            {"SET","SET 6, E","SET 6, E"},
+            {"SET","SET 6, H","SET 6, H"},
+            {"SET","SET 6, L","SET 6, L"},
+            {"SET","SET 6, [HL]","SET 6, [HL]"},
+            {"SET","SET 6, A","SET 6, A"},
+            {"SET","SET 7, B","SET 7, B"},
+            {"SET","SET 7, C","SET 7, C"},
+            {"SET","SET 7, D","SET 7, D"},
+            {"SET","SET 7, E","SET 7, E"},
+            {"SET","SET 7, H","SET 7, H"},
+            {"SET","SET 7, L","SET 7, L"},
+            {"SET","SET 7, [HL]","SET 7, [HL]"},
+            {"SET","SET 7, A","SET 7, A"}
+        }};
+
+        /// @brief Checks that every descriptor sits at the index of its opcode.
+        /// @return Table is consistent?
+        static constexpr bool is_consistent() noexcept{
+            for(std::size_t index = 0; index < table_size; ++index){
+                if(get_table_index(descriptors[index].opcode) != index){
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    static_assert(InstructionTableLR35902::is_consistent());
+
+}//namespace_mygbc
+
+#endif
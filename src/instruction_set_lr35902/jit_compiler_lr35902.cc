@@ -0,0 +1,471 @@
+#include "jit_compiler_lr35902.h" //JitCompilerLR35902
+#include <array> //std::array
+#include <algorithm> //std::max
+#include <cstring> //std::memcpy
+#include <initializer_list> //std::initializer_list
+#include <string> //std::to_string
+#include <vector> //std::vector
+#if defined(__x86_64__) && defined(__linux__)
+    #include <sys/mman.h> //mmap, mprotect, munmap
+#endif
+
+namespace mygbc{
+
+    namespace{
+        //Native code of a block
+        using CodeBuffer = std::vector<uint8_t>;
+
+        //Opcodes handled by the compiler
+        constexpr uint16_t opcode_nop = 0x00;
+        constexpr uint16_t opcode_halt = 0x76;
+
+        //Register field value of [HL] in the opcodes, B, C, D, E, H, L, [HL], A otherwise
+        constexpr uint8_t memory_operand = 6;
+
+        //Host register of each register field value, cl, dl, sil, r8b-r11b. Caller saved and addressable with a REX prefix,
+        //al and ah are scratch for the flags, rdi holds the state
+        constexpr std::array<uint8_t, 8> host_registers{2, 6, 8, 9, 10, 11, 0xFF, 1};
+
+        //Offset in JitStateLR35902 of each register field value
+        constexpr std::array<uint8_t, 8> state_offsets{
+            offsetof(JitStateLR35902, b), offsetof(JitStateLR35902, c), offsetof(JitStateLR35902, d), offsetof(JitStateLR35902, e),
+            offsetof(JitStateLR35902, h), offsetof(JitStateLR35902, l), 0xFF, offsetof(JitStateLR35902, a)
+        };
+
+        //ADD, ADC, SUB, SBC, AND, XOR, OR, CP => host op r/m8, r8 opcode and op r/m8, imm8 extension
+        constexpr std::array<uint8_t, 8> host_alu_opcodes{0x00, 0x10, 0x28, 0x18, 0x20, 0x30, 0x08, 0x38};
+        constexpr std::array<uint8_t, 8> host_alu_extensions{0, 2, 5, 3, 4, 6, 1, 7};
+
+        //Flag register masks
+        constexpr uint8_t zero_flag_mask = 0x80;
+        constexpr uint8_t sub_flag_mask = 0x40;
+        constexpr uint8_t half_carry_flag_mask = 0x20;
+        constexpr uint8_t carry_flag_mask = 0x10;
+
+        /// @brief Appends a 32-bit immidiate value.
+        /// @param code Code buffer
+        /// @param value Value to append
+        void emit_dword(CodeBuffer& code, const uint32_t value){
+            for(int byte = 0; byte < 4; ++byte){
+                code.push_back(static_cast<uint8_t>(value >> (byte * 8)));
+            }
+        }
+
+        /// @brief Appends the REX prefix of a byte sized operation.
+        /// @details Always emitted, without one sil would encode as dh.
+        /// @param code Code buffer
+        /// @param reg Host register in the reg field
+        /// @param rm Host register in the r/m field
+        void emit_rex(CodeBuffer& code, const uint8_t reg, const uint8_t rm){
+            code.push_back(static_cast<uint8_t>(0x40 | ((reg & 0x08) >> 1) | ((rm & 0x08) >> 3)));
+        }
+
+        /// @brief Appends a jump with a 32-bit displacement, to patch with patch_jump.
+        /// @param code Code buffer
+        /// @param opcode Opcode bytes of the jump
+        /// @return Offset of the rel32 to patch.
+        std::size_t emit_jump(CodeBuffer& code, std::initializer_list<uint8_t> opcode){
+            code.insert(code.end(), opcode);
+            emit_dword(code, 0);
+            return code.size() - 4;
+        }
+
+        /// @brief Points the rel32 of a jump at the given offset.
+        /// @param code Code buffer
+        /// @param rel32_offset Offset of the rel32
+        /// @param target Offset of the jump target
+        void patch_jump(CodeBuffer& code, const std::size_t rel32_offset, const std::size_t target){
+            const uint32_t displacement = static_cast<uint32_t>(static_cast<int32_t>(target) - static_cast<int32_t>(rel32_offset + 4));
+            for(int byte = 0; byte < 4; ++byte){
+                code[rel32_offset + byte] = static_cast<uint8_t>(displacement >> (byte * 8));
+            }
+        }
+
+        /// @brief Loads or stores every register between the state and the host registers.
+        /// @param code Code buffer
+        /// @param load Load into the host registers, store otherwise
+        void emit_register_transfer(CodeBuffer& code, const bool load){
+            for(uint8_t field = 0; field < host_registers.size(); ++field){
+                if(field == memory_operand){
+                    continue;
+                }
+                //mov reg8, [rdi + offset] / mov [rdi + offset], reg8
+                emit_rex(code, host_registers[field], 0);
+                code.push_back(load ? 0x8A : 0x88);
+                code.push_back(static_cast<uint8_t>(0x47 | ((host_registers[field] & 0x07) << 3)));
+                code.push_back(state_offsets[field]);
+            }
+        }
+
+        /// @brief Appends the budget check at the loop start: returns if the block could overshoot the budget.
+        /// @param code Code buffer
+        /// @param block_ticks Ticks of the most expensive path trough the block
+        /// @return Offset of the rel32 to patch with the return.
+        std::size_t emit_budget_check(CodeBuffer& code, const uint32_t block_ticks){
+            //cmp dword [rdi + 4], block_ticks
+            code.insert(code.end(), {0x81, 0x7F, 0x04});
+            emit_dword(code, block_ticks);
+            //jl return
+            return emit_jump(code, {0x0F, 0x8C});
+        }
+
+        /// @brief Appends the conversion of the host flags into the F register of the state.
+        /// @details Must directly follow the host operation. Host ZF, AF and CF match Z, H and C of the 8-bit operations.
+        /// @param code Code buffer
+        /// @param host_half_carry Take H from the host AF
+        /// @param host_carry Take C from the host CF
+        /// @param set_mask Flags set regardless of the result
+        /// @param keep_carry Keep C of the previous F, INC and DEC
+        void emit_flags(CodeBuffer& code, const bool host_half_carry, const bool host_carry, const uint8_t set_mask, const bool keep_carry){
+            //lahf, mov al, ah
+            code.insert(code.end(), {0x9F, 0x88, 0xE0});
+            //and al, ZF [| AF], add al, al: ZF (bit 6) => Z (bit 7), AF (bit 4) => H (bit 5)
+            code.insert(code.end(), {0x24, static_cast<uint8_t>(host_half_carry ? 0x50 : 0x40), 0x00, 0xC0});
+            if(host_carry){
+                //and ah, CF, shl ah, 4, or al, ah: CF (bit 0) => C (bit 4)
+                code.insert(code.end(), {0x80, 0xE4, 0x01, 0xC0, 0xE4, 0x04, 0x08, 0xE0});
+            }
+            if(set_mask != 0){
+                //or al, set_mask
+                code.insert(code.end(), {0x0C, set_mask});
+            }
+            if(keep_carry){
+                //mov ah, [rdi + 2], and ah, C, or al, ah
+                code.insert(code.end(), {0x8A, 0x67, 0x02, 0x80, 0xE4, carry_flag_mask, 0x08, 0xE0});
+            }
+            //mov [rdi + 2], al
+            code.insert(code.end(), {0x88, 0x47, 0x02});
+        }
+
+        /// @brief Is the opcode a INC r or DEC r?
+        /// @param opcode Opcode of the instruction
+        /// @return Register increment or decrement?
+        constexpr bool is_register_step(const uint16_t opcode){
+            return opcode < 0x40 && (opcode & 0x06) == 0x04 && ((opcode >> 3) & 0x07) != memory_operand;
+        }
+
+        /// @brief Is the opcode a LD r, n8?
+        /// @param opcode Opcode of the instruction
+        /// @return Immidiate register load?
+        constexpr bool is_immidiate_load(const uint16_t opcode){
+            return opcode < 0x40 && (opcode & 0x07) == 0x06 && ((opcode >> 3) & 0x07) != memory_operand;
+        }
+
+        /// @brief Is the opcode a LD r, r?
+        /// @param opcode Opcode of the instruction
+        /// @return Register to register load?
+        constexpr bool is_register_load(const uint16_t opcode){
+            return opcode >= 0x40 && opcode < 0x80 && (opcode & 0x07) != memory_operand && ((opcode >> 3) & 0x07) != memory_operand;
+        }
+
+        /// @brief Is the opcode a 8-bit ALU operation on A with a register or immidiate operand?
+        /// @param opcode Opcode of the instruction
+        /// @return Register or immidiate ALU operation?
+        constexpr bool is_alu_operation(const uint16_t opcode){
+            return (opcode >= 0x80 && opcode < 0xC0 && (opcode & 0x07) != memory_operand) ||
+                   (opcode >= 0xC0 && opcode < 0x100 && (opcode & 0x07) == 0x06);
+        }
+
+        /// @brief Can the instruction be compiled inside a block?
+        /// @param opcode Opcode of the instruction
+        /// @return Compilable body instruction?
+        constexpr bool is_compilable_operation(const uint16_t opcode){
+            return opcode == opcode_nop || is_register_step(opcode) || is_immidiate_load(opcode) ||
+                   (is_register_load(opcode) && opcode != opcode_halt) || is_alu_operation(opcode);
+        }
+
+        /// @brief Appends the native code of a body instruction.
+        /// @param code Code buffer
+        /// @param decoded_instruction Compilable body instruction
+        void emit_operation(CodeBuffer& code, const DecodedInstructionLR35902& decoded_instruction){
+            const uint16_t opcode = decoded_instruction.descriptor->opcode;
+            const uint8_t destination = host_registers[(opcode >> 3) & 0x07];
+            const uint8_t source = host_registers[opcode & 0x07];
+            const uint8_t accumilator = host_registers[7];
+            if(is_register_step(opcode)){
+                const bool decrement = opcode & 0x01;
+                //inc/dec reg8
+                emit_rex(code, 0, destination);
+                code.push_back(0xFE);
+                code.push_back(static_cast<uint8_t>(0xC0 | (decrement ? 0x08 : 0x00) | (destination & 0x07)));
+                emit_flags(code, true, false, decrement ? sub_flag_mask : 0, true);
+            }
+            else if(is_immidiate_load(opcode)){
+                //mov reg8, n8
+                emit_rex(code, 0, destination);
+                code.push_back(static_cast<uint8_t>(0xB0 | (destination & 0x07)));
+                code.push_back(decoded_instruction.unsigned_8brv());
+            }
+            else if(is_register_load(opcode)){
+                if(destination != source){
+                    //mov reg8, reg8
+                    emit_rex(code, source, destination);
+                    code.push_back(0x88);
+                    code.push_back(static_cast<uint8_t>(0xC0 | ((source & 0x07) << 3) | (destination & 0x07)));
+                }
+            }
+            else if(is_alu_operation(opcode)){
+                const uint8_t operation = (opcode >> 3) & 0x07;
+                if(operation == 1 || operation == 3){
+                    //ADC, SBC: mov al, [rdi + 2], shr al, 5 moves C into the host CF
+                    code.insert(code.end(), {0x8A, 0x47, 0x02, 0xC0, 0xE8, 0x05});
+                }
+                if(opcode >= 0xC0){
+                    //op reg8, n8
+                    emit_rex(code, 0, accumilator);
+                    code.push_back(0x80);
+                    code.push_back(static_cast<uint8_t>(0xC0 | (host_alu_extensions[operation] << 3) | (accumilator & 0x07)));
+                    code.push_back(decoded_instruction.unsigned_8brv());
+                }
+                else{
+                    //op reg8, reg8
+                    emit_rex(code, source, accumilator);
+                    code.push_back(host_alu_opcodes[operation]);
+                    code.push_back(static_cast<uint8_t>(0xC0 | ((source & 0x07) << 3) | (accumilator & 0x07)));
+                }
+                switch(operation){
+                    case 0: case 1: emit_flags(code, true, true, 0, false); break; //ADD, ADC
+                    case 2: case 3: case 7: emit_flags(code, true, true, sub_flag_mask, false); break; //SUB, SBC, CP
+                    case 4: emit_flags(code, false, false, half_carry_flag_mask, false); break; //AND
+                    default: emit_flags(code, false, false, 0, false); break; //XOR, OR
+                }
+            }
+        }
+
+        /// @brief Appends a block exit: subtracts the ticks from the budget, then sets pc and returns.
+        /// @details Exit back to the start of the block loops to the budget check instead, pc already holds the start.
+        /// @param code Code buffer
+        /// @param exit_pc Pc after the exit
+        /// @param exit_ticks Ticks spent reaching the exit
+        /// @param start_pc Start address of the block
+        /// @param loop_start Offset of the budget check
+        /// @param return_jumps Rel32 offsets of the jumps to the return, to patch
+        void emit_exit(CodeBuffer& code, const uint16_t exit_pc, const uint32_t exit_ticks, const uint16_t start_pc,
+                       const std::size_t loop_start, std::vector<std::size_t>& return_jumps){
+            //sub dword [rdi + 4], exit_ticks
+            code.insert(code.end(), {0x81, 0x6F, 0x04});
+            emit_dword(code, exit_ticks);
+            if(exit_pc == start_pc){
+                //jmp start
+                patch_jump(code, emit_jump(code, {0xE9}), loop_start);
+                return;
+            }
+            //mov word [rdi], exit_pc
+            code.insert(code.end(), {0x66, 0xC7, 0x07, static_cast<uint8_t>(exit_pc), static_cast<uint8_t>(exit_pc >> 8)});
+            //jmp return
+            return_jumps.push_back(emit_jump(code, {0xE9}));
+        }
+
+        /// @brief Is the opcode a JP a16 or JR e8 variant?
+        /// @param opcode Opcode of the instruction
+        /// @return Compilable jump?
+        bool is_compilable_jump(const uint16_t opcode){
+            switch(opcode){
+                case 0xC3: case 0xC2: case 0xCA: case 0xD2: case 0xDA: //JP [cc,] a16
+                case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: //JR [cc,] e8
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    /// @brief Initializes the compiler, executable memory is mapped on first compile.
+    JitCompilerLR35902::JitCompilerLR35902():code_buffer_(nullptr), code_buffer_used_(0){
+    }
+
+    /// @brief Unmaps the executable memory.
+    JitCompilerLR35902::~JitCompilerLR35902(){
+        #if defined(__x86_64__) && defined(__linux__)
+            if(code_buffer_ != nullptr){
+                munmap(code_buffer_, code_buffer_size);
+            }
+        #endif
+    }
+
+    /// @brief Can the block be compiled?
+    /// @param block Translated basic block
+    /// @return Block compilable?
+    bool JitCompilerLR35902::can_compile(const BasicBlockLR35902& block) noexcept{
+        if(block.operations.empty()){
+            return false;
+        }
+        for(std::size_t operation = 0; operation + 1 < block.operations.size(); ++operation){
+            if(!is_compilable_operation(block.operations[operation].decoded_instruction.descriptor->opcode)){
+                return false;
+            }
+        }
+        const uint16_t last_opcode = block.operations.back().decoded_instruction.descriptor->opcode;
+        return is_compilable_operation(last_opcode) || is_compilable_jump(last_opcode);
+    }
+
+    /// @brief Fetches the compiled code of the block starting at the given address.
+    /// @param address Start address of the block
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @return Compiled block or nullptr if not compiled or stale.
+    JitCompilerLR35902::CompiledBlock JitCompilerLR35902::lookup(const uint16_t address, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) const noexcept{
+        auto compiled_block = compiled_blocks_.find(address);
+        if(compiled_block == compiled_blocks_.end() || compiled_block->second.code == nullptr || !is_current(compiled_block->second, bank_tag, predecode_cache)){
+            return nullptr;
+        }
+        return compiled_block->second.code;
+    }
+
+    /// @brief Counts a execution of the block and compiles it once hot.
+    /// @param block Current basic block
+    /// @return Status of the compile, ok if not compiled yet.
+    Status JitCompilerLR35902::record_execution(const BasicBlockLR35902& block){
+        if(!is_supported() || !can_compile(block)){
+            return Status::ok_status();
+        }
+        CompiledEntry& entry = compiled_blocks_[block.start_address];
+        if(entry.bank_tag != block.bank_tag || entry.last_address != block.last_address ||
+           entry.start_page_write_generation != block.start_page_write_generation || entry.last_page_write_generation != block.last_page_write_generation){
+            //New or recompiled block, start counting again
+            entry = CompiledEntry{
+                nullptr, 0, block.bank_tag, block.start_address, block.last_address,
+                block.start_page_write_generation, block.last_page_write_generation
+            };
+        }
+        if(entry.code != nullptr || ++entry.executions < compile_threshold){
+            return Status::ok_status();
+        }
+        //Compile may flush the entries
+        StatusOr<CompiledBlock> compile_result = compile(block);
+        if(!compile_result.ok()){
+            return compile_result.status();
+        }
+        CompiledEntry& compiled_entry = compiled_blocks_[block.start_address];
+        compiled_entry = CompiledEntry{
+            compile_result.value(), compile_threshold, block.bank_tag, block.start_address, block.last_address,
+            block.start_page_write_generation, block.last_page_write_generation
+        };
+        return Status::ok_status();
+    }
+
+    /// @brief Compiles the block into native code.
+    /// @param block Current basic block
+    /// @return Compiled block or error status.
+    StatusOr<JitCompilerLR35902::CompiledBlock> JitCompilerLR35902::compile(const BasicBlockLR35902& block){
+        if(!can_compile(block)){
+            return Status::invalid_input_error(
+                "Block can't be compiled! Start address: " + std::to_string(block.start_address)
+            );
+        }
+        #if defined(__x86_64__) && defined(__linux__)
+            Status map_status = map_code_buffer();
+            if(!map_status.ok()){
+                return map_status;
+            }
+            //Body instructions have a single cost
+            uint32_t leading_ticks = 0;
+            for(std::size_t operation = 0; operation + 1 < block.operations.size(); ++operation){
+                leading_ticks += block.operations[operation].decoded_instruction.descriptor->t_cycles_costs[0];
+            }
+            const DecodedInstructionLR35902& last_instruction = block.operations.back().decoded_instruction;
+            const InstructionDescriptorLR35902& descriptor = *last_instruction.descriptor;
+            const uint16_t fallthrough_pc = block.last_address + 1;
+            const uint16_t start_pc = block.start_address;
+            CodeBuffer code;
+            std::vector<std::size_t> return_jumps;
+            emit_register_transfer(code, true);
+            const std::size_t loop_start = code.size();
+            return_jumps.push_back(emit_budget_check(
+                code, leading_ticks + std::max(descriptor.t_cycles_costs[0], descriptor.t_cycles_costs[1])
+            ));
+            for(std::size_t operation = 0; operation + 1 < block.operations.size(); ++operation){
+                emit_operation(code, block.operations[operation].decoded_instruction);
+            }
+            if(!is_compilable_jump(descriptor.opcode)){
+                emit_operation(code, last_instruction);
+                emit_exit(code, fallthrough_pc, leading_ticks + descriptor.t_cycles_costs[0], start_pc, loop_start, return_jumps);
+            }
+            else{
+                //JR is relative to the next instruction, JP takes the read value as is
+                const uint16_t jump_pc = (descriptor.read_value_size_in_bytes > 1) ?
+                    last_instruction.unsigned_16brv() : static_cast<uint16_t>(fallthrough_pc + last_instruction.signed_8brv());
+                if(descriptor.execution_condition != InstructionLR35902::ExecutionCondition::NONE){
+                    const bool zero_condition = descriptor.execution_condition == InstructionLR35902::ExecutionCondition::ZERO_SET ||
+                                                descriptor.execution_condition == InstructionLR35902::ExecutionCondition::ZERO_NOT_SET;
+                    const bool condition_on_set = descriptor.execution_condition == InstructionLR35902::ExecutionCondition::ZERO_SET ||
+                                                  descriptor.execution_condition == InstructionLR35902::ExecutionCondition::CARRY_SET;
+                    //test byte [rdi + 2], flag_mask
+                    code.insert(code.end(), {0xF6, 0x47, 0x02, zero_condition ? zero_flag_mask : carry_flag_mask});
+                    //jz/jnz over the taken exit
+                    const std::size_t condition_jump = emit_jump(code, {0x0F, static_cast<uint8_t>(condition_on_set ? 0x84 : 0x85)});
+                    emit_exit(code, jump_pc, leading_ticks + descriptor.t_cycles_costs[0], start_pc, loop_start, return_jumps);
+                    patch_jump(code, condition_jump, code.size());
+                    emit_exit(code, fallthrough_pc, leading_ticks + descriptor.t_cycles_costs[1], start_pc, loop_start, return_jumps);
+                }
+                else{
+                    emit_exit(code, jump_pc, leading_ticks + descriptor.t_cycles_costs[0], start_pc, loop_start, return_jumps);
+                }
+            }
+            //Budget spent leaves pc at the start of the block, every return stores the registers back
+            for(const std::size_t return_jump : return_jumps){
+                patch_jump(code, return_jump, code.size());
+            }
+            emit_register_transfer(code, false);
+            code.push_back(0xC3);
+            const std::size_t code_size = code.size();
+            if(code_size > code_buffer_size){
+                return Status::invalid_input_error(
+                    "Block too large to compile! Start address: " + std::to_string(block.start_address)
+                );
+            }
+            if(code_buffer_used_ + code_size > code_buffer_size){
+                flush();
+            }
+            //Write, then flip back to executable
+            if(mprotect(code_buffer_, code_buffer_size, PROT_READ | PROT_WRITE) != 0){
+                return Status::unkown_error("Could not make the code buffer writable!");
+            }
+            uint8_t* block_code = code_buffer_ + code_buffer_used_;
+            std::memcpy(block_code, code.data(), code_size);
+            code_buffer_used_ += code_size;
+            if(mprotect(code_buffer_, code_buffer_size, PROT_READ | PROT_EXEC) != 0){
+                return Status::unkown_error("Could not make the code buffer executable!");
+            }
+            return reinterpret_cast<CompiledBlock>(block_code);
+        #else
+            return Status::unkown_error("Compiling is not supported on this host!");
+        #endif
+    }
+
+    /// @brief Drops every compiled block and resets the code buffer.
+    void JitCompilerLR35902::flush() noexcept{
+        compiled_blocks_.clear();
+        code_buffer_used_ = 0;
+    }
+
+    /// @brief Checks that the memory the entry was compiled from is unchanged.
+    /// @param entry Compiled entry
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param predecode_cache Predecode cache attached to the memory controller
+    /// @return Entry is current?
+    bool JitCompilerLR35902::is_current(const CompiledEntry& entry, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) noexcept{
+        return entry.bank_tag == bank_tag &&
+               entry.start_page_write_generation == predecode_cache.get_page_write_generation(entry.start_address) &&
+               entry.last_page_write_generation == predecode_cache.get_page_write_generation(entry.last_address);
+    }
+
+    /// @brief Maps the executable code buffer if not mapped.
+    /// @return Status of the mapping.
+    Status JitCompilerLR35902::map_code_buffer(){
+        #if defined(__x86_64__) && defined(__linux__)
+            if(code_buffer_ == nullptr){
+                void* mapping = mmap(nullptr, code_buffer_size, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if(mapping == MAP_FAILED){
+                    return Status::unkown_error("Could not map the code buffer!");
+                }
+                code_buffer_ = static_cast<uint8_t*>(mapping);
+                code_buffer_used_ = 0;
+            }
+            return Status::ok_status();
+        #else
+            return Status::unkown_error("Compiling is not supported on this host!");
+        #endif
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,138 @@
+#ifndef JIT_COMPILER_LR35902_H
+#define JIT_COMPILER_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <cstddef> //std::size_t
+#include <unordered_map> //std::unordered_map
+#include "basic_block_lr35902.h" //BasicBlockLR35902
+#include "predecode_cache_lr35902.h" //PredecodeCacheLR35902
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Cpu state passed to and updated by the compiled blocks.
+    /// @details The 8-bit registers are loaded into host registers on entry and stored back on every return.
+    struct JitStateLR35902{
+        uint16_t pc; //Program counter, start of the block on entry, set to the exit address of the block
+        uint8_t f; //Flag register, materialized, read by conditional exits and rewritten by every flag producing operation
+        uint8_t a; //Accumilator
+        int32_t cycle_budget; //Remaining ticks, the ticks of the taken exit are subtracted
+        uint8_t b;
+        uint8_t c;
+        uint8_t d;
+        uint8_t e;
+        uint8_t h;
+        uint8_t l;
+    };
+
+    static_assert(offsetof(JitStateLR35902, pc) == 0);
+    static_assert(offsetof(JitStateLR35902, f) == 2);
+    static_assert(offsetof(JitStateLR35902, a) == 3);
+    static_assert(offsetof(JitStateLR35902, cycle_budget) == 4);
+    static_assert(offsetof(JitStateLR35902, b) == 8);
+    static_assert(offsetof(JitStateLR35902, l) == 13);
+
+    /// @brief Compiles hot basic blocks into native x86-64 code.
+    /// @details Blocks of NOPs, LD r, r / LD r, n8, the register and immidiate 8-bit ALU operations and INC r / DEC r,
+    ///          ending in a JP a16, JR e8 or falling trough, are compiled. Everything touching memory or the 16-bit registers
+    ///          is left for the threaded-code backend. A, B, C, D, E, H and L live in caller saved host registers for the
+    ///          whole block, the flags are taken from the host flags right after each ALU operation. Compiled blocks are
+    ///          validated like basic blocks, against the contents tag and the write generations of the predecode cache.
+    ///          Available on x86-64 Linux only, see is_supported.
+    ///          Compiled code checks the cycle budget on entry and on every exit back to its own start: it returns without
+    ///          running once the most expensive path trough the block could overshoot the budget, so self loops spin natively
+    ///          up to the budget.
+    class JitCompilerLR35902{
+        public:
+
+        //Compiled block, called with the cpu state
+        using CompiledBlock = void(*)(JitStateLR35902*);
+
+        //Executions of a compilable block before it is compiled
+        static constexpr uint32_t compile_threshold = 16;
+
+        //Size of the executable code buffer in bytes
+        static constexpr std::size_t code_buffer_size = 0x10000;
+
+        /// @brief Initializes the compiler, executable memory is mapped on first compile.
+        JitCompilerLR35902();
+
+        /// @brief Unmaps the executable memory.
+        ~JitCompilerLR35902();
+
+        //Owns the executable mapping
+        JitCompilerLR35902(const JitCompilerLR35902&) = delete;
+        JitCompilerLR35902& operator=(const JitCompilerLR35902&) = delete;
+
+        /// @brief Can blocks be compiled on this host?
+        /// @return Compiling supported?
+        static constexpr bool is_supported() noexcept{
+            #if defined(__x86_64__) && defined(__linux__)
+                return true;
+            #else
+                return false;
+            #endif
+        }
+
+        /// @brief Can the block be compiled?
+        /// @param block Translated basic block
+        /// @return Block compilable?
+        static bool can_compile(const BasicBlockLR35902& block) noexcept;
+
+        /// @brief Fetches the compiled code of the block starting at the given address.
+        /// @param address Start address of the block
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @return Compiled block or nullptr if not compiled or stale.
+        CompiledBlock lookup(const uint16_t address, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) const noexcept;
+
+        /// @brief Counts a execution of the block and compiles it once hot.
+        /// @param block Current basic block
+        /// @return Status of the compile, ok if not compiled yet.
+        Status record_execution(const BasicBlockLR35902& block);
+
+        /// @brief Compiles the block into native code.
+        /// @param block Current basic block
+        /// @return Compiled block or error status.
+        StatusOr<CompiledBlock> compile(const BasicBlockLR35902& block);
+
+        /// @brief Drops every compiled block and resets the code buffer.
+        void flush() noexcept;
+
+        private:
+
+        //Compiled block and the memory state it was compiled from
+        struct CompiledEntry{
+            CompiledBlock code;
+            uint32_t executions;
+            uint64_t bank_tag;
+            uint16_t start_address;
+            uint16_t last_address;
+            uint32_t start_page_write_generation;
+            uint32_t last_page_write_generation;
+        };
+
+        /// @brief Checks that the memory the entry was compiled from is unchanged.
+        /// @param entry Compiled entry
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param predecode_cache Predecode cache attached to the memory controller
+        /// @return Entry is current?
+        static bool is_current(const CompiledEntry& entry, const uint64_t bank_tag, const PredecodeCacheLR35902& predecode_cache) noexcept;
+
+        /// @brief Maps the executable code buffer if not mapped.
+        /// @return Status of the mapping.
+        Status map_code_buffer();
+
+        //Start address => compiled entry
+        std::unordered_map<uint16_t, CompiledEntry> compiled_blocks_;
+
+        //Executable code buffer, nullptr until first compile
+        uint8_t* code_buffer_;
+
+        //Bytes of the code buffer in use
+        std::size_t code_buffer_used_;
+    };
+
+}//namespace_mygbc
+
+#endif
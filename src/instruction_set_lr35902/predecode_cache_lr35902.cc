@@ -0,0 +1,84 @@
+#include "predecode_cache_lr35902.h" //PredecodeCacheLR35902
+
+namespace mygbc{
+
+    /// @brief Fetches the cached instruction at the given address.
+    /// @param address Address of the instruction
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @return Cached instruction or nullptr if not present.
+    const DecodedInstructionLR35902* PredecodeCacheLR35902::lookup(const uint16_t address, const uint64_t bank_tag) const noexcept{
+        const Page* page = pages_[address / page_size].get();
+        if(page == nullptr){
+            return nullptr;
+        }
+        const Entry& entry = (*page)[address % page_size];
+        if(entry.tag != bank_tag + 1){
+            return nullptr;
+        }
+        return &entry.decoded_instruction;
+    }
+
+    /// @brief Stores the decoded instruction at the given address.
+    /// @details Allocates the page of the address on first use.
+    /// @param address Address of the instruction
+    /// @param bank_tag Tag of the currently mapped bank
+    /// @param decoded_instruction Decoded instruction
+    void PredecodeCacheLR35902::store(const uint16_t address, const uint64_t bank_tag, const DecodedInstructionLR35902& decoded_instruction){
+        std::unique_ptr<Page>& page = pages_[address / page_size];
+        if(page == nullptr){
+            //Value initialized, every entry empty
+            page = std::make_unique<Page>();
+        }
+        (*page)[address % page_size] = Entry{decoded_instruction, bank_tag + 1};
+    }
+
+    /// @brief Invalidates every entry containing the given range of bytes.
+    /// @param address Start of the range
+    /// @param size_in_bytes Size of the range in bytes
+    void PredecodeCacheLR35902::invalidate(const uint16_t address, const uint16_t size_in_bytes) noexcept{
+        //Instruction starting before the range may still overlap it
+        uint16_t entry_address = address - (max_instruction_size_in_bytes - 1);
+        const uint16_t entry_count = size_in_bytes + (max_instruction_size_in_bytes - 1);
+        for(uint16_t entry = 0; entry < entry_count; ++entry, ++entry_address){
+            Page* page = pages_[entry_address / page_size].get();
+            if(page != nullptr){
+                (*page)[entry_address % page_size].tag = 0;
+            }
+            //Once per page
+            if(entry == 0 || entry_address % page_size == 0){
+                ++page_write_generations_[entry_address / page_size];
+            }
+        }
+    }
+
+    /// @brief Invalidates every entry in the cache.
+    /// @details Pages stay allocated.
+    void PredecodeCacheLR35902::invalidate_all() noexcept{
+        for(uint32_t& page_write_generation : page_write_generations_){
+            ++page_write_generation;
+        }
+        for(std::unique_ptr<Page>& page : pages_){
+            if(page != nullptr){
+                for(Entry& entry : *page){
+                    entry.tag = 0;
+                }
+            }
+        }
+    }
+
+    /// @brief Invalidates the entries containing the written bytes.
+    /// @param addr Zero based address of the write.
+    /// @param size_in_bytes Size of the write in bytes.
+    void PredecodeCacheLR35902::on_memory_write(const uint16_t addr, const uint16_t size_in_bytes) noexcept{
+        invalidate(addr, size_in_bytes);
+    }
+
+    /// @brief Returns the write generation of the page holding the address.
+    /// @details Changes every time entries of the page are invalidated. Used to validate data derived from the page.
+    /// @param address Address within the page
+    /// @return Write generation of the page.
+    uint32_t PredecodeCacheLR35902::get_page_write_generation(const uint16_t address) const noexcept{
+        return page_write_generations_[address / page_size];
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,86 @@
+#ifndef PREDECODE_CACHE_LR35902_H
+#define PREDECODE_CACHE_LR35902_H
+
+#include <cstdint> //Fixed lenght variables
+#include <cstddef> //std::size_t
+#include <array> //std::array
+#include <memory> //std::unique_ptr
+#include "decoded_instruction_lr35902.h" //DecodedInstructionLR35902
+#include "../memory/memory_write_observer.h" //MemoryWriteObserver
+
+namespace mygbc{
+
+    /// @brief Cache of decoded instructions indexed by address.
+    /// @details Entries are tagged with the contents tag of the memory controller they were decoded from and miss when the tag differs.
+    ///          Address space is split into 256 byte pages which are allocated on first store.
+    ///          Writes reported through MemoryWriteObserver invalidate every entry the written bytes belong to.
+    class PredecodeCacheLR35902 : public MemoryWriteObserver{
+        public:
+
+        //Size of a single page in entries
+        static constexpr std::size_t page_size = 0x100;
+
+        //Amount of pages covering the address space
+        static constexpr std::size_t page_count = 0x100;
+
+        //Longest instruction in bytes. Write may hit a instruction starting this many bytes - 1 before it.
+        static constexpr uint16_t max_instruction_size_in_bytes = 3;
+
+        /// @brief Initializes a empty cache.
+        PredecodeCacheLR35902() = default;
+
+        /// @brief Fetches the cached instruction at the given address.
+        /// @param address Address of the instruction
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @return Cached instruction or nullptr if not present.
+        const DecodedInstructionLR35902* lookup(const uint16_t address, const uint64_t bank_tag) const noexcept;
+
+        /// @brief Stores the decoded instruction at the given address.
+        /// @details Allocates the page of the address on first use.
+        /// @param address Address of the instruction
+        /// @param bank_tag Tag of the currently mapped bank
+        /// @param decoded_instruction Decoded instruction
+        void store(const uint16_t address, const uint64_t bank_tag, const DecodedInstructionLR35902& decoded_instruction);
+
+        /// @brief Invalidates every entry containing the given range of bytes.
+        /// @param address Start of the range
+        /// @param size_in_bytes Size of the range in bytes
+        void invalidate(const uint16_t address, const uint16_t size_in_bytes) noexcept;
+
+        /// @brief Invalidates every entry in the cache.
+        /// @details Pages stay allocated.
+        void invalidate_all() noexcept;
+
+        /// @brief Invalidates the entries containing the written bytes.
+        /// @param addr Zero based address of the write.
+        /// @param size_in_bytes Size of the write in bytes.
+        void on_memory_write(const uint16_t addr, const uint16_t size_in_bytes) noexcept override;
+
+        /// @brief Returns the write generation of the page holding the address.
+        /// @details Changes every time entries of the page are invalidated. Used to validate data derived from the page.
+        /// @param address Address within the page
+        /// @return Write generation of the page.
+        uint32_t get_page_write_generation(const uint16_t address) const noexcept;
+
+        private:
+
+        //Cached instruction
+        struct Entry{
+            DecodedInstructionLR35902 decoded_instruction;
+            //Bank tag + 1, 0 marks a empty entry
+            uint64_t tag;
+        };
+
+        //Entries of a single page
+        using Page = std::array<Entry, page_size>;
+
+        //Address => page, nullptr until first store
+        std::array<std::unique_ptr<Page>, page_count> pages_;
+
+        //Bumped every time entries of the page are invalidated
+        std::array<uint32_t, page_count> page_write_generations_{};
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -1,6 +1,7 @@
 #include <iostream> //std::cout
 #include "util/io/binary_reader.h" //BinaryReader
 #include "memory/gbc_binary.h" //GBCBinary
+#include "memory/rom_cache.h" //RomCache
 #include "instruction_set_lr35902/instruction_decoder_lr35902.h" //InstructionDecoderLR35902
 #include "util/io/logger.h"//Logger
 #include "gbc.h" //GBC
@@ -17,11 +18,10 @@ int main(int argc, char* argv[]){
     if(argc > 1){
             const std::string file_path = argv[1];
             std::cout << "Reading " << file_path << " as a binary!" << "\n";
-            mygbc::StatusOr<std::vector<uint8_t>> buffer_read = mygbc::BinaryReader::read_as_bytes(file_path);
-            if(buffer_read.ok()){ // No error
-                std::vector<uint8_t> buffer = std::move(buffer_read).value();
-                std::cout << "Read " << buffer.size() << " bytes from " << file_path << "!\n";
-                mygbc::StatusOr<mygbc::GBCBinary> gbc_binary_read = mygbc::GBCBinary::parse_bytes(buffer);
+            mygbc::StatusOr<std::shared_ptr<const mygbc::MappedFile>> binary_map = mygbc::BinaryReader::map_as_bytes(file_path);
+            if(binary_map.ok()){ // No error
+                std::cout << "Mapped " << binary_map.value()->get_size() << " bytes from " << file_path << "!\n";
+                mygbc::StatusOr<mygbc::GBCBinary> gbc_binary_read = mygbc::RomCache::instance().get_binary(std::move(binary_map).value());
                 if(gbc_binary_read.ok()){
                     mygbc::GBCBinary gbc_binary = std::move(gbc_binary_read).value();
                     std::cout << "Parsed binary successfully!\n\n" << gbc_binary.to_string() << "\n";
@@ -4,16 +4,37 @@
 namespace mygbc{
 
     /// @brief Default constructor
-    /// @details Default constructor, empty memory, sets read only flag to false.
-    AddressableMemory::AddressableMemory():read_only_memory_(false) {
+    /// @details Default constructor, empty memory, sets read only flag to false. Single owner.
+    AddressableMemory::AddressableMemory():read_only_memory_(false), direct_pointer_generation_(0) {
     }
 
     /// @brief Setter constructor, sets read only flag to false.
     /// @details Setter constructor, sets read only flag to false.
     /// @param memory Contents of the addressable memory
     /// @param read_only Is the memory read only?
-    AddressableMemory::AddressableMemory(const std::vector<uint8_t> & memory, const bool read_only)
-    :memory_(memory), read_only_memory_(read_only), memory_mutex_(std::make_shared<std::shared_mutex>()){
+    /// @param threading_policy Synchronization of the accesses
+    AddressableMemory::AddressableMemory(const std::vector<uint8_t> & memory, const bool read_only, const ThreadingPolicy threading_policy)
+    :memory_(memory), read_only_memory_(read_only),
+    memory_mutex_(threading_policy == ThreadingPolicy::CONCURRENT_OBSERVER ? std::make_shared<std::shared_mutex>() : nullptr),
+    dirty_pages_(read_only ? 0 : memory.size()), direct_pointer_generation_(0){
+    }
+
+    /// @brief Returns the threading policy of the memory.
+    /// @return Synchronization of the accesses.
+    AddressableMemory::ThreadingPolicy AddressableMemory::get_threading_policy() const noexcept{
+        return (memory_mutex_ != nullptr) ? ThreadingPolicy::CONCURRENT_OBSERVER : ThreadingPolicy::SINGLE_OWNER;
+    }
+
+    /// @brief Takes a shared lock on the memory if concurrently observed.
+    /// @return Lock, owns nothing for single owner memory.
+    std::shared_lock<std::shared_mutex> AddressableMemory::lock_for_read() const{
+        return (memory_mutex_ != nullptr) ? std::shared_lock<std::shared_mutex>(*memory_mutex_) : std::shared_lock<std::shared_mutex>();
+    }
+
+    /// @brief Takes a exclusive lock on the memory if concurrently observed.
+    /// @return Lock, owns nothing for single owner memory.
+    std::unique_lock<std::shared_mutex> AddressableMemory::lock_for_write() const{
+        return (memory_mutex_ != nullptr) ? std::unique_lock<std::shared_mutex>(*memory_mutex_) : std::unique_lock<std::shared_mutex>();
     }
 
     /// @brief Returns the read only memory flag.
@@ -23,12 +44,95 @@ namespace mygbc{
         return read_only_memory_;
     }
 
+    /// @brief Returns a pointer to the byte at the given address for direct reads.
+    /// @details Pointer stays valid until the memory is resized or freed.
+    /// @param addr Zero based address.
+    /// @return Pointer to the byte or nullptr if out of range or concurrently observed.
+    const uint8_t* AddressableMemory::get_direct_read_pointer(const uint16_t addr) noexcept{
+        return (addr >= memory_.size() || memory_mutex_ != nullptr) ? nullptr : memory_.data() + addr;
+    }
+
+    /// @brief Returns a pointer to the byte at the given address for direct writes.
+    /// @details Pointer stays valid until the memory is resized or freed.
+    /// @param addr Zero based address.
+    /// @return Pointer to the byte or nullptr if out of range, not at a page start, read only or concurrently observed.
+    uint8_t* AddressableMemory::get_direct_write_pointer(const uint16_t addr) noexcept{
+        //Direct writes are tracked trough the flag of a single page
+        return (get_dirty_page_flag(addr) == nullptr) ? nullptr : memory_.data() + addr;
+    }
+
+    /// @brief Returns the dirty flag of the page starting at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer to the flag or nullptr if not at a page start, read only or concurrently observed.
+    uint8_t* AddressableMemory::get_dirty_page_flag(const uint16_t addr) noexcept{
+        return (addr >= memory_.size() || is_read_only() || memory_mutex_ != nullptr) ? nullptr : dirty_pages_.get_page_flag(addr);
+    }
+
+    /// @brief Returns the counter of the direct pointer generation, bumped by set_memory and free.
+    /// @return Counter of the direct pointer generation.
+    const uint32_t* AddressableMemory::get_direct_pointer_generation_counter() const noexcept{
+        return &direct_pointer_generation_;
+    }
+
+    /// @brief Returns a view of the whole memory for bulk reads without copying.
+    /// @details View stays valid until the memory is resized or freed.
+    /// @return View of the memory or empty view if concurrently observed.
+    std::span<const uint8_t> AddressableMemory::get_read_view() noexcept{
+        return (memory_mutex_ != nullptr) ? std::span<const uint8_t>() : std::span<const uint8_t>(memory_);
+    }
+
+    /// @brief Returns a view of the whole memory for bulk writes without copying.
+    /// @details View stays valid until the memory is resized or freed. Marks every page dirty.
+    /// @return View of the memory or empty view if read only or concurrently observed.
+    std::span<uint8_t> AddressableMemory::get_write_view() noexcept{
+        if(is_read_only() || memory_mutex_ != nullptr){
+            return std::span<uint8_t>();
+        }
+        //Writes trough the view are not seen, assume all of them happen
+        dirty_pages_.mark_all();
+        return std::span<uint8_t>(memory_);
+    }
+
+    /// @brief Clones the memory for a forked instance.
+    /// @details Contents are copied. Dirty pages and threading policy are carried over.
+    ///          Derived memories with more state override it.
+    /// @param clones Clones made during the same fork
+    /// @return Copy of the memory.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> AddressableMemory::clone(MemoryCloneMap& clones){
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
+        std::shared_ptr<AddressableMemory> memory_clone = std::make_shared<AddressableMemory>(memory_, read_only_memory_, get_threading_policy());
+        memory_clone->dirty_pages_ = dirty_pages_;
+        return std::shared_ptr<SystemMemoryInterface>(std::move(memory_clone));
+    }
+
+    /// @brief Returns the indices of the pages written since the last clear.
+    /// @details Page covers the bytes from index * DirtyPageTracker::page_size, read only memory has no dirty pages.
+    /// @return Dirty page indices in ascending order.
+    std::vector<uint16_t> AddressableMemory::get_dirty_pages() const{
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
+        return dirty_pages_.get_dirty_pages();
+    }
+
+    /// @brief Is the page written since the last clear?
+    /// @param page Index of the page
+    /// @return Page dirty?
+    bool AddressableMemory::is_page_dirty(const std::size_t page) const{
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
+        return dirty_pages_.is_dirty(page);
+    }
+
+    /// @brief Marks every page clean, taken as the new checkpoint.
+    void AddressableMemory::clear_dirty_pages(){
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
+        dirty_pages_.clear();
+    }
+
     /// @brief Returns the byte located at the given address.
     /// @details Returns the byte located at the given address. Address is zero-based indexed. 
     /// @param addr Zero based address.
     /// @return byte value located at the given address or error Status.
     StatusOr<uint8_t> AddressableMemory::get_byte(const uint16_t addr) noexcept{
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
         if(addr < memory_.size()){
             return memory_[addr];
         }
@@ -43,12 +147,11 @@ namespace mygbc{
     /// @param addr Zero based address.
     /// @return Word value located at the given address or error Status.
     StatusOr<uint16_t> AddressableMemory::get_word(const uint16_t addr) noexcept{
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
         const uint16_t byte_one_addr = addr;
-        const uint16_t byte_two_addr = addr + 1;
-        if(byte_two_addr < memory_.size()){
-            uint16_t val = (static_cast<uint16_t>(memory_[byte_two_addr]) << 8) | static_cast<uint16_t>(memory_[byte_one_addr]);
-            return Util::nthos16_t(val);
+        //Last address must not wrap around to the start
+        if(static_cast<std::size_t>(byte_one_addr) + 1 < memory_.size()){
+            return Util::load_little_endian_word(memory_.data() + byte_one_addr);
         }
         return Status::invalid_index_error(
             "Invalid address given for word read! Can't access memory at address(Addr: " + 
@@ -60,14 +163,14 @@ namespace mygbc{
     /// @details Returns copy of the memory.
     /// @return copy of the memory.
     std::vector<uint8_t> AddressableMemory::get_memory(){
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
         return memory_;
     }
 
     /// @brief Returns the current size of the memory in bytes
     /// @return Size of the memory in bytes.
     std::size_t AddressableMemory::get_memory_size(){
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
         return memory_.size();
     }
 
@@ -77,10 +180,11 @@ namespace mygbc{
     /// @param value Byte, New value.
     /// @return Returns status of the set
     Status AddressableMemory::set_byte(const uint16_t addr, const uint8_t value) noexcept{
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
         if(addr < memory_.size()){
             if(!is_read_only()){
                 memory_[addr] = value;
+                dirty_pages_.mark(addr);
                 return Status::ok_status();
             }
             return Status::protected_memory_set_error("Tried to set memory when is_read_only flag was set!");
@@ -97,15 +201,13 @@ namespace mygbc{
     /// @param value Word, New value.
     /// @return Returns status of the set
     Status AddressableMemory::set_word(const uint16_t addr, const uint16_t value) noexcept{
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
         const uint16_t first_byte_addr = addr;
-        const uint16_t second_byte_addr = addr + 1;
-        if(second_byte_addr < memory_.size()){
+        //Last address must not wrap around to the start
+        if(static_cast<std::size_t>(first_byte_addr) + 1 < memory_.size()){
             if(!is_read_only()){
-                //Copy each byte at time
-                const uint8_t * byte_ptr = reinterpret_cast<const uint8_t*>(&value);
-                memory_[first_byte_addr] = byte_ptr[1];
-                memory_[second_byte_addr] = byte_ptr[0];
+                Util::store_little_endian_word(memory_.data() + first_byte_addr, value);
+                dirty_pages_.mark_range(first_byte_addr, 2);
                 return Status::ok_status();
             }
             return Status::protected_memory_set_error("Tried to set memory when is_read_only flag was set!");
@@ -121,9 +223,11 @@ namespace mygbc{
     /// @param contents new contents of the memory
     /// @return Returns status of the set
     Status AddressableMemory::set_memory(const std::vector<uint8_t>& contents) noexcept{
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
         if(!is_read_only()){
             memory_ = contents;
+            dirty_pages_.reset(memory_.size());
+            ++direct_pointer_generation_;
             return Status::ok_status();
         }
         return Status::protected_memory_set_error("Tried to set total memory when is_read_only flag was set!");
@@ -132,9 +236,11 @@ namespace mygbc{
     /// @brief Frees the memory assosiated with the memory object.
     /// @details Frees the memory assosiated with the memory object.
     void AddressableMemory::free(){
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
         memory_.clear();
         memory_.shrink_to_fit();
+        dirty_pages_ = DirtyPageTracker();
+        ++direct_pointer_generation_;
     }
 
 }//namespace_mygbc
\ No newline at end of file
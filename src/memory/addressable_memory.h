@@ -1,12 +1,14 @@
 #ifndef ADDRESSABLE_MEMORY_H
 #define ADDRESSABLE_MEMORY_H
 
+#include <span> //std::span
 #include <vector> //std::vector
 #include <mutex> //std::unique_lock
 #include <memory> //std::shared_ptr
 #include <cstdint> //Fixed lenght variables
 #include <shared_mutex> //std::shared_mutex
 #include "system_memory_interface.h"
+#include "dirty_page_tracker.h" //DirtyPageTracker
 #include "../util/status/status.h" //Status
 #include "../util/status/status_or.h" //StatusOr
 
@@ -15,18 +17,27 @@ namespace mygbc{
 
     /// @brief Interface class for all addressable memory.
     /// @details Interface class for all addressable memory. Contains functionality for read only memory.
+    ///          Threading policy is picked at construction, single owner memory does no locking.
+    ///          Writable memory tracks the pages written since the last clear, in pages of DirtyPageTracker::page_size.
     class AddressableMemory : public SystemMemoryInterface{
         public:
 
+        //Synchronization of the accesses
+        enum class ThreadingPolicy : uint8_t{
+            SINGLE_OWNER = 0, //Accessed by the owning thread only, no locking
+            CONCURRENT_OBSERVER = 1 //Read by other threads while owned, every access locked and no direct pointers
+        };
+
         /// @brief Default constructor
-        /// @details Default constructor, empty memory, sets read only flag to false.
+        /// @details Default constructor, empty memory, sets read only flag to false. Single owner.
         AddressableMemory();
 
         /// @brief Setter constructor, sets read only flag to false.
         /// @details Setter constructor, sets read only flag to false.
         /// @param memory Contents of the addressable memory
         /// @param read_only Is the memory read only?
-        AddressableMemory(const std::vector<uint8_t> & memory, const bool read_only);
+        /// @param threading_policy Synchronization of the accesses
+        AddressableMemory(const std::vector<uint8_t> & memory, const bool read_only, const ThreadingPolicy threading_policy = ThreadingPolicy::SINGLE_OWNER);
         
         /// @brief Returns the byte located at the given address.
         /// @details Returns the byte located at the given address. Address is zero-based indexed. 
@@ -73,21 +84,90 @@ namespace mygbc{
         /// @details Frees the memory assosiated with the memory object.
         void free();
 
+        /// @brief Returns a pointer to the byte at the given address for direct reads.
+        /// @details Pointer stays valid until the memory is resized or freed.
+        /// @param addr Zero based address.
+        /// @return Pointer to the byte or nullptr if out of range or concurrently observed.
+        const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override;
+
+        /// @brief Returns a pointer to the byte at the given address for direct writes.
+        /// @details Pointer stays valid until the memory is resized or freed.
+        /// @param addr Zero based address.
+        /// @return Pointer to the byte or nullptr if out of range, not at a page start, read only or concurrently observed.
+        uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept override;
+
+        /// @brief Returns the dirty flag of the page starting at the given address.
+        /// @param addr Zero based address.
+        /// @return Pointer to the flag or nullptr if not at a page start, read only or concurrently observed.
+        uint8_t* get_dirty_page_flag(const uint16_t addr) noexcept override;
+
+        /// @brief Returns the counter of the direct pointer generation, bumped by set_memory and free.
+        /// @return Counter of the direct pointer generation.
+        const uint32_t* get_direct_pointer_generation_counter() const noexcept override;
+
+        /// @brief Returns a view of the whole memory for bulk reads without copying.
+        /// @details View stays valid until the memory is resized or freed.
+        /// @return View of the memory or empty view if concurrently observed.
+        std::span<const uint8_t> get_read_view() noexcept override;
+
+        /// @brief Returns a view of the whole memory for bulk writes without copying.
+        /// @details View stays valid until the memory is resized or freed. Marks every page dirty.
+        /// @return View of the memory or empty view if read only or concurrently observed.
+        std::span<uint8_t> get_write_view() noexcept override;
+
+        /// @brief Clones the memory for a forked instance.
+        /// @details Contents are copied. Dirty pages and threading policy are carried over.
+        ///          Derived memories with more state override it.
+        /// @param clones Clones made during the same fork
+        /// @return Copy of the memory.
+        StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+
+        /// @brief Returns the indices of the pages written since the last clear.
+        /// @details Page covers the bytes from index * DirtyPageTracker::page_size, read only memory has no dirty pages.
+        /// @return Dirty page indices in ascending order.
+        std::vector<uint16_t> get_dirty_pages() const;
+
+        /// @brief Is the page written since the last clear?
+        /// @param page Index of the page
+        /// @return Page dirty?
+        bool is_page_dirty(const std::size_t page) const;
+
+        /// @brief Marks every page clean, taken as the new checkpoint.
+        void clear_dirty_pages();
+
+        /// @brief Returns the threading policy of the memory.
+        /// @return Synchronization of the accesses.
+        ThreadingPolicy get_threading_policy() const noexcept;
+
         /// @brief Returns the read only memory flag.
         /// @details Returns the read only memory flag.
         /// @return The read only memory flag.
         bool is_read_only() const noexcept;
 
         protected:
+            /// @brief Takes a shared lock on the memory if concurrently observed.
+            /// @return Lock, owns nothing for single owner memory.
+            std::shared_lock<std::shared_mutex> lock_for_read() const;
+
+            /// @brief Takes a exclusive lock on the memory if concurrently observed.
+            /// @return Lock, owns nothing for single owner memory.
+            std::unique_lock<std::shared_mutex> lock_for_write() const;
+
             //Binary bytes
             std::vector<uint8_t> memory_;
 
             //Read only memory flag (ROM/RAM)
             const bool read_only_memory_;
 
-            //Read/Write mutex. shared_ptr so its movable
+            //Read/Write mutex, nullptr for single owner memory. shared_ptr so its movable
             std::shared_ptr<std::shared_mutex> memory_mutex_;
 
+            //Pages written since the last clear, tracks nothing for read only memory
+            DirtyPageTracker dirty_pages_;
+
+            //Bumped when the bytes or the dirty flags may have moved
+            uint32_t direct_pointer_generation_;
+
     };
 
 }//namespace_mygbc
@@ -0,0 +1,199 @@
+#include "arena_memory.h" //ArenaMemory
+#include <string> //std::to_string
+#include <algorithm> //std::min
+
+namespace mygbc{
+
+    /// @brief Views the whole region.
+    /// @param arena Arena holding the region
+    /// @param region Index of the region in the layout
+    ArenaMemory::ArenaMemory(std::shared_ptr<MemoryArena> arena, const std::size_t region)
+    :ArenaMemory(arena, region, 0, arena->get_region_size(region)){
+    }
+
+    /// @brief Views a range of the region.
+    /// @details Range is clamped to the region.
+    /// @param arena Arena holding the region
+    /// @param region Index of the region in the layout
+    /// @param view_offset Offset of the range in the region
+    /// @param view_size Size of the range in bytes
+    ArenaMemory::ArenaMemory(std::shared_ptr<MemoryArena> arena, const std::size_t region, const std::size_t view_offset, const std::size_t view_size)
+    :arena_(std::move(arena)), region_(region), view_offset_(view_offset){
+        const std::size_t region_size = arena_->get_region_size(region_);
+        view_offset_ = std::min(view_offset_, region_size);
+        size_ = std::min(view_size, region_size - view_offset_);
+        arena_offset_ = arena_->get_region_offset(region_) + view_offset_;
+    }
+
+    /// @brief Returns the byte located at the given address.
+    /// @param addr Zero based address.
+    /// @return byte value located at the given address or error Status.
+    StatusOr<uint8_t> ArenaMemory::get_byte(const uint16_t addr) noexcept{
+        if(addr < size_){
+            return arena_->get_byte(arena_offset_ + addr);
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for byte read! Can't access memory at address(Addr: " +
+            std::to_string(addr) + "/ Limit: " + std::to_string(size_) + ")."
+        );
+    }
+
+    /// @brief Returns the word located at the given address, low byte first.
+    /// @param addr Zero based address.
+    /// @return Word value located at the given address or error Status.
+    StatusOr<uint16_t> ArenaMemory::get_word(const uint16_t addr) noexcept{
+        //Last address must not wrap around to the start
+        if(static_cast<std::size_t>(addr) + 1 < size_){
+            //Bytes may be on different pages
+            return static_cast<uint16_t>(arena_->get_byte(arena_offset_ + addr) | (arena_->get_byte(arena_offset_ + addr + 1) << 8));
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for word read! Can't access memory at address(Addr: " +
+            std::to_string(addr) + "/ Limit: " + std::to_string(size_) + ")."
+        );
+    }
+
+    /// @brief Allows access to the whole memory.
+    /// @details Returns copy of the memory.
+    /// @return copy of the memory.
+    std::vector<uint8_t> ArenaMemory::get_memory(){
+        std::vector<uint8_t> contents(size_);
+        for(std::size_t addr = 0; addr < size_; ++addr){
+            contents[addr] = arena_->get_byte(arena_offset_ + addr);
+        }
+        return contents;
+    }
+
+    /// @brief Returns the current size of the memory in bytes
+    /// @return Size of the memory in bytes.
+    std::size_t ArenaMemory::get_memory_size(){
+        return size_;
+    }
+
+    /// @brief Sets the byte located at the given address to the given value.
+    /// @param addr Zero based address.
+    /// @param value Byte, New value.
+    /// @return Returns status of the set
+    Status ArenaMemory::set_byte(const uint16_t addr, const uint8_t value) noexcept{
+        if(addr < size_){
+            arena_->set_byte(arena_offset_ + addr, value);
+            return Status::ok_status();
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for byte write! Can't access memory at address(Addr: " +
+            std::to_string(addr) + "/ Limit: " + std::to_string(size_) + ")."
+        );
+    }
+
+    /// @brief Sets the word located at the given address to the given value, low byte first.
+    /// @param addr Zero based address.
+    /// @param value Word, New value.
+    /// @return Returns status of the set
+    Status ArenaMemory::set_word(const uint16_t addr, const uint16_t value) noexcept{
+        //Last address must not wrap around to the start
+        if(static_cast<std::size_t>(addr) + 1 < size_){
+            arena_->set_byte(arena_offset_ + addr, static_cast<uint8_t>(value));
+            arena_->set_byte(arena_offset_ + addr + 1, static_cast<uint8_t>(value >> 8));
+            return Status::ok_status();
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for word write! Can't access memory at address(Addr: " +
+            std::to_string(addr) + "/ Limit: " + std::to_string(size_) + ")."
+        );
+    }
+
+    /// @brief Sets the contents of the memory, the size can't change.
+    /// @param contents new contents of the memory
+    /// @return Returns status of the set
+    Status ArenaMemory::set_memory(const std::vector<uint8_t>& contents) noexcept{
+        if(contents.size() != size_){
+            return Status::invalid_input_error(
+                "Arena memory size mismatch! (" + std::to_string(contents.size()) + " / " + std::to_string(size_) + ")"
+            );
+        }
+        for(std::size_t addr = 0; addr < size_; ++addr){
+            arena_->set_byte(arena_offset_ + addr, contents[addr]);
+        }
+        return Status::ok_status();
+    }
+
+    /// @brief Memory is owned by the arena, nothing to free.
+    void ArenaMemory::free(){
+    }
+
+    /// @brief Returns a pointer to the byte at the given address for direct reads.
+    /// @param addr Zero based address.
+    /// @return Pointer to the byte or nullptr if out of range or not at a page start of the arena.
+    const uint8_t* ArenaMemory::get_direct_read_pointer(const uint16_t addr) noexcept{
+        const std::size_t arena_addr = arena_offset_ + addr;
+        return (addr < size_ && arena_addr % MemoryArena::region_alignment == 0) ? arena_->get_page(arena_addr / MemoryArena::region_alignment) : nullptr;
+    }
+
+    /// @brief Returns a pointer to the byte at the given address for direct writes.
+    /// @param addr Zero based address.
+    /// @return Pointer to the byte or nullptr if out of range, not at a page start of the arena or the page is shared.
+    uint8_t* ArenaMemory::get_direct_write_pointer(const uint16_t addr) noexcept{
+        //Direct writes are tracked trough the flag of a single page
+        return (get_dirty_page_flag(addr) != nullptr) ? arena_->get_direct_write_page((arena_offset_ + addr) / MemoryArena::region_alignment) : nullptr;
+    }
+
+    /// @brief Returns the counter of the direct pointer generation of the arena, bumped when pages are shared or copied.
+    /// @return Counter of the direct pointer generation.
+    const uint32_t* ArenaMemory::get_direct_pointer_generation_counter() const noexcept{
+        return arena_->get_direct_pointer_generation_counter();
+    }
+
+    /// @brief Returns the generation of the contents, sharing or copying pages keeps it.
+    /// @return Generation of the contents.
+    uint32_t ArenaMemory::get_contents_generation() const noexcept{
+        return 0;
+    }
+
+    /// @brief Returns the dirty flag of the arena page starting at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer to the flag or nullptr if out of range or not at a page start of the arena.
+    uint8_t* ArenaMemory::get_dirty_page_flag(const uint16_t addr) noexcept{
+        return (addr < size_) ? arena_->get_dirty_pages().get_page_flag(arena_offset_ + addr) : nullptr;
+    }
+
+    /// @brief Pages of the arena are not contiguous.
+    /// @return Empty view.
+    std::span<const uint8_t> ArenaMemory::get_read_view() noexcept{
+        return {};
+    }
+
+    /// @brief Pages of the arena are not contiguous.
+    /// @return Empty view.
+    std::span<uint8_t> ArenaMemory::get_write_view() noexcept{
+        return {};
+    }
+
+    /// @brief Clones the view over the clone of the arena.
+    /// @details Arena is cloned on the first view cloned during the fork, the rest view the same clone.
+    /// @param clones Clones made during the same fork
+    /// @return View of the same range of the arena clone.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> ArenaMemory::clone(MemoryCloneMap& clones){
+        return std::shared_ptr<SystemMemoryInterface>(
+            std::make_shared<ArenaMemory>(clone_arena(clones), region_, view_offset_, size_)
+        );
+    }
+
+    /// @brief Returns the arena holding the memory.
+    /// @return Arena of the view.
+    const std::shared_ptr<MemoryArena>& ArenaMemory::get_arena() const noexcept{
+        return arena_;
+    }
+
+    /// @brief Returns the clone of the arena made during the fork.
+    /// @details Arena is cloned if no view cloned it yet.
+    /// @param clones Clones made during the same fork
+    /// @return Clone of the arena.
+    std::shared_ptr<MemoryArena> ArenaMemory::clone_arena(MemoryCloneMap& clones) const{
+        auto arena_clone = clones.find(arena_.get());
+        if(arena_clone == clones.end()){
+            arena_clone = clones.emplace(arena_.get(), arena_->clone()).first;
+        }
+        return std::static_pointer_cast<MemoryArena>(arena_clone->second);
+    }
+
+}//namespace_mygbc
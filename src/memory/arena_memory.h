@@ -0,0 +1,140 @@
+#ifndef ARENA_MEMORY_H
+#define ARENA_MEMORY_H
+
+#include <span> //std::span
+#include <vector> //std::vector
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "system_memory_interface.h" //SystemMemoryInterface
+#include "memory_arena.h" //MemoryArena
+#include "../util/status/status.h" //Status
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Writable memory over a range of a MemoryArena region.
+    /// @details Keeps the arena alive. Several views may cover the same region, like work RAM and its echo. Writes mark the
+    ///          dirty pages of the arena. Direct pointers are handed out per arena page, direct writes only to pages not shared
+    ///          with a clone. Clones view the same range of the arena clone, cloned once per fork.
+    class ArenaMemory : public SystemMemoryInterface{
+        public:
+
+            /// @brief Views the whole region.
+            /// @param arena Arena holding the region
+            /// @param region Index of the region in the layout
+            ArenaMemory(std::shared_ptr<MemoryArena> arena, const std::size_t region);
+
+            /// @brief Views a range of the region.
+            /// @details Range is clamped to the region.
+            /// @param arena Arena holding the region
+            /// @param region Index of the region in the layout
+            /// @param view_offset Offset of the range in the region
+            /// @param view_size Size of the range in bytes
+            ArenaMemory(std::shared_ptr<MemoryArena> arena, const std::size_t region, const std::size_t view_offset, const std::size_t view_size);
+
+            /// @brief Returns the byte located at the given address.
+            /// @param addr Zero based address.
+            /// @return byte value located at the given address or error Status.
+            StatusOr<uint8_t> get_byte(const uint16_t addr) noexcept override;
+
+            /// @brief Returns the word located at the given address, low byte first.
+            /// @param addr Zero based address.
+            /// @return Word value located at the given address or error Status.
+            StatusOr<uint16_t> get_word(const uint16_t addr) noexcept override;
+
+            /// @brief Allows access to the whole memory.
+            /// @details Returns copy of the memory.
+            /// @return copy of the memory.
+            std::vector<uint8_t> get_memory() override;
+
+            /// @brief Returns the current size of the memory in bytes
+            /// @return Size of the memory in bytes.
+            std::size_t get_memory_size() override;
+
+            /// @brief Sets the byte located at the given address to the given value.
+            /// @param addr Zero based address.
+            /// @param value Byte, New value.
+            /// @return Returns status of the set
+            Status set_byte(const uint16_t addr, const uint8_t value) noexcept override;
+
+            /// @brief Sets the word located at the given address to the given value, low byte first.
+            /// @param addr Zero based address.
+            /// @param value Word, New value.
+            /// @return Returns status of the set
+            Status set_word(const uint16_t addr, const uint16_t value) noexcept override;
+
+            /// @brief Sets the contents of the memory, the size can't change.
+            /// @param contents new contents of the memory
+            /// @return Returns status of the set
+            Status set_memory(const std::vector<uint8_t>& contents) noexcept override;
+
+            /// @brief Memory is owned by the arena, nothing to free.
+            void free() override;
+
+            /// @brief Returns a pointer to the byte at the given address for direct reads.
+            /// @param addr Zero based address.
+            /// @return Pointer to the byte or nullptr if out of range or not at a page start of the arena.
+            const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override;
+
+            /// @brief Returns a pointer to the byte at the given address for direct writes.
+            /// @param addr Zero based address.
+            /// @return Pointer to the byte or nullptr if out of range, not at a page start of the arena or the page is shared.
+            uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept override;
+
+            /// @brief Returns the counter of the direct pointer generation of the arena, bumped when pages are shared or copied.
+            /// @return Counter of the direct pointer generation.
+            const uint32_t* get_direct_pointer_generation_counter() const noexcept override;
+
+            /// @brief Returns the generation of the contents, sharing or copying pages keeps it.
+            /// @return Generation of the contents.
+            uint32_t get_contents_generation() const noexcept override;
+
+            /// @brief Returns the dirty flag of the arena page starting at the given address.
+            /// @param addr Zero based address.
+            /// @return Pointer to the flag or nullptr if out of range or not at a page start of the arena.
+            uint8_t* get_dirty_page_flag(const uint16_t addr) noexcept override;
+
+            /// @brief Pages of the arena are not contiguous.
+            /// @return Empty view.
+            std::span<const uint8_t> get_read_view() noexcept override;
+
+            /// @brief Pages of the arena are not contiguous.
+            /// @return Empty view.
+            std::span<uint8_t> get_write_view() noexcept override;
+
+            /// @brief Clones the view over the clone of the arena.
+            /// @details Arena is cloned on the first view cloned during the fork, the rest view the same clone.
+            /// @param clones Clones made during the same fork
+            /// @return View of the same range of the arena clone.
+            StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+
+            /// @brief Returns the arena holding the memory.
+            /// @return Arena of the view.
+            const std::shared_ptr<MemoryArena>& get_arena() const noexcept;
+
+        protected:
+
+            /// @brief Returns the clone of the arena made during the fork.
+            /// @details Arena is cloned if no view cloned it yet.
+            /// @param clones Clones made during the same fork
+            /// @return Clone of the arena.
+            std::shared_ptr<MemoryArena> clone_arena(MemoryCloneMap& clones) const;
+
+        private:
+            //Arena holding the region
+            std::shared_ptr<MemoryArena> arena_;
+
+            //Region of the arena and the viewed range of it
+            std::size_t region_;
+            std::size_t view_offset_;
+
+            //Bytes in the view
+            std::size_t size_;
+
+            //Offset of the view from the start of the arena
+            std::size_t arena_offset_;
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -0,0 +1,107 @@
+#include "copy_on_write_pages.h" //CopyOnWritePages
+#include <new> //std::align_val_t
+#include <cstring> //std::memcpy, std::memset
+#include <algorithm> //std::min
+
+namespace mygbc{
+
+    /// @brief Allocates the storage, every byte zeroed.
+    /// @param size Size of the storage in bytes
+    CopyOnWritePages::CopyOnWritePages(const std::size_t size):size_(size), copied_page_count_(0){
+        const std::size_t page_count = (size + page_size - 1) / page_size;
+        std::shared_ptr<uint8_t> block = allocate_pages(page_count * page_size);
+        std::memset(block.get(), 0x00, page_count * page_size);
+        pages_.reserve(page_count);
+        for(std::size_t page = 0; page < page_count; ++page){
+            pages_.emplace_back(block, block.get() + page * page_size);
+        }
+        shared_pages_.assign(page_count, 0);
+    }
+
+    /// @brief Forks the storage, every page becomes shared by both sides.
+    /// @details Must not race with accesses of this side.
+    /// @return Storage sharing every page with this one.
+    CopyOnWritePages CopyOnWritePages::share(){
+        CopyOnWritePages fork;
+        fork.pages_ = pages_;
+        fork.shared_pages_.assign(pages_.size(), 1);
+        fork.size_ = size_;
+        shared_pages_.assign(pages_.size(), 1);
+        return fork;
+    }
+
+    /// @brief Returns the size of the storage.
+    /// @return Size in bytes.
+    std::size_t CopyOnWritePages::get_size() const noexcept{
+        return size_;
+    }
+
+    /// @brief Returns the amount of pages, the last one may be partially used.
+    /// @return Page count.
+    std::size_t CopyOnWritePages::get_page_count() const noexcept{
+        return pages_.size();
+    }
+
+    /// @brief Returns the page for writing, copying it first if shared.
+    /// @param page Index of the page, in range
+    /// @return First byte of the page.
+    uint8_t* CopyOnWritePages::get_writable_page(const std::size_t page) noexcept{
+        if(shared_pages_[page] != 0){
+            std::shared_ptr<uint8_t> page_copy = allocate_pages(page_size);
+            std::memcpy(page_copy.get(), pages_[page].get(), page_size);
+            pages_[page] = std::move(page_copy);
+            shared_pages_[page] = 0;
+            ++copied_page_count_;
+        }
+        return pages_[page].get();
+    }
+
+    /// @brief Returns the amount of shared pages copied by this side.
+    /// @return Copied pages.
+    std::size_t CopyOnWritePages::get_copied_page_count() const noexcept{
+        return copied_page_count_;
+    }
+
+    /// @brief Copies the bytes out of the pages.
+    /// @return Contents of the storage.
+    std::vector<uint8_t> CopyOnWritePages::get_contents() const{
+        std::vector<uint8_t> contents(size_);
+        for(std::size_t page = 0; page < pages_.size(); ++page){
+            const std::size_t page_start = page * page_size;
+            std::memcpy(contents.data() + page_start, pages_[page].get(), std::min(page_size, size_ - page_start));
+        }
+        return contents;
+    }
+
+    /// @brief Overwrites the bytes of the storage, copying the shared pages first.
+    /// @param contents New contents, at most the size of the storage
+    void CopyOnWritePages::set_contents(std::span<const uint8_t> contents) noexcept{
+        const std::size_t copy_size = std::min(contents.size(), size_);
+        for(std::size_t page_start = 0; page_start < copy_size; page_start += page_size){
+            std::memcpy(get_writable_page(page_start / page_size), contents.data() + page_start, std::min(page_size, copy_size - page_start));
+        }
+    }
+
+    /// @brief Sets every byte of the storage, copying the shared pages first.
+    /// @param value Byte, New value.
+    void CopyOnWritePages::fill(const uint8_t value) noexcept{
+        for(std::size_t page = 0; page < pages_.size(); ++page){
+            std::memset(get_writable_page(page), value, page_size);
+        }
+    }
+
+    /// @brief Allocates page aligned bytes.
+    /// @param size Bytes to allocate, a multiple of the page size
+    /// @return Owner of the allocation.
+    std::shared_ptr<uint8_t> CopyOnWritePages::allocate_pages(const std::size_t size){
+        //Zero sized new is valid, the block is only freed then
+        return std::shared_ptr<uint8_t>(static_cast<uint8_t*>(::operator new(size, std::align_val_t{page_size})), AlignedDelete{});
+    }
+
+    /// @brief Frees a allocation with the alignment it was allocated with.
+    /// @param pages Allocated pages
+    void CopyOnWritePages::AlignedDelete::operator()(uint8_t* pages) const noexcept{
+        ::operator delete(pages, std::align_val_t{page_size});
+    }
+
+}//namespace_mygbc
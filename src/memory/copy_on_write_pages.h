@@ -0,0 +1,123 @@
+#ifndef COPY_ON_WRITE_PAGES_H
+#define COPY_ON_WRITE_PAGES_H
+
+#include <span> //std::span
+#include <vector> //std::vector
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "dirty_page_tracker.h" //DirtyPageTracker
+
+namespace mygbc{
+
+    /// @brief Byte storage split into pages that forks share copy on write.
+    /// @details Starts as a single page aligned allocation. Sharing copies only the page pointers and marks every page shared
+    ///          on both sides, a shared page is immutable until written. The first write to a shared page copies just that page,
+    ///          whether or not the other side still holds it. Owners withhold direct write pointers to shared pages and move
+    ///          their direct pointer generation when a page is shared or copied. Pages are the size of the page table pages.
+    ///          Single owner, the sides of a fork may be used by different threads once shared.
+    class CopyOnWritePages{
+        public:
+
+            //Bytes in a page
+            static constexpr std::size_t page_size = DirtyPageTracker::page_size;
+
+            /// @brief Allocates the storage, every byte zeroed.
+            /// @param size Size of the storage in bytes
+            explicit CopyOnWritePages(const std::size_t size = 0);
+
+            //A plain copy would share the pages without marking them shared, forks are made trough share
+            CopyOnWritePages(const CopyOnWritePages&) = delete;
+            CopyOnWritePages& operator=(const CopyOnWritePages&) = delete;
+            CopyOnWritePages(CopyOnWritePages&&) = default;
+            CopyOnWritePages& operator=(CopyOnWritePages&&) = default;
+
+            /// @brief Forks the storage, every page becomes shared by both sides.
+            /// @details Must not race with accesses of this side.
+            /// @return Storage sharing every page with this one.
+            CopyOnWritePages share();
+
+            /// @brief Returns the size of the storage.
+            /// @return Size in bytes.
+            std::size_t get_size() const noexcept;
+
+            /// @brief Returns the amount of pages, the last one may be partially used.
+            /// @return Page count.
+            std::size_t get_page_count() const noexcept;
+
+            /// @brief Returns the byte at the offset.
+            /// @param offset Offset of the byte, in range
+            /// @return Value of the byte.
+            uint8_t get_byte(const std::size_t offset) const noexcept{
+                return pages_[offset / page_size].get()[offset % page_size];
+            }
+
+            /// @brief Sets the byte at the offset, copying its page first if shared.
+            /// @param offset Offset of the byte, in range
+            /// @param value Byte, New value.
+            void set_byte(const std::size_t offset, const uint8_t value) noexcept{
+                get_writable_page(offset / page_size)[offset % page_size] = value;
+            }
+
+            /// @brief Returns the page for reading.
+            /// @param page Index of the page, in range
+            /// @return First byte of the page, valid until the page is copied.
+            const uint8_t* get_page(const std::size_t page) const noexcept{
+                return pages_[page].get();
+            }
+
+            /// @brief Returns the page for writing, copying it first if shared.
+            /// @param page Index of the page, in range
+            /// @return First byte of the page.
+            uint8_t* get_writable_page(const std::size_t page) noexcept;
+
+            /// @brief Is the page shared with a fork?
+            /// @param page Index of the page
+            /// @return Page copied on the next write?
+            bool is_page_shared(const std::size_t page) const noexcept{
+                return page < shared_pages_.size() && shared_pages_[page] != 0;
+            }
+
+            /// @brief Returns the amount of shared pages copied by this side.
+            /// @return Copied pages.
+            std::size_t get_copied_page_count() const noexcept;
+
+            /// @brief Copies the bytes out of the pages.
+            /// @return Contents of the storage.
+            std::vector<uint8_t> get_contents() const;
+
+            /// @brief Overwrites the bytes of the storage, copying the shared pages first.
+            /// @param contents New contents, at most the size of the storage
+            void set_contents(std::span<const uint8_t> contents) noexcept;
+
+            /// @brief Sets every byte of the storage, copying the shared pages first.
+            /// @param value Byte, New value.
+            void fill(const uint8_t value) noexcept;
+
+        private:
+
+            /// @brief Allocates page aligned bytes.
+            /// @param size Bytes to allocate, a multiple of the page size
+            /// @return Owner of the allocation.
+            static std::shared_ptr<uint8_t> allocate_pages(const std::size_t size);
+
+            //Frees a allocation with the alignment it was allocated with
+            struct AlignedDelete{
+                void operator()(uint8_t* pages) const noexcept;
+            };
+
+            //Pages, aliasing the initial allocation until copied
+            std::vector<std::shared_ptr<uint8_t>> pages_;
+
+            //Page => 1 if shared with a fork
+            std::vector<uint8_t> shared_pages_;
+
+            //Bytes in the storage
+            std::size_t size_;
+
+            //Shared pages copied by this side
+            std::size_t copied_page_count_;
+    };
+
+}//namespace_mygbc
+
+#endif
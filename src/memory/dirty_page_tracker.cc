@@ -0,0 +1,76 @@
+#include "dirty_page_tracker.h" //DirtyPageTracker
+#include <algorithm> //std::fill, std::min
+
+namespace mygbc{
+
+    /// @brief Tracks a memory of the given size, all pages clean.
+    /// @param memory_size Size of the tracked memory in bytes
+    DirtyPageTracker::DirtyPageTracker(const std::size_t memory_size)
+    :dirty_pages_((memory_size + page_size - 1) / page_size, 0){
+    }
+
+    /// @brief Tracks a memory of the given size, all pages dirty.
+    /// @details Used when the contents are replaced as a whole.
+    /// @param memory_size Size of the tracked memory in bytes
+    void DirtyPageTracker::reset(const std::size_t memory_size){
+        dirty_pages_.assign((memory_size + page_size - 1) / page_size, 1);
+    }
+
+    /// @brief Marks the pages overlapping the range dirty.
+    /// @param addr Zero based address of the first written byte.
+    /// @param size_in_bytes Size of the write in bytes.
+    void DirtyPageTracker::mark_range(const std::size_t addr, const std::size_t size_in_bytes) noexcept{
+        if(size_in_bytes == 0 || addr >= page_size * dirty_pages_.size()){
+            return;
+        }
+        const std::size_t last_page = std::min((addr + size_in_bytes - 1) / page_size, dirty_pages_.size() - 1);
+        std::fill(dirty_pages_.begin() + addr / page_size, dirty_pages_.begin() + last_page + 1, 1);
+    }
+
+    /// @brief Marks every page dirty.
+    void DirtyPageTracker::mark_all() noexcept{
+        std::fill(dirty_pages_.begin(), dirty_pages_.end(), 1);
+    }
+
+    /// @brief Returns the flag of the page starting at the address.
+    /// @details Writers set the flag to 1. Stays valid until the tracker is reset.
+    /// @param addr Zero based address, must be the first byte of a page.
+    /// @return Pointer to the flag or nullptr if unaligned or out of range.
+    uint8_t* DirtyPageTracker::get_page_flag(const std::size_t addr) noexcept{
+        if(addr % page_size != 0 || addr / page_size >= dirty_pages_.size()){
+            return nullptr;
+        }
+        return dirty_pages_.data() + addr / page_size;
+    }
+
+    /// @brief Is the page dirty?
+    /// @param page Index of the page
+    /// @return Page written since the last clear?
+    bool DirtyPageTracker::is_dirty(const std::size_t page) const noexcept{
+        return page < dirty_pages_.size() && dirty_pages_[page] != 0;
+    }
+
+    /// @brief Returns the indices of the dirty pages in ascending order.
+    /// @return Dirty page indices.
+    std::vector<uint16_t> DirtyPageTracker::get_dirty_pages() const{
+        std::vector<uint16_t> dirty_pages;
+        for(std::size_t page = 0; page < dirty_pages_.size(); ++page){
+            if(dirty_pages_[page] != 0){
+                dirty_pages.push_back(static_cast<uint16_t>(page));
+            }
+        }
+        return dirty_pages;
+    }
+
+    /// @brief Marks every page clean.
+    void DirtyPageTracker::clear() noexcept{
+        std::fill(dirty_pages_.begin(), dirty_pages_.end(), 0);
+    }
+
+    /// @brief Returns the amount of tracked pages.
+    /// @return Tracked pages.
+    std::size_t DirtyPageTracker::get_page_count() const noexcept{
+        return dirty_pages_.size();
+    }
+
+}//namespace_mygbc
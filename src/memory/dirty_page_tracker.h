@@ -0,0 +1,75 @@
+#ifndef DIRTY_PAGE_TRACKER_H
+#define DIRTY_PAGE_TRACKER_H
+
+#include <vector> //std::vector
+#include <cstdint> //Fixed lenght variables
+
+namespace mygbc{
+
+    /// @brief Per page dirty flags of a writable memory.
+    /// @details One flag byte per page so the write path marks a page with a single store, also trough a flag pointer
+    ///          handed to the MemoryController page table. Pages are the size of the page table pages.
+    class DirtyPageTracker{
+        public:
+
+            //Bytes in a tracked page
+            static constexpr std::size_t page_size = 0x100;
+
+            /// @brief Default constructor, tracks nothing.
+            DirtyPageTracker() = default;
+
+            /// @brief Tracks a memory of the given size, all pages clean.
+            /// @param memory_size Size of the tracked memory in bytes
+            explicit DirtyPageTracker(const std::size_t memory_size);
+
+            /// @brief Tracks a memory of the given size, all pages dirty.
+            /// @details Used when the contents are replaced as a whole.
+            /// @param memory_size Size of the tracked memory in bytes
+            void reset(const std::size_t memory_size);
+
+            /// @brief Marks the page of the address dirty.
+            /// @param addr Zero based address of the written byte.
+            inline void mark(const std::size_t addr) noexcept{
+                if(addr < page_size * dirty_pages_.size()){
+                    dirty_pages_[addr / page_size] = 1;
+                }
+            }
+
+            /// @brief Marks the pages overlapping the range dirty.
+            /// @param addr Zero based address of the first written byte.
+            /// @param size_in_bytes Size of the write in bytes.
+            void mark_range(const std::size_t addr, const std::size_t size_in_bytes) noexcept;
+
+            /// @brief Marks every page dirty.
+            void mark_all() noexcept;
+
+            /// @brief Returns the flag of the page starting at the address.
+            /// @details Writers set the flag to 1. Stays valid until the tracker is reset.
+            /// @param addr Zero based address, must be the first byte of a page.
+            /// @return Pointer to the flag or nullptr if unaligned or out of range.
+            uint8_t* get_page_flag(const std::size_t addr) noexcept;
+
+            /// @brief Is the page dirty?
+            /// @param page Index of the page
+            /// @return Page written since the last clear?
+            bool is_dirty(const std::size_t page) const noexcept;
+
+            /// @brief Returns the indices of the dirty pages in ascending order.
+            /// @return Dirty page indices.
+            std::vector<uint16_t> get_dirty_pages() const;
+
+            /// @brief Marks every page clean.
+            void clear() noexcept;
+
+            /// @brief Returns the amount of tracked pages.
+            /// @return Tracked pages.
+            std::size_t get_page_count() const noexcept;
+
+        private:
+            //Page => 1 if written since the last clear
+            std::vector<uint8_t> dirty_pages_;
+    };
+
+}//namespace_mygbc
+
+#endif
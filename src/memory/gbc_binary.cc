@@ -82,11 +82,42 @@ namespace mygbc{
         return Status::invalid_binary_error("Could not parse the binary!");
     }
 
+    /// @brief Static function that parses the mapped file as a GBCBinary without copying it.
+    /// @details Only the header is read, the bytes stay in the mapping which the binary keeps alive.
+    /// @param mapped_file Mapping of the binary.
+    /// @return Parsed read only GBCBinary ready to be used or error Status.
+    StatusOr<GBCBinary> GBCBinary::parse_mapped_file(std::shared_ptr<const MappedFile> mapped_file) noexcept{
+        if(mapped_file == nullptr){
+            return Status::invalid_binary_error("Could not parse the binary! No mapping given.");
+        }
+        const std::span<const uint8_t> image_bytes = mapped_file->get_bytes();
+        return parse_shared_image(std::move(mapped_file), image_bytes);
+    }
+
+    /// @brief Static function that parses the shared image as a GBCBinary without copying it.
+    /// @details Only the header is read, the binary keeps the owner of the image alive.
+    /// @param image_owner Owner of the image bytes.
+    /// @param image_bytes Bytes of the binary, owned by image_owner.
+    /// @return Parsed read only GBCBinary ready to be used or error Status.
+    StatusOr<GBCBinary> GBCBinary::parse_shared_image(std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes) noexcept{
+        StatusOr<GBCBinary::GBCBinaryHeaderData> header_data = GBCBinary::extract_header_data(image_bytes);
+        StatusOr<bool> valid_logo = GBCBinary::check_logo_validity(image_bytes);
+        StatusOr<bool> valid_header = GBCBinary::check_header_checksum_validity(image_bytes);
+        if(
+            header_data.ok() &&
+            valid_logo.ok() &&
+            valid_header.ok()
+        ){
+            return GBCBinary(header_data.value(), valid_logo.value(), valid_header.value(), std::move(image_owner), image_bytes);
+        }
+        return Status::invalid_binary_error("Could not parse the binary!");
+    }
+
     /// @brief Checks if the logo is correct in byte_buffer.
     /// @details Checks wheter the bytes 0x104=>0x133 are a valid logo.
-    /// @param byte_buffer std::vector buffer containing the binary bytes.
+    /// @param byte_buffer Bytes of the binary.
     /// @return Were the bytes 0x104=>0x133 present and presented a valid logo or error Status.
-    StatusOr<bool> GBCBinary::check_logo_validity(const std::vector<uint8_t>& byte_buffer) noexcept{
+    StatusOr<bool> GBCBinary::check_logo_validity(std::span<const uint8_t> byte_buffer) noexcept{
         //CRC32 checksum of the logo bytes, recreates the functionality.
         const uint32_t logo_crc32 = 1176065047;
         //logo located at range 0x104 => 0x133
@@ -105,9 +136,9 @@ namespace mygbc{
 
     /// @brief Checks if the header checksum is correct in byte_buffer.
     /// @details Checks wheter the header bytes 0x134=>0x14C are a valid using the checksum at 0x14D.
-    /// @param byte_buffer std::vector buffer containing the binary bytes.
+    /// @param byte_buffer Bytes of the binary.
     /// @return Checks wheter the header bytes 0x134=>0x14C are a valid using the checksum at 0x14D or error Status.
-    StatusOr<bool> GBCBinary::check_header_checksum_validity(const std::vector<uint8_t>& byte_buffer) noexcept{
+    StatusOr<bool> GBCBinary::check_header_checksum_validity(std::span<const uint8_t> byte_buffer) noexcept{
         const uint16_t header_end_addr = 0x14F;
         if(byte_buffer.size() >= header_end_addr){
             //From wiki: x=0:FOR i=0134h TO 014C h:x=x-MEM[i]-1:NEXT
@@ -129,9 +160,9 @@ namespace mygbc{
 
     /// @brief Extracts binary headerdata.
     /// @details Extracts all the binary headerdata available.
-    /// @param byte_buffer std::vector buffer containing the binary bytes.
+    /// @param byte_buffer Bytes of the binary.
     /// @return headerdata available at 0x134 to 0x14F or error Status
-    StatusOr<GBCBinary::GBCBinaryHeaderData> GBCBinary::extract_header_data(const std::vector<uint8_t>& byte_buffer) noexcept{
+    StatusOr<GBCBinary::GBCBinaryHeaderData> GBCBinary::extract_header_data(std::span<const uint8_t> byte_buffer) noexcept{
         const uint16_t header_end_addr = 0x14F;
         if(byte_buffer.size() >= header_end_addr){
             GBCBinary::GBCBinaryHeaderData header_data;
@@ -227,6 +258,153 @@ namespace mygbc{
     }
 
 
+    /// @brief Initializes read only GBCBinary over a shared image.
+    /// @param header Parsed header data of the binary.
+    /// @param valid_logo Logo status of the binary.
+    /// @param valid_header Was header validated succesfull using the checksum?
+    /// @param image_owner Owner of the image bytes.
+    /// @param image_bytes Bytes of the binary, owned by image_owner.
+    GBCBinary::GBCBinary(const GBCBinary::GBCBinaryHeaderData& header, const bool valid_logo, const bool valid_header, std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes)
+    :AddressableMemory(std::vector<uint8_t>{}, true), binary_header_data_(header), has_valid_header_(valid_header), has_valid_logo_(valid_logo),
+    shared_image_(std::move(image_owner)), shared_bytes_(image_bytes)
+    {
+    }
+
+    /// @brief Returns the byte located at the given address.
+    /// @param addr Zero based address.
+    /// @return byte value located at the given address or error Status.
+    StatusOr<uint8_t> GBCBinary::get_byte(const uint16_t addr) noexcept{
+        if(shared_image_ == nullptr){
+            return AddressableMemory::get_byte(addr);
+        }
+        const std::span<const uint8_t> bytes = shared_bytes_;
+        if(addr < bytes.size()){
+            return bytes[addr];
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for byte read! Can't access memory at address(Addr: " + 
+            std::to_string(addr) + "/ Limit: " + std::to_string(bytes.size()) + ")."
+        );
+    }
+
+    /// @brief Returns the word located at the given address.
+    /// @param addr Zero based address.
+    /// @return Word value located at the given address or error Status.
+    StatusOr<uint16_t> GBCBinary::get_word(const uint16_t addr) noexcept{
+        if(shared_image_ == nullptr){
+            return AddressableMemory::get_word(addr);
+        }
+        const std::span<const uint8_t> bytes = shared_bytes_;
+        const uint16_t byte_two_addr = addr + 1;
+        if(byte_two_addr < bytes.size()){
+            return Util::load_little_endian_word(bytes.data() + addr);
+        }
+        return Status::invalid_index_error(
+            "Invalid address given for word read! Can't access memory at address(Addr: " + 
+            std::to_string(addr) + "/ Limit: " + std::to_string(bytes.size()) + ")."
+        );
+    }
+
+    /// @brief Allows access to the whole memory.
+    /// @details Returns copy of the memory, copies out of the image for shared binaries.
+    /// @return copy of the memory.
+    std::vector<uint8_t> GBCBinary::get_memory(){
+        if(shared_image_ == nullptr){
+            return AddressableMemory::get_memory();
+        }
+        const std::span<const uint8_t> bytes = shared_bytes_;
+        return std::vector<uint8_t>(bytes.begin(), bytes.end());
+    }
+
+    /// @brief Returns the current size of the memory in bytes
+    /// @return Size of the memory in bytes.
+    std::size_t GBCBinary::get_memory_size(){
+        return (shared_image_ == nullptr) ? AddressableMemory::get_memory_size() : shared_bytes_.size();
+    }
+
+    /// @brief Sets the byte located at the given address to the given value.
+    /// @details Shared binaries are read only.
+    /// @param addr Zero based address.
+    /// @param value Byte, New value.
+    /// @return Returns status of the set
+    Status GBCBinary::set_byte(const uint16_t addr, const uint8_t value) noexcept{
+        if(shared_image_ == nullptr){
+            return AddressableMemory::set_byte(addr, value);
+        }
+        return Status::protected_memory_set_error("Tried to set memory of a shared binary!");
+    }
+
+    /// @brief Sets the word located at the given address to the given value.
+    /// @details Shared binaries are read only.
+    /// @param addr Zero based address.
+    /// @param value Word, New value.
+    /// @return Returns status of the set
+    Status GBCBinary::set_word(const uint16_t addr, const uint16_t value) noexcept{
+        if(shared_image_ == nullptr){
+            return AddressableMemory::set_word(addr, value);
+        }
+        return Status::protected_memory_set_error("Tried to set memory of a shared binary!");
+    }
+
+    /// @brief Frees the memory assosiated with the memory object, releases the shared image.
+    void GBCBinary::free(){
+        shared_image_.reset();
+        shared_bytes_ = std::span<const uint8_t>();
+        AddressableMemory::free();
+    }
+
+    /// @brief Returns a pointer to the byte at the given address for direct reads.
+    /// @details Points into the image for shared binaries.
+    /// @param addr Zero based address.
+    /// @return Pointer to the byte or nullptr if out of range or concurrently observed.
+    const uint8_t* GBCBinary::get_direct_read_pointer(const uint16_t addr) noexcept{
+        if(shared_image_ == nullptr){
+            return AddressableMemory::get_direct_read_pointer(addr);
+        }
+        return (addr < shared_bytes_.size()) ? shared_bytes_.data() + addr : nullptr;
+    }
+
+    /// @brief Returns a view of the whole memory for bulk reads without copying.
+    /// @details Views the image for shared binaries.
+    /// @return View of the memory or empty view if concurrently observed.
+    std::span<const uint8_t> GBCBinary::get_read_view() noexcept{
+        return (shared_image_ == nullptr) ? AddressableMemory::get_read_view() : shared_bytes_;
+    }
+
+    /// @brief Clones the binary for a forked instance.
+    /// @details Shared binaries share the image with the clone, the rest copy their bytes.
+    /// @param clones Clones made during the same fork
+    /// @return Clone of the binary.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> GBCBinary::clone(MemoryCloneMap& clones){
+        if(shared_image_ != nullptr){
+            return std::shared_ptr<SystemMemoryInterface>(
+                std::make_shared<GBCBinary>(binary_header_data_, has_valid_logo_, has_valid_header_, shared_image_, shared_bytes_)
+            );
+        }
+        return std::shared_ptr<SystemMemoryInterface>(
+            std::make_shared<GBCBinary>(binary_header_data_, has_valid_logo_, has_valid_header_, get_memory())
+        );
+    }
+
+    /// @brief Returns the bytes of the binary without copying them.
+    /// @return Bytes of the binary, valid until the binary is freed or modified.
+    std::span<const uint8_t> GBCBinary::get_bytes() const noexcept{
+        return (shared_image_ == nullptr) ? std::span<const uint8_t>(memory_) : shared_bytes_;
+    }
+
+    /// @brief Is the binary read from a shared image?
+    /// @return Is the image shared?
+    bool GBCBinary::is_shared() const noexcept{
+        return shared_image_ != nullptr;
+    }
+
+    /// @brief Returns the owner of the shared image.
+    /// @details Keeps the bytes returned by get_bytes alive for shared binaries.
+    /// @return Owner of the image or nullptr if the binary is not shared.
+    std::shared_ptr<const void> GBCBinary::get_shared_image() const noexcept{
+        return shared_image_;
+    }
+
     /// @brief Getter for the binary headerdata variable (see struct `GBCBinaryHeaderData`).
     /// @details Returns the headerdata available for the binary.
     /// @return headerdata available for the binary (see struct `GBCBinaryHeaderData`).
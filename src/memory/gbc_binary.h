@@ -2,9 +2,12 @@
 #define GBC_BINARY_H
 
 #include <vector> //std::vector
+#include <span> //std::span
 #include <string> //std::string
+#include <memory> //std::shared_ptr
 #include <cstdint> //Fixed lenght variables
 #include "addressable_memory.h" //AddressableMemory
+#include "../util/io/mapped_file.h" //MappedFile
 #include "../util/status/status.h" //Status
 #include "../util/status/status_or.h" //StatusOr
 
@@ -12,6 +15,7 @@ namespace mygbc{
 
     /// @brief Provides a accesible presentation of the GBC binary.
     /// @details Parses binary bytes and extracts the available information from it, providing accesible presentation of the GBC binary.
+    ///          Binaries over a shared image (a mapped file or a RomCache entry) read straight from the image and are read only.
     class GBCBinary: public AddressableMemory{
         public:
             /// @brief Data structure for the binary headerdata.
@@ -68,6 +72,19 @@ namespace mygbc{
             /// @return Parsed GBCBinary ready to be used or error Status.
             static StatusOr<GBCBinary> parse_bytes(const std::vector<uint8_t>& byte_buffer) noexcept;
 
+            /// @brief Static function that parses the mapped file as a GBCBinary without copying it.
+            /// @details Only the header is read, the bytes stay in the mapping which the binary keeps alive.
+            /// @param mapped_file Mapping of the binary.
+            /// @return Parsed read only GBCBinary ready to be used or error Status.
+            static StatusOr<GBCBinary> parse_mapped_file(std::shared_ptr<const MappedFile> mapped_file) noexcept;
+
+            /// @brief Static function that parses the shared image as a GBCBinary without copying it.
+            /// @details Only the header is read, the binary keeps the owner of the image alive.
+            /// @param image_owner Owner of the image bytes.
+            /// @param image_bytes Bytes of the binary, owned by image_owner.
+            /// @return Parsed read only GBCBinary ready to be used or error Status.
+            static StatusOr<GBCBinary> parse_shared_image(std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes) noexcept;
+
             /// @brief Initializes empty GBCBinary.
             /// @details Initializes empty GBCBinary.
             GBCBinary();
@@ -88,6 +105,79 @@ namespace mygbc{
             /// @param byte_buffer Bytes of the binary.
             GBCBinary(const GBCBinary::GBCBinaryHeaderData&& header, const bool&& valid_logo, const bool&& valid_header, const std::vector<uint8_t>& byte_buffer);
 
+            /// @brief Initializes read only GBCBinary over a shared image.
+            /// @param header Parsed header data of the binary.
+            /// @param valid_logo Logo status of the binary.
+            /// @param valid_header Was header validated succesfull using the checksum?
+            /// @param image_owner Owner of the image bytes.
+            /// @param image_bytes Bytes of the binary, owned by image_owner.
+            GBCBinary(const GBCBinary::GBCBinaryHeaderData& header, const bool valid_logo, const bool valid_header, std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes);
+
+            /// @brief Returns the byte located at the given address.
+            /// @param addr Zero based address.
+            /// @return byte value located at the given address or error Status.
+            StatusOr<uint8_t> get_byte(const uint16_t addr) noexcept override;
+
+            /// @brief Returns the word located at the given address.
+            /// @param addr Zero based address.
+            /// @return Word value located at the given address or error Status.
+            StatusOr<uint16_t> get_word(const uint16_t addr) noexcept override;
+
+            /// @brief Allows access to the whole memory.
+            /// @details Returns copy of the memory, copies out of the image for shared binaries.
+            /// @return copy of the memory.
+            std::vector<uint8_t> get_memory() override;
+
+            /// @brief Returns the current size of the memory in bytes
+            /// @return Size of the memory in bytes.
+            std::size_t get_memory_size() override;
+
+            /// @brief Sets the byte located at the given address to the given value.
+            /// @details Shared binaries are read only.
+            /// @param addr Zero based address.
+            /// @param value Byte, New value.
+            /// @return Returns status of the set
+            Status set_byte(const uint16_t addr, const uint8_t value) noexcept override;
+
+            /// @brief Sets the word located at the given address to the given value.
+            /// @details Shared binaries are read only.
+            /// @param addr Zero based address.
+            /// @param value Word, New value.
+            /// @return Returns status of the set
+            Status set_word(const uint16_t addr, const uint16_t value) noexcept override;
+
+            /// @brief Frees the memory assosiated with the memory object, releases the shared image.
+            void free() override;
+
+            /// @brief Returns a pointer to the byte at the given address for direct reads.
+            /// @details Points into the image for shared binaries.
+            /// @param addr Zero based address.
+            /// @return Pointer to the byte or nullptr if out of range or concurrently observed.
+            const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override;
+
+            /// @brief Returns a view of the whole memory for bulk reads without copying.
+            /// @details Views the image for shared binaries.
+            /// @return View of the memory or empty view if concurrently observed.
+            std::span<const uint8_t> get_read_view() noexcept override;
+
+            /// @brief Clones the binary for a forked instance.
+            /// @details Shared binaries share the image with the clone, the rest copy their bytes.
+            /// @param clones Clones made during the same fork
+            /// @return Clone of the binary.
+            StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+            /// @brief Returns the bytes of the binary without copying them.
+            /// @return Bytes of the binary, valid until the binary is freed or modified.
+            std::span<const uint8_t> get_bytes() const noexcept;
+
+            /// @brief Is the binary read from a shared image?
+            /// @return Is the image shared?
+            bool is_shared() const noexcept;
+
+            /// @brief Returns the owner of the shared image.
+            /// @details Keeps the bytes returned by get_bytes alive for shared binaries.
+            /// @return Owner of the image or nullptr if the binary is not shared.
+            std::shared_ptr<const void> get_shared_image() const noexcept;
+
 
             /// @brief Getter for the binary headerdata variable (see struct `GBCBinaryHeaderData`).
             /// @details Returns the headerdata available for the binary.
@@ -112,21 +202,21 @@ namespace mygbc{
 
             /// @brief Checks if the logo is correct in byte_buffer.
             /// @details Checks wheter the bytes 0x104=>0x133 are a valid logo.
-            /// @param byte_buffer std::vector buffer containing the binary bytes.
+            /// @param byte_buffer Bytes of the binary.
             /// @return Were the bytes 0x104=>0x133 present and presented a valid logo or error Status.
-            static StatusOr<bool> check_logo_validity(const std::vector<uint8_t>& byte_buffer) noexcept;
+            static StatusOr<bool> check_logo_validity(std::span<const uint8_t> byte_buffer) noexcept;
 
             /// @brief Checks if the header checksum is correct in byte_buffer.
             /// @details Checks wheter the header bytes 0x134=>0x14C are a valid using the checksum at 0x14D.
-            /// @param byte_buffer std::vector buffer containing the binary bytes.
+            /// @param byte_buffer Bytes of the binary.
             /// @return Checks wheter the header bytes 0x134=>0x14C are a valid using the checksum at 0x14D or error Status.
-            static StatusOr<bool> check_header_checksum_validity(const std::vector<uint8_t>& byte_buffer) noexcept;
+            static StatusOr<bool> check_header_checksum_validity(std::span<const uint8_t> byte_buffer) noexcept;
 
             /// @brief Extracts binary headerdata.
             /// @details Extracts all the binary headerdata available.
-            /// @param byte_buffer std::vector buffer containing the binary bytes.
+            /// @param byte_buffer Bytes of the binary.
             /// @return headerdata available at 0x134 to 0x14F or error Status.
-            static StatusOr<GBCBinary::GBCBinaryHeaderData> extract_header_data(const std::vector<uint8_t>& byte_buffer) noexcept;
+            static StatusOr<GBCBinary::GBCBinaryHeaderData> extract_header_data(std::span<const uint8_t> byte_buffer) noexcept;
 
             //headerdata extracted from the binary
             const GBCBinary::GBCBinaryHeaderData binary_header_data_;
@@ -136,6 +226,12 @@ namespace mygbc{
 
             //Is the logo valid (0x104 => 0x133)
             const bool has_valid_logo_;
+
+            //Owner of the shared image, nullptr if the bytes are held in memory_
+            std::shared_ptr<const void> shared_image_;
+
+            //Bytes of the shared image
+            std::span<const uint8_t> shared_bytes_;
     };
 
 }//namespace_mygbc
@@ -0,0 +1,86 @@
+#include "high_page_memory.h" //HighPageMemory
+
+namespace mygbc{
+
+    namespace{
+        /// @brief Does the range cover IE or IF?
+        /// @param addr First address of the range
+        /// @param size Size of the range in bytes
+        /// @return Range touches a interrupt register?
+        bool touches_interrupt_registers(const std::size_t addr, const std::size_t size) noexcept{
+            return (addr <= InterruptController::interrupt_flag_offset && InterruptController::interrupt_flag_offset < addr + size) ||
+                   (addr <= InterruptController::interrupt_enable_offset && InterruptController::interrupt_enable_offset < addr + size);
+        }
+    }//namespace
+
+    /// @brief Views the high page the controller keeps its registers in.
+    /// @param interrupt_controller Controller of IE and IF
+    HighPageMemory::HighPageMemory(std::shared_ptr<InterruptController> interrupt_controller)
+    :ArenaMemory(interrupt_controller->get_arena(), interrupt_controller->get_region()), interrupt_controller_(std::move(interrupt_controller)){
+    }
+
+    /// @brief Sets the byte located at the given address to the given value.
+    /// @param addr Zero based address.
+    /// @param value Byte, New value.
+    /// @return Returns status of the set
+    Status HighPageMemory::set_byte(const uint16_t addr, const uint8_t value) noexcept{
+        Status byte_set = ArenaMemory::set_byte(addr, value);
+        if(byte_set.ok() && touches_interrupt_registers(addr, 1)){
+            interrupt_controller_->refresh();
+        }
+        return byte_set;
+    }
+
+    /// @brief Sets the word located at the given address to the given value, low byte first.
+    /// @param addr Zero based address.
+    /// @param value Word, New value.
+    /// @return Returns status of the set
+    Status HighPageMemory::set_word(const uint16_t addr, const uint16_t value) noexcept{
+        Status word_set = ArenaMemory::set_word(addr, value);
+        if(word_set.ok() && touches_interrupt_registers(addr, 2)){
+            interrupt_controller_->refresh();
+        }
+        return word_set;
+    }
+
+    /// @brief Sets the contents of the memory, the size can't change.
+    /// @param contents new contents of the memory
+    /// @return Returns status of the set
+    Status HighPageMemory::set_memory(const std::vector<uint8_t>& contents) noexcept{
+        Status memory_set = ArenaMemory::set_memory(contents);
+        if(memory_set.ok()){
+            interrupt_controller_->refresh();
+        }
+        return memory_set;
+    }
+
+    /// @brief Direct writes would bypass the controller.
+    /// @param addr Zero based address.
+    /// @return nullptr.
+    uint8_t* HighPageMemory::get_direct_write_pointer(const uint16_t addr) noexcept{
+        return nullptr;
+    }
+
+    /// @brief Bulk writes would bypass the controller.
+    /// @return Empty view.
+    std::span<uint8_t> HighPageMemory::get_write_view() noexcept{
+        return {};
+    }
+
+    /// @brief Clones the view over the clone of the arena, bound to the clone of the controller.
+    /// @details Controller is cloned once per fork, keyed by the original.
+    /// @param clones Clones made during the same fork
+    /// @return View of the high page of the arena clone.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> HighPageMemory::clone(MemoryCloneMap& clones){
+        auto controller_clone = clones.find(interrupt_controller_.get());
+        if(controller_clone == clones.end()){
+            controller_clone = clones.emplace(
+                interrupt_controller_.get(), std::make_shared<InterruptController>(clone_arena(clones), interrupt_controller_->get_region())
+            ).first;
+        }
+        return std::shared_ptr<SystemMemoryInterface>(
+            std::make_shared<HighPageMemory>(std::static_pointer_cast<InterruptController>(controller_clone->second))
+        );
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,64 @@
+#ifndef HIGH_PAGE_MEMORY_H
+#define HIGH_PAGE_MEMORY_H
+
+#include <span> //std::span
+#include <vector> //std::vector
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "arena_memory.h" //ArenaMemory
+#include "../components/interrupt_controller.h" //InterruptController
+#include "../util/status/status.h" //Status
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Arena view of the high page, 0xFF00-0xFFFF, keeping the InterruptController in sync with IE and IF.
+    /// @details Writes touching IE or IF refresh the pending interrupts of the controller. Direct and bulk writes are
+    ///          not offered so every write goes trough the view. Clones view the arena clone with the controller clone.
+    class HighPageMemory : public ArenaMemory{
+        public:
+
+            /// @brief Views the high page the controller keeps its registers in.
+            /// @param interrupt_controller Controller of IE and IF
+            explicit HighPageMemory(std::shared_ptr<InterruptController> interrupt_controller);
+
+            /// @brief Sets the byte located at the given address to the given value.
+            /// @param addr Zero based address.
+            /// @param value Byte, New value.
+            /// @return Returns status of the set
+            Status set_byte(const uint16_t addr, const uint8_t value) noexcept override;
+
+            /// @brief Sets the word located at the given address to the given value, low byte first.
+            /// @param addr Zero based address.
+            /// @param value Word, New value.
+            /// @return Returns status of the set
+            Status set_word(const uint16_t addr, const uint16_t value) noexcept override;
+
+            /// @brief Sets the contents of the memory, the size can't change.
+            /// @param contents new contents of the memory
+            /// @return Returns status of the set
+            Status set_memory(const std::vector<uint8_t>& contents) noexcept override;
+
+            /// @brief Direct writes would bypass the controller.
+            /// @param addr Zero based address.
+            /// @return nullptr.
+            uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept override;
+
+            /// @brief Bulk writes would bypass the controller.
+            /// @return Empty view.
+            std::span<uint8_t> get_write_view() noexcept override;
+
+            /// @brief Clones the view over the clone of the arena, bound to the clone of the controller.
+            /// @details Controller is cloned once per fork, keyed by the original.
+            /// @param clones Clones made during the same fork
+            /// @return View of the high page of the arena clone.
+            StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+
+        private:
+            //Controller of IE and IF
+            std::shared_ptr<InterruptController> interrupt_controller_;
+    };
+
+}//namespace_mygbc
+
+#endif
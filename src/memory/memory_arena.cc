@@ -0,0 +1,129 @@
+#include "memory_arena.h" //MemoryArena
+#include <algorithm> //std::fill_n
+
+namespace mygbc{
+
+    namespace{
+        /// @brief Lays out the regions, each starting at a page boundary.
+        /// @param region_sizes Sizes of the regions in bytes, in layout order
+        /// @return Region => offset, one past the last region holds the size of the arena.
+        std::vector<std::size_t> get_region_offsets(const std::vector<std::size_t>& region_sizes){
+            std::vector<std::size_t> region_offsets;
+            std::size_t offset = 0;
+            for(const std::size_t region_size : region_sizes){
+                region_offsets.push_back(offset);
+                offset += (region_size + MemoryArena::region_alignment - 1) / MemoryArena::region_alignment * MemoryArena::region_alignment;
+            }
+            region_offsets.push_back(offset);
+            return region_offsets;
+        }
+    }//namespace
+
+    /// @brief Allocates the arena, every region zeroed.
+    /// @param region_sizes Sizes of the regions in bytes, in layout order
+    MemoryArena::MemoryArena(const std::vector<std::size_t>& region_sizes)
+    :region_offsets_(get_region_offsets(region_sizes)), pages_(region_offsets_.back()), dirty_pages_(region_offsets_.back()),
+    direct_pointer_generation_(0){
+    }
+
+    /// @brief Clones the arena sharing every page with it.
+    /// @details Pages of the arena become shared too, both copy the pages they write to. Layout and dirty pages are carried over.
+    ///          Must not race with accesses of the arena.
+    /// @return Clone of the arena.
+    std::shared_ptr<MemoryArena> MemoryArena::clone(){
+        //Empty layout, the pages are taken from the arena
+        std::shared_ptr<MemoryArena> arena_clone = std::make_shared<MemoryArena>(std::vector<std::size_t>{});
+        arena_clone->region_offsets_ = region_offsets_;
+        arena_clone->pages_ = pages_.share();
+        arena_clone->dirty_pages_ = dirty_pages_;
+        //Direct writes to the pages must stop until they are copied
+        ++direct_pointer_generation_;
+        return arena_clone;
+    }
+
+    /// @brief Zeroes every region, every page becomes dirty.
+    void MemoryArena::reset() noexcept{
+        for(std::size_t page = 0; page < pages_.get_page_count(); ++page){
+            std::fill_n(get_writable_page(page), CopyOnWritePages::page_size, 0x00);
+        }
+        dirty_pages_.mark_all();
+    }
+
+    /// @brief Returns the size of the region including its padding.
+    /// @param region Index of the region in the layout
+    /// @return Size of the region in bytes, 0 if there is no such region.
+    std::size_t MemoryArena::get_region_size(const std::size_t region) const noexcept{
+        return (region + 1 < region_offsets_.size()) ? region_offsets_[region + 1] - region_offsets_[region] : 0;
+    }
+
+    /// @brief Returns the offset of the region from the start of the arena.
+    /// @param region Index of the region in the layout
+    /// @return Offset of the region in bytes, the size of the arena if there is no such region.
+    std::size_t MemoryArena::get_region_offset(const std::size_t region) const noexcept{
+        return (region + 1 < region_offsets_.size()) ? region_offsets_[region] : get_size();
+    }
+
+    /// @brief Returns the amount of regions in the layout.
+    /// @return Region count.
+    std::size_t MemoryArena::get_region_count() const noexcept{
+        return region_offsets_.size() - 1;
+    }
+
+    /// @brief Returns the size of the arena including the padding between the regions.
+    /// @return Size of the arena in bytes.
+    std::size_t MemoryArena::get_size() const noexcept{
+        return region_offsets_.back();
+    }
+
+    /// @brief Returns the page for reading.
+    /// @param page Index of the page, in range
+    /// @return First byte of the page, valid until the direct pointer generation changes.
+    const uint8_t* MemoryArena::get_page(const std::size_t page) const noexcept{
+        return pages_.get_page(page);
+    }
+
+    /// @brief Returns the page for writing, copying it first if shared. Does not mark it dirty.
+    /// @param page Index of the page, in range
+    /// @return First byte of the page, valid until the direct pointer generation changes.
+    uint8_t* MemoryArena::get_writable_page(const std::size_t page) noexcept{
+        if(pages_.is_page_shared(page)){
+            //Page moves, the page table must drop the old pointer
+            ++direct_pointer_generation_;
+        }
+        return pages_.get_writable_page(page);
+    }
+
+    /// @brief Returns the page for direct writes.
+    /// @param page Index of the page
+    /// @return First byte of the page or nullptr if out of range or shared.
+    uint8_t* MemoryArena::get_direct_write_page(const std::size_t page) noexcept{
+        return (page < pages_.get_page_count() && !pages_.is_page_shared(page)) ? pages_.get_writable_page(page) : nullptr;
+    }
+
+    /// @brief Is the page shared with a clone?
+    /// @param page Index of the page
+    /// @return Page copied on the next write?
+    bool MemoryArena::is_page_shared(const std::size_t page) const noexcept{
+        return pages_.is_page_shared(page);
+    }
+
+    /// @brief Returns the amount of shared pages the arena copied on write.
+    /// @return Copied pages.
+    std::size_t MemoryArena::get_copied_page_count() const noexcept{
+        return pages_.get_copied_page_count();
+    }
+
+    /// @brief Returns the counter of the direct pointer generation, bumped when pages are shared or copied.
+    /// @return Counter of the direct pointer generation.
+    const uint32_t* MemoryArena::get_direct_pointer_generation_counter() const noexcept{
+        return &direct_pointer_generation_;
+    }
+
+    /// @brief Grants access to the dirty pages of the arena.
+    /// @details Page covers the arena bytes from index * DirtyPageTracker::page_size.
+    /// @return Dirty pages of the arena.
+    DirtyPageTracker& MemoryArena::get_dirty_pages() noexcept{
+        return dirty_pages_;
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,124 @@
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#include <vector> //std::vector
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "dirty_page_tracker.h" //DirtyPageTracker
+#include "copy_on_write_pages.h" //CopyOnWritePages
+
+namespace mygbc{
+
+    /// @brief Every emulated memory region of a instance, in pages shared copy on write with its clones.
+    /// @details Regions are laid out in the given order, each starting at a page boundary so their pages are cache aligned
+    ///          and map to single dirty flags. Starts as a single allocation. Cloning shares every page, the first write to a
+    ///          shared page copies just that page and bumps the direct pointer generation, so views hand out direct write
+    ///          pointers only to pages not shared. Dirty pages are tracked over the whole arena. Single owner, ArenaMemory views
+    ///          mount the regions.
+    class MemoryArena{
+        public:
+
+            //Alignment of every region, the size of a page
+            static constexpr std::size_t region_alignment = CopyOnWritePages::page_size;
+
+            /// @brief Allocates the arena, every region zeroed.
+            /// @param region_sizes Sizes of the regions in bytes, in layout order
+            explicit MemoryArena(const std::vector<std::size_t>& region_sizes);
+
+            //Views point into the pages
+            MemoryArena(const MemoryArena&) = delete;
+            MemoryArena& operator=(const MemoryArena&) = delete;
+
+            /// @brief Clones the arena sharing every page with it.
+            /// @details Pages of the arena become shared too, both copy the pages they write to. Layout and dirty pages are carried over.
+            ///          Must not race with accesses of the arena.
+            /// @return Clone of the arena.
+            std::shared_ptr<MemoryArena> clone();
+
+            /// @brief Zeroes every region, every page becomes dirty.
+            void reset() noexcept;
+
+            /// @brief Returns the size of the region including its padding.
+            /// @param region Index of the region in the layout
+            /// @return Size of the region in bytes, 0 if there is no such region.
+            std::size_t get_region_size(const std::size_t region) const noexcept;
+
+            /// @brief Returns the offset of the region from the start of the arena.
+            /// @param region Index of the region in the layout
+            /// @return Offset of the region in bytes, the size of the arena if there is no such region.
+            std::size_t get_region_offset(const std::size_t region) const noexcept;
+
+            /// @brief Returns the amount of regions in the layout.
+            /// @return Region count.
+            std::size_t get_region_count() const noexcept;
+
+            /// @brief Returns the size of the arena including the padding between the regions.
+            /// @return Size of the arena in bytes.
+            std::size_t get_size() const noexcept;
+
+            /// @brief Returns the byte at the offset.
+            /// @param offset Offset from the start of the arena, in range
+            /// @return Value of the byte.
+            uint8_t get_byte(const std::size_t offset) const noexcept{
+                return pages_.get_byte(offset);
+            }
+
+            /// @brief Sets the byte at the offset and marks its page dirty, copying the page first if shared.
+            /// @param offset Offset from the start of the arena, in range
+            /// @param value Byte, New value.
+            void set_byte(const std::size_t offset, const uint8_t value) noexcept{
+                get_writable_page(offset / CopyOnWritePages::page_size)[offset % CopyOnWritePages::page_size] = value;
+                dirty_pages_.mark(offset);
+            }
+
+            /// @brief Returns the page for reading.
+            /// @param page Index of the page, in range
+            /// @return First byte of the page, valid until the direct pointer generation changes.
+            const uint8_t* get_page(const std::size_t page) const noexcept;
+
+            /// @brief Returns the page for writing, copying it first if shared. Does not mark it dirty.
+            /// @param page Index of the page, in range
+            /// @return First byte of the page, valid until the direct pointer generation changes.
+            uint8_t* get_writable_page(const std::size_t page) noexcept;
+
+            /// @brief Returns the page for direct writes.
+            /// @param page Index of the page
+            /// @return First byte of the page or nullptr if out of range or shared.
+            uint8_t* get_direct_write_page(const std::size_t page) noexcept;
+
+            /// @brief Is the page shared with a clone?
+            /// @param page Index of the page
+            /// @return Page copied on the next write?
+            bool is_page_shared(const std::size_t page) const noexcept;
+
+            /// @brief Returns the amount of shared pages the arena copied on write.
+            /// @return Copied pages.
+            std::size_t get_copied_page_count() const noexcept;
+
+            /// @brief Returns the counter of the direct pointer generation, bumped when pages are shared or copied.
+            /// @return Counter of the direct pointer generation.
+            const uint32_t* get_direct_pointer_generation_counter() const noexcept;
+
+            /// @brief Grants access to the dirty pages of the arena.
+            /// @details Page covers the arena bytes from index * DirtyPageTracker::page_size.
+            /// @return Dirty pages of the arena.
+            DirtyPageTracker& get_dirty_pages() noexcept;
+
+        private:
+
+            //Region => offset, one past the last region holds the size of the arena
+            std::vector<std::size_t> region_offsets_;
+
+            //Every region of the instance
+            CopyOnWritePages pages_;
+
+            //Pages written since the last clear
+            DirtyPageTracker dirty_pages_;
+
+            //Bumped when pages are shared or copied
+            uint32_t direct_pointer_generation_;
+    };
+
+}//namespace_mygbc
+
+#endif
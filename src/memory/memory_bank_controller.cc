@@ -0,0 +1,646 @@
+#include "memory_bank_controller.h" //MemoryBankController
+#include <string> //std::to_string
+#include <algorithm> //std::max
+
+namespace mygbc{
+
+    namespace{
+        //Bytes in the ROM and RAM areas of the bus
+        constexpr std::size_t rom_area_size = 0x8000;
+        constexpr std::size_t ram_area_size = 0x2000;
+
+        //MBC2 built-in RAM, 512 half bytes
+        constexpr std::size_t mbc2_ram_size = 0x200;
+
+        //Value read from unmapped or disabled cartridge memory
+        constexpr uint8_t open_bus_value = 0xFF;
+
+        //MBC3 clock register selects
+        constexpr uint8_t clock_register_first = 0x08;
+        constexpr uint8_t clock_register_last = 0x0C;
+
+        /// @brief Translates the RAM size header byte into bytes.
+        /// @param ram_size_code RAM size header byte (0x149)
+        /// @return RAM size in bytes, 0 for unknown codes.
+        std::size_t get_ram_size(const uint8_t ram_size_code){
+            switch(ram_size_code){
+                case 0x01: return 0x800;
+                case 0x02: return 0x2000;
+                case 0x03: return 0x8000;
+                case 0x04: return 0x20000;
+                case 0x05: return 0x10000;
+                default: return 0;
+            }
+        }
+
+        /// @brief Is the value written to the enable register enabling RAM?
+        /// @param value Written value
+        /// @return RAM enabled?
+        constexpr bool is_ram_enable_value(const uint8_t value){
+            return (value & 0x0F) == 0x0A;
+        }
+    }
+
+    /// @brief Builds the controller for the cartridge type.
+    /// @param cartridge_type Cartridge type header byte (0x147)
+    /// @param rom ROM image
+    /// @param ram_size_code RAM size header byte (0x149)
+    /// @return Controller or error Status if the cartridge type is not supported.
+    StatusOr<std::shared_ptr<MemoryBankController>> MemoryBankController::create(const uint8_t cartridge_type, std::vector<uint8_t> rom, const uint8_t ram_size_code){
+        std::shared_ptr<const std::vector<uint8_t>> rom_image = std::make_shared<const std::vector<uint8_t>>(std::move(rom));
+        const std::span<const uint8_t> rom_bytes(*rom_image);
+        return create(cartridge_type, std::move(rom_image), rom_bytes, ram_size_code);
+    }
+
+    /// @brief Builds the controller for the cartridge type over a shared ROM image, without copying it.
+    /// @param cartridge_type Cartridge type header byte (0x147)
+    /// @param rom_owner Owner keeping the ROM image alive
+    /// @param rom Bytes of the ROM image
+    /// @param ram_size_code RAM size header byte (0x149)
+    /// @return Controller or error Status if the cartridge type is not supported.
+    StatusOr<std::shared_ptr<MemoryBankController>> MemoryBankController::create(const uint8_t cartridge_type, std::shared_ptr<const void> rom_owner, std::span<const uint8_t> rom, const uint8_t ram_size_code){
+        Type type = Type::ROM_ONLY;
+        switch(cartridge_type){
+            case 0x00: case 0x08: case 0x09: type = Type::ROM_ONLY; break; //ROM [+ RAM [+ BATTERY]]
+            case 0x01: case 0x02: case 0x03: type = Type::MBC1; break; //MBC1 [+ RAM [+ BATTERY]]
+            case 0x05: case 0x06: type = Type::MBC2; break; //MBC2 [+ BATTERY]
+            case 0x0F: case 0x10: case 0x11: case 0x12: case 0x13: type = Type::MBC3; break; //MBC3 [+ TIMER] [+ RAM] [+ BATTERY]
+            case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: type = Type::MBC5; break; //MBC5 [+ RUMBLE] [+ RAM] [+ BATTERY]
+            default:
+                return Status::invalid_binary_error(
+                    "Cartridge type is not supported! (" + std::to_string(cartridge_type) + ")"
+                );
+        }
+        const std::size_t ram_size = (type == Type::MBC2) ? mbc2_ram_size : get_ram_size(ram_size_code);
+        return std::shared_ptr<MemoryBankController>(new MemoryBankController(type, std::move(rom_owner), rom, ram_size));
+    }
+
+    /// @brief Builds the controller described by the header of the binary.
+    /// @details Shared binaries share their image with the controller, the bytes of the rest are copied.
+    /// @param binary Parsed binary
+    /// @return Controller or error Status if the cartridge type is not supported.
+    StatusOr<std::shared_ptr<MemoryBankController>> MemoryBankController::create_from_binary(GBCBinary& binary){
+        const GBCBinary::GBCBinaryHeaderData& header = binary.get_header_data();
+        if(binary.is_shared()){
+            return create(header.cartridge_type, binary.get_shared_image(), binary.get_bytes(), header.ram_size);
+        }
+        //Bytes of the binary may change or be freed, the controller holds its own copy
+        const std::span<const uint8_t> bytes = binary.get_bytes();
+        return create(header.cartridge_type, std::vector<uint8_t>(bytes.begin(), bytes.end()), header.ram_size);
+    }
+
+    /// @brief Initializes the controller, use create.
+    /// @param type Controller type
+    /// @param rom_owner Owner keeping the ROM image alive
+    /// @param rom Bytes of the ROM image
+    /// @param ram_size RAM size in bytes
+    MemoryBankController::MemoryBankController(const Type type, std::shared_ptr<const void> rom_owner, std::span<const uint8_t> rom, const std::size_t ram_size)
+    :type_(type), rom_owner_(std::move(rom_owner)), rom_(rom), ram_(ram_size), ram_dirty_pages_(ram_size), ram_enabled_(false), bank_register_low_(0), bank_register_high_(0),
+    rom_bank_high_bit_(0), banking_mode_(0), latch_register_(0xFF), rom_bank_fixed_(0), rom_bank_switchable_(1), ram_bank_(0),
+    clock_selected_(false), mapped_ram_enabled_(false), direct_pointer_generation_(0), contents_generation_(0), real_time_clock_{}, latched_real_time_clock_{}, rom_view_(*this), ram_view_(*this){
+        //ROM only cartridges have no control registers, RAM is always on
+        ram_enabled_ = (type_ == Type::ROM_ONLY);
+        update_banks();
+    }
+
+    /// @brief Returns the clone of the controller made during the fork, cloning it on first use.
+    /// @details Clone shares the ROM image and the RAM pages copy on write, control registers and clocks are copied.
+    /// @param clones Clones made during the same fork
+    /// @return Clone of the controller.
+    std::shared_ptr<MemoryBankController> MemoryBankController::get_clone(MemoryCloneMap& clones){
+        auto existing_clone = clones.find(this);
+        if(existing_clone != clones.end()){
+            return std::static_pointer_cast<MemoryBankController>(existing_clone->second);
+        }
+        std::shared_ptr<MemoryBankController> controller_clone(new MemoryBankController(type_, rom_owner_, rom_, 0));
+        controller_clone->ram_ = ram_.share();
+        //Direct writes to the pages must stop until they are copied
+        ++direct_pointer_generation_;
+        controller_clone->ram_dirty_pages_ = ram_dirty_pages_;
+        controller_clone->ram_enabled_ = ram_enabled_;
+        controller_clone->bank_register_low_ = bank_register_low_;
+        controller_clone->bank_register_high_ = bank_register_high_;
+        controller_clone->rom_bank_high_bit_ = rom_bank_high_bit_;
+        controller_clone->banking_mode_ = banking_mode_;
+        controller_clone->latch_register_ = latch_register_;
+        controller_clone->real_time_clock_ = real_time_clock_;
+        controller_clone->latched_real_time_clock_ = latched_real_time_clock_;
+        controller_clone->update_banks();
+        clones.emplace(this, controller_clone);
+        return controller_clone;
+    }
+
+    /// @brief Returns the ROM view, to be mounted at rom_mount_address.
+    /// @details View shares the ownership of the controller.
+    /// @return ROM view.
+    std::shared_ptr<SystemMemoryInterface> MemoryBankController::get_rom_view(){
+        return std::shared_ptr<SystemMemoryInterface>(shared_from_this(), &rom_view_);
+    }
+
+    /// @brief Returns the RAM view, to be mounted at ram_mount_address.
+    /// @details View shares the ownership of the controller.
+    /// @return RAM view.
+    std::shared_ptr<SystemMemoryInterface> MemoryBankController::get_ram_view(){
+        return std::shared_ptr<SystemMemoryInterface>(shared_from_this(), &ram_view_);
+    }
+
+    /// @brief Returns the type of the controller.
+    /// @return Controller type.
+    MemoryBankController::Type MemoryBankController::get_type() const noexcept{
+        return type_;
+    }
+
+    /// @brief Returns the ROM bank mapped at 0x4000-0x7FFF.
+    /// @return ROM bank number.
+    uint16_t MemoryBankController::get_rom_bank() const noexcept{
+        return rom_bank_switchable_;
+    }
+
+    /// @brief Returns the RAM bank mapped at 0xA000-0xBFFF.
+    /// @return RAM bank number.
+    uint8_t MemoryBankController::get_ram_bank() const noexcept{
+        return ram_bank_;
+    }
+
+    /// @brief Is the cartridge RAM enabled?
+    /// @return RAM enabled?
+    bool MemoryBankController::is_ram_enabled() const noexcept{
+        return ram_enabled_;
+    }
+
+    /// @brief Returns a copy of the cartridge RAM, for battery saves.
+    /// @return RAM image.
+    std::vector<uint8_t> MemoryBankController::get_ram() const{
+        return ram_.get_contents();
+    }
+
+    /// @brief Returns the pages of the cartridge RAM written since the last clear.
+    /// @details Page covers the RAM image bytes from index * DirtyPageTracker::page_size.
+    /// @return Dirty page indices in ascending order.
+    std::vector<uint16_t> MemoryBankController::get_dirty_ram_pages() const{
+        return ram_dirty_pages_.get_dirty_pages();
+    }
+
+    /// @brief Marks every page of the cartridge RAM clean, taken as the new checkpoint.
+    void MemoryBankController::clear_dirty_ram_pages() noexcept{
+        ram_dirty_pages_.clear();
+    }
+
+    /// @brief Returns the running real time clock of MBC3.
+    /// @return Real time clock registers.
+    const MemoryBankController::RealTimeClock& MemoryBankController::get_real_time_clock() const noexcept{
+        return real_time_clock_;
+    }
+
+    /// @brief Advances the real time clock of MBC3 unless halted.
+    /// @param seconds Seconds to advance
+    void MemoryBankController::advance_real_time_clock(const uint32_t seconds) noexcept{
+        const uint8_t halt_bit = 0x40;
+        const uint8_t carry_bit = 0x80;
+        if(real_time_clock_.days_high & halt_bit){
+            return;
+        }
+        const uint64_t total_seconds = static_cast<uint64_t>(real_time_clock_.seconds) + seconds;
+        const uint64_t total_minutes = real_time_clock_.minutes + total_seconds / 60;
+        const uint64_t total_hours = real_time_clock_.hours + total_minutes / 60;
+        const uint64_t total_days = ((static_cast<uint64_t>(real_time_clock_.days_high & 0x01) << 8) | real_time_clock_.days_low) + total_hours / 24;
+        real_time_clock_.seconds = static_cast<uint8_t>(total_seconds % 60);
+        real_time_clock_.minutes = static_cast<uint8_t>(total_minutes % 60);
+        real_time_clock_.hours = static_cast<uint8_t>(total_hours % 24);
+        real_time_clock_.days_low = static_cast<uint8_t>(total_days);
+        real_time_clock_.days_high = static_cast<uint8_t>(
+            (real_time_clock_.days_high & (halt_bit | carry_bit)) | ((total_days >> 8) & 0x01) | ((total_days > 0x1FF) ? carry_bit : 0)
+        );
+    }
+
+    /// @brief Handles a write to the ROM area.
+    /// @param addr Address in the ROM area
+    /// @param value Written value
+    void MemoryBankController::write_control(const uint16_t addr, const uint8_t value) noexcept{
+        switch(type_){
+            case Type::MBC1:
+                if(addr < 0x2000){ ram_enabled_ = is_ram_enable_value(value); }
+                else if(addr < 0x4000){ bank_register_low_ = value & 0x1F; }
+                else if(addr < 0x6000){ bank_register_high_ = value & 0x03; }
+                else{ banking_mode_ = value & 0x01; }
+                break;
+            case Type::MBC2:
+                //Address bit 8 selects between RAM enable and ROM bank
+                if(addr < 0x4000){
+                    if(addr & 0x0100){ bank_register_low_ = value & 0x0F; }
+                    else{ ram_enabled_ = is_ram_enable_value(value); }
+                }
+                break;
+            case Type::MBC3:
+                if(addr < 0x2000){ ram_enabled_ = is_ram_enable_value(value); }
+                else if(addr < 0x4000){ bank_register_low_ = value & 0x7F; }
+                else if(addr < 0x6000){ bank_register_high_ = value; }
+                else{
+                    //Writing 0 then 1 latches the clock
+                    if(latch_register_ == 0x00 && value == 0x01){
+                        latched_real_time_clock_ = real_time_clock_;
+                    }
+                    latch_register_ = value;
+                }
+                break;
+            case Type::MBC5:
+                if(addr < 0x2000){ ram_enabled_ = is_ram_enable_value(value); }
+                else if(addr < 0x3000){ bank_register_low_ = value; }
+                else if(addr < 0x4000){ rom_bank_high_bit_ = value & 0x01; }
+                else if(addr < 0x6000){ bank_register_high_ = value & 0x0F; }
+                break;
+            default:
+                //ROM only, writes are ignored
+                return;
+        }
+        update_banks();
+    }
+
+    /// @brief Recomputes the mapped banks from the control registers.
+    /// @details Bumps the direct pointer generation if the mapping changed.
+    void MemoryBankController::update_banks() noexcept{
+        uint16_t rom_bank_fixed = 0;
+        uint16_t rom_bank_switchable = 1;
+        uint8_t ram_bank = 0;
+        bool clock_selected = false;
+        switch(type_){
+            case Type::MBC1:
+                rom_bank_switchable = static_cast<uint16_t>((bank_register_high_ << 5) | (bank_register_low_ == 0 ? 1 : bank_register_low_));
+                rom_bank_fixed = banking_mode_ ? static_cast<uint16_t>(bank_register_high_ << 5) : 0;
+                ram_bank = banking_mode_ ? bank_register_high_ : 0;
+                break;
+            case Type::MBC2:
+                rom_bank_switchable = (bank_register_low_ == 0) ? 1 : bank_register_low_;
+                break;
+            case Type::MBC3:
+                rom_bank_switchable = (bank_register_low_ == 0) ? 1 : bank_register_low_;
+                clock_selected = bank_register_high_ >= clock_register_first && bank_register_high_ <= clock_register_last;
+                ram_bank = clock_selected ? 0 : (bank_register_high_ & 0x03);
+                break;
+            case Type::MBC5:
+                rom_bank_switchable = static_cast<uint16_t>((rom_bank_high_bit_ << 8) | bank_register_low_);
+                ram_bank = bank_register_high_;
+                break;
+            default:
+                break;
+        }
+        //Banks past the end of the images wrap around
+        const std::size_t rom_bank_count = std::max<std::size_t>(rom_.size() / rom_bank_size, 1);
+        const std::size_t ram_bank_count = std::max<std::size_t>(ram_.get_size() / ram_bank_size, 1);
+        rom_bank_fixed = static_cast<uint16_t>(rom_bank_fixed % rom_bank_count);
+        rom_bank_switchable = static_cast<uint16_t>(rom_bank_switchable % rom_bank_count);
+        ram_bank = static_cast<uint8_t>(ram_bank % ram_bank_count);
+        if(rom_bank_fixed != rom_bank_fixed_ || rom_bank_switchable != rom_bank_switchable_ || ram_bank != ram_bank_ ||
+           clock_selected != clock_selected_ || ram_enabled_ != mapped_ram_enabled_){
+            ++direct_pointer_generation_;
+        }
+        rom_bank_fixed_ = rom_bank_fixed;
+        rom_bank_switchable_ = rom_bank_switchable;
+        ram_bank_ = ram_bank;
+        clock_selected_ = clock_selected;
+        mapped_ram_enabled_ = ram_enabled_;
+    }
+
+    /// @brief Returns the ROM byte mapped at the address.
+    /// @param addr Address in the ROM area
+    /// @return Pointer into the ROM image or nullptr if outside of it.
+    const uint8_t* MemoryBankController::get_rom_pointer(const uint16_t addr) const noexcept{
+        const std::size_t bank = (addr < rom_bank_size) ? rom_bank_fixed_ : rom_bank_switchable_;
+        const std::size_t offset = bank * rom_bank_size + (addr % rom_bank_size);
+        return (addr < rom_area_size && offset < rom_.size()) ? rom_.data() + offset : nullptr;
+    }
+
+    /// @brief Returns the offset of the RAM byte mapped at the address, if accessed directly.
+    /// @param addr Address in the RAM area
+    /// @return Offset into the RAM image or the size of the image if disabled, not plain RAM or outside of it.
+    std::size_t MemoryBankController::get_ram_offset(const uint16_t addr) const noexcept{
+        if(!ram_enabled_ || clock_selected_ || type_ == Type::MBC2){
+            return ram_.get_size();
+        }
+        const std::size_t offset = static_cast<std::size_t>(ram_bank_) * ram_bank_size + addr;
+        return (addr < ram_area_size && offset < ram_.get_size()) ? offset : ram_.get_size();
+    }
+
+    /// @brief Sets the RAM byte and marks its page dirty, copying the page first if shared.
+    /// @param offset Offset into the RAM image, in range
+    /// @param value Byte, New value.
+    void MemoryBankController::write_ram(const std::size_t offset, const uint8_t value) noexcept{
+        if(ram_.is_page_shared(offset / CopyOnWritePages::page_size)){
+            //Page moves, the page table must drop the old pointer
+            ++direct_pointer_generation_;
+        }
+        ram_.set_byte(offset, value);
+        ram_dirty_pages_.mark(offset);
+    }
+
+    /// @brief Returns the selected real time clock register of MBC3.
+    /// @param clock Clock to access
+    /// @return Selected register.
+    uint8_t& MemoryBankController::get_clock_register(RealTimeClock& clock) noexcept{
+        switch(bank_register_high_){
+            case 0x08: return clock.seconds;
+            case 0x09: return clock.minutes;
+            case 0x0A: return clock.hours;
+            case 0x0B: return clock.days_low;
+            default: return clock.days_high;
+        }
+    }
+
+    /// @brief Initializes the view of the ROM area.
+    /// @param controller Owning controller
+    MemoryBankController::RomView::RomView(MemoryBankController& controller):controller_(controller){
+    }
+
+    /// @brief Returns the byte mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return byte value located at the given address or error Status.
+    StatusOr<uint8_t> MemoryBankController::RomView::get_byte(const uint16_t addr) noexcept{
+        if(addr >= rom_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge ROM read! (Addr: " + std::to_string(addr) + ")");
+        }
+        const uint8_t* byte = controller_.get_rom_pointer(addr);
+        return (byte != nullptr) ? *byte : open_bus_value;
+    }
+
+    /// @brief Returns the word mapped at the given address, low byte first.
+    /// @param addr Zero based address.
+    /// @return Word value located at the given address or error Status.
+    StatusOr<uint16_t> MemoryBankController::RomView::get_word(const uint16_t addr) noexcept{
+        StatusOr<uint8_t> low_byte = get_byte(addr);
+        StatusOr<uint8_t> high_byte = get_byte(addr + 1);
+        if(!high_byte.ok() || !low_byte.ok()){
+            return Status::invalid_index_error("Invalid address given for cartridge ROM word read! (Addr: " + std::to_string(addr) + ")");
+        }
+        return static_cast<uint16_t>((high_byte.value() << 8) | low_byte.value());
+    }
+
+    /// @brief Returns a copy of the currently mapped ROM area.
+    /// @return Copy of the ROM area.
+    std::vector<uint8_t> MemoryBankController::RomView::get_memory(){
+        std::vector<uint8_t> contents(rom_area_size, open_bus_value);
+        for(std::size_t addr = 0; addr < rom_area_size; ++addr){
+            const uint8_t* byte = controller_.get_rom_pointer(static_cast<uint16_t>(addr));
+            contents[addr] = (byte != nullptr) ? *byte : open_bus_value;
+        }
+        return contents;
+    }
+
+    /// @brief Returns the size of the ROM area.
+    /// @return Size of the ROM area in bytes.
+    std::size_t MemoryBankController::RomView::get_memory_size(){
+        return rom_area_size;
+    }
+
+    /// @brief Passes the write to the control registers of the controller.
+    /// @param addr Zero based address.
+    /// @param value Byte, New value.
+    /// @return Returns status of the set
+    Status MemoryBankController::RomView::set_byte(const uint16_t addr, const uint8_t value) noexcept{
+        if(addr >= rom_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge ROM write! (Addr: " + std::to_string(addr) + ")");
+        }
+        controller_.write_control(addr, value);
+        return Status::ok_status();
+    }
+
+    /// @brief Passes the write to the control registers of the controller, low byte first.
+    /// @param addr Zero based address.
+    /// @param value Word, New value.
+    /// @return Returns status of the set
+    Status MemoryBankController::RomView::set_word(const uint16_t addr, const uint16_t value) noexcept{
+        if(addr + 1 >= rom_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge ROM word write! (Addr: " + std::to_string(addr) + ")");
+        }
+        controller_.write_control(addr, static_cast<uint8_t>(value));
+        controller_.write_control(addr + 1, static_cast<uint8_t>(value >> 8));
+        return Status::ok_status();
+    }
+
+    /// @brief ROM can't be replaced.
+    /// @param contents new contents of the memory
+    /// @return Protected memory status.
+    Status MemoryBankController::RomView::set_memory(const std::vector<uint8_t>& contents) noexcept{
+        return Status::protected_memory_set_error("Tried to set the contents of the cartridge ROM!");
+    }
+
+    /// @brief ROM is owned by the controller, nothing to free.
+    void MemoryBankController::RomView::free(){
+    }
+
+    /// @brief Returns a pointer to the ROM byte mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer into the ROM image or nullptr if outside of it.
+    const uint8_t* MemoryBankController::RomView::get_direct_read_pointer(const uint16_t addr) noexcept{
+        return controller_.get_rom_pointer(addr);
+    }
+
+    /// @brief Returns the counter of the direct pointer generation, bumped on bank switches.
+    /// @return Counter of the direct pointer generation.
+    const uint32_t* MemoryBankController::RomView::get_direct_pointer_generation_counter() const noexcept{
+        return &controller_.direct_pointer_generation_;
+    }
+
+    /// @brief Returns the generation of the contents, kept across bank switches.
+    /// @return Generation of the contents.
+    uint32_t MemoryBankController::RomView::get_contents_generation() const noexcept{
+        return controller_.contents_generation_;
+    }
+
+    /// @brief Returns the number of the ROM bank mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return Tag of the mapped bank.
+    uint16_t MemoryBankController::RomView::get_bank_tag(const uint16_t addr) const noexcept{
+        return (addr < rom_bank_size) ? controller_.rom_bank_fixed_ : controller_.rom_bank_switchable_;
+    }
+
+    /// @brief Clones the ROM view together with its controller.
+    /// @param clones Clones made during the same fork
+    /// @return ROM view of the controller clone.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> MemoryBankController::RomView::clone(MemoryCloneMap& clones){
+        return controller_.get_clone(clones)->get_rom_view();
+    }
+
+    /// @brief Initializes the view of the RAM area.
+    /// @param controller Owning controller
+    MemoryBankController::RamView::RamView(MemoryBankController& controller):controller_(controller){
+    }
+
+    /// @brief Returns the byte mapped at the given address.
+    /// @details Disabled or missing RAM reads as 0xFF, MBC2 RAM as half bytes, MBC3 clock registers as latched.
+    /// @param addr Zero based address.
+    /// @return byte value located at the given address or error Status.
+    StatusOr<uint8_t> MemoryBankController::RamView::get_byte(const uint16_t addr) noexcept{
+        if(addr >= ram_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge RAM read! (Addr: " + std::to_string(addr) + ")");
+        }
+        if(!controller_.ram_enabled_){
+            return open_bus_value;
+        }
+        if(controller_.clock_selected_){
+            return controller_.get_clock_register(controller_.latched_real_time_clock_);
+        }
+        if(controller_.type_ == Type::MBC2){
+            return static_cast<uint8_t>(0xF0 | controller_.ram_.get_byte(addr % mbc2_ram_size));
+        }
+        const std::size_t offset = controller_.get_ram_offset(addr);
+        return (offset < controller_.ram_.get_size()) ? controller_.ram_.get_byte(offset) : open_bus_value;
+    }
+
+    /// @brief Returns the word mapped at the given address, low byte first.
+    /// @param addr Zero based address.
+    /// @return Word value located at the given address or error Status.
+    StatusOr<uint16_t> MemoryBankController::RamView::get_word(const uint16_t addr) noexcept{
+        StatusOr<uint8_t> low_byte = get_byte(addr);
+        StatusOr<uint8_t> high_byte = get_byte(addr + 1);
+        if(!high_byte.ok() || !low_byte.ok()){
+            return Status::invalid_index_error("Invalid address given for cartridge RAM word read! (Addr: " + std::to_string(addr) + ")");
+        }
+        return static_cast<uint16_t>((high_byte.value() << 8) | low_byte.value());
+    }
+
+    /// @brief Returns a copy of the currently mapped RAM area.
+    /// @return Copy of the RAM area.
+    std::vector<uint8_t> MemoryBankController::RamView::get_memory(){
+        std::vector<uint8_t> contents(ram_area_size, open_bus_value);
+        for(std::size_t addr = 0; addr < ram_area_size; ++addr){
+            contents[addr] = get_byte(static_cast<uint16_t>(addr)).value();
+        }
+        return contents;
+    }
+
+    /// @brief Returns the size of the RAM area.
+    /// @return Size of the RAM area in bytes.
+    std::size_t MemoryBankController::RamView::get_memory_size(){
+        return ram_area_size;
+    }
+
+    /// @brief Sets the byte mapped at the given address.
+    /// @details Writes to disabled or missing RAM are ignored, MBC3 clock register writes set the running clock.
+    /// @param addr Zero based address.
+    /// @param value Byte, New value.
+    /// @return Returns status of the set
+    Status MemoryBankController::RamView::set_byte(const uint16_t addr, const uint8_t value) noexcept{
+        if(addr >= ram_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge RAM write! (Addr: " + std::to_string(addr) + ")");
+        }
+        if(!controller_.ram_enabled_){
+            return Status::ok_status();
+        }
+        if(controller_.clock_selected_){
+            controller_.get_clock_register(controller_.real_time_clock_) = value;
+        }
+        else if(controller_.type_ == Type::MBC2){
+            controller_.write_ram(addr % mbc2_ram_size, value & 0x0F);
+        }
+        else if(const std::size_t offset = controller_.get_ram_offset(addr); offset < controller_.ram_.get_size()){
+            controller_.write_ram(offset, value);
+        }
+        return Status::ok_status();
+    }
+
+    /// @brief Sets the word mapped at the given address, low byte first.
+    /// @param addr Zero based address.
+    /// @param value Word, New value.
+    /// @return Returns status of the set
+    Status MemoryBankController::RamView::set_word(const uint16_t addr, const uint16_t value) noexcept{
+        if(addr + 1 >= ram_area_size){
+            return Status::invalid_index_error("Invalid address given for cartridge RAM word write! (Addr: " + std::to_string(addr) + ")");
+        }
+        Status low_status = set_byte(addr, static_cast<uint8_t>(value));
+        if(!low_status.ok()){
+            return low_status;
+        }
+        return set_byte(addr + 1, static_cast<uint8_t>(value >> 8));
+    }
+
+    /// @brief Sets the whole cartridge RAM, for loading battery saves.
+    /// @param contents new contents of the RAM
+    /// @return Returns status of the set
+    Status MemoryBankController::RamView::set_memory(const std::vector<uint8_t>& contents) noexcept{
+        if(contents.size() != controller_.ram_.get_size()){
+            return Status::invalid_input_error(
+                "Cartridge RAM size mismatch! (" + std::to_string(contents.size()) + " / " + std::to_string(controller_.ram_.get_size()) + ")"
+            );
+        }
+        //Shared pages are copied, their direct pointers move
+        controller_.ram_.set_contents(contents);
+        controller_.ram_dirty_pages_.mark_all();
+        ++controller_.direct_pointer_generation_;
+        ++controller_.contents_generation_;
+        return Status::ok_status();
+    }
+
+    /// @brief RAM is owned by the controller, nothing to free.
+    void MemoryBankController::RamView::free(){
+    }
+
+    /// @brief Returns a pointer to the RAM page mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer into the RAM image or nullptr if not plain RAM or not at a page start.
+    const uint8_t* MemoryBankController::RamView::get_direct_read_pointer(const uint16_t addr) noexcept{
+        const std::size_t offset = controller_.get_ram_offset(addr);
+        return (offset < controller_.ram_.get_size() && offset % CopyOnWritePages::page_size == 0) ? controller_.ram_.get_page(offset / CopyOnWritePages::page_size) : nullptr;
+    }
+
+    /// @brief Returns a pointer to the RAM page mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer into the RAM image or nullptr if not plain RAM, not at a page start or the page is shared.
+    uint8_t* MemoryBankController::RamView::get_direct_write_pointer(const uint16_t addr) noexcept{
+        const std::size_t offset = controller_.get_ram_offset(addr);
+        const std::size_t page = offset / CopyOnWritePages::page_size;
+        //Direct writes are tracked trough the flag of a single page
+        return (get_dirty_page_flag(addr) != nullptr && !controller_.ram_.is_page_shared(page)) ? controller_.ram_.get_writable_page(page) : nullptr;
+    }
+
+    /// @brief Returns the counter of the direct pointer generation, bumped on bank switches and when pages are shared or copied.
+    /// @return Counter of the direct pointer generation.
+    const uint32_t* MemoryBankController::RamView::get_direct_pointer_generation_counter() const noexcept{
+        return &controller_.direct_pointer_generation_;
+    }
+
+    /// @brief Returns the generation of the contents, kept across bank switches.
+    /// @return Generation of the contents.
+    uint32_t MemoryBankController::RamView::get_contents_generation() const noexcept{
+        return controller_.contents_generation_;
+    }
+
+    /// @brief Returns the tag of the RAM bank or clock register mapped at the given address.
+    /// @details Disabled RAM has its own tag, it reads as open bus.
+    /// @param addr Zero based address.
+    /// @return Tag of the mapped bank.
+    uint16_t MemoryBankController::RamView::get_bank_tag(const uint16_t addr) const noexcept{
+        const uint16_t clock_tag = 0x100;
+        if(!controller_.ram_enabled_){
+            return 0;
+        }
+        return controller_.clock_selected_ ? static_cast<uint16_t>(clock_tag | controller_.bank_register_high_) : static_cast<uint16_t>(controller_.ram_bank_ + 1);
+    }
+
+    /// @brief Clones the RAM view together with its controller.
+    /// @param clones Clones made during the same fork
+    /// @return RAM view of the controller clone.
+    StatusOr<std::shared_ptr<SystemMemoryInterface>> MemoryBankController::RamView::clone(MemoryCloneMap& clones){
+        return controller_.get_clone(clones)->get_ram_view();
+    }
+
+    /// @brief Returns the dirty flag of the RAM page mapped at the given address.
+    /// @param addr Zero based address.
+    /// @return Pointer to the flag or nullptr if not plain RAM or not at a page start.
+    uint8_t* MemoryBankController::RamView::get_dirty_page_flag(const uint16_t addr) noexcept{
+        const std::size_t offset = controller_.get_ram_offset(addr);
+        return (offset < controller_.ram_.get_size()) ? controller_.ram_dirty_pages_.get_page_flag(offset) : nullptr;
+    }
+
+    /// @brief RAM pages are not contiguous.
+    /// @return Empty view.
+    std::span<const uint8_t> MemoryBankController::RamView::get_read_view() noexcept{
+        return {};
+    }
+
+    /// @brief RAM pages are not contiguous.
+    /// @return Empty view.
+    std::span<uint8_t> MemoryBankController::RamView::get_write_view() noexcept{
+        return {};
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,261 @@
+#ifndef MEMORY_BANK_CONTROLLER_H
+#define MEMORY_BANK_CONTROLLER_H
+
+#include <vector> //std::vector
+#include <span> //std::span
+#include <memory> //std::shared_ptr, std::enable_shared_from_this
+#include <cstdint> //Fixed lenght variables
+#include "system_memory_interface.h" //SystemMemoryInterface
+#include "gbc_binary.h" //GBCBinary
+#include "dirty_page_tracker.h" //DirtyPageTracker
+#include "copy_on_write_pages.h" //CopyOnWritePages
+#include "../util/status/status.h" //Status
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Cartridge memory bank controller (ROM only, MBC1, MBC2, MBC3 with RTC, MBC5).
+    /// @details Exposes the cartridge as two memories: the ROM view for 0x0000-0x7FFF and the RAM view for 0xA000-0xBFFF.
+    ///          Writes to the ROM view are control writes. Bank switches only repoint the direct pointers of the views into
+    ///          the single ROM and RAM images and bump the direct pointer generation, MemoryController then repoints its pages.
+    ///          Nothing is copied or allocated on a switch. The contents generation is kept, pages are told apart by their bank
+    ///          tags instead, so data cached from the other pages stays valid. Clones of the views share the ROM image and share
+    ///          the RAM pages copy on write, the first write to a shared page copies it and bumps the direct pointer generation.
+    class MemoryBankController : public std::enable_shared_from_this<MemoryBankController>{
+        public:
+
+        //Supported controllers
+        enum class Type : uint8_t{
+            ROM_ONLY = 0,
+            MBC1 = 1,
+            MBC2 = 2,
+            MBC3 = 3,
+            MBC5 = 5
+        };
+
+        //Real time clock registers of MBC3
+        struct RealTimeClock{
+            uint8_t seconds;
+            uint8_t minutes;
+            uint8_t hours;
+            uint8_t days_low; //Lower 8 bits of the day counter
+            uint8_t days_high; //Bit 0: day counter bit 8, bit 6: halt, bit 7: day counter carry
+        };
+
+        //Bytes in a ROM bank
+        static constexpr std::size_t rom_bank_size = 0x4000;
+
+        //Bytes in a RAM bank
+        static constexpr std::size_t ram_bank_size = 0x2000;
+
+        //Bus addresses of the views
+        static constexpr uint16_t rom_mount_address = 0x0000;
+        static constexpr uint16_t ram_mount_address = 0xA000;
+
+        /// @brief Builds the controller for the cartridge type.
+        /// @param cartridge_type Cartridge type header byte (0x147)
+        /// @param rom ROM image
+        /// @param ram_size_code RAM size header byte (0x149)
+        /// @return Controller or error Status if the cartridge type is not supported.
+        static StatusOr<std::shared_ptr<MemoryBankController>> create(const uint8_t cartridge_type, std::vector<uint8_t> rom, const uint8_t ram_size_code);
+
+        /// @brief Builds the controller for the cartridge type over a shared ROM image, without copying it.
+        /// @param cartridge_type Cartridge type header byte (0x147)
+        /// @param rom_owner Owner keeping the ROM image alive
+        /// @param rom Bytes of the ROM image
+        /// @param ram_size_code RAM size header byte (0x149)
+        /// @return Controller or error Status if the cartridge type is not supported.
+        static StatusOr<std::shared_ptr<MemoryBankController>> create(const uint8_t cartridge_type, std::shared_ptr<const void> rom_owner, std::span<const uint8_t> rom, const uint8_t ram_size_code);
+
+        /// @brief Builds the controller described by the header of the binary.
+        /// @details Shared binaries share their image with the controller, the bytes of the rest are copied.
+        /// @param binary Parsed binary
+        /// @return Controller or error Status if the cartridge type is not supported.
+        static StatusOr<std::shared_ptr<MemoryBankController>> create_from_binary(GBCBinary& binary);
+
+        //Views point back into the controller
+        MemoryBankController(const MemoryBankController&) = delete;
+        MemoryBankController& operator=(const MemoryBankController&) = delete;
+
+        /// @brief Returns the ROM view, to be mounted at rom_mount_address.
+        /// @details View shares the ownership of the controller.
+        /// @return ROM view.
+        std::shared_ptr<SystemMemoryInterface> get_rom_view();
+
+        /// @brief Returns the RAM view, to be mounted at ram_mount_address.
+        /// @details View shares the ownership of the controller.
+        /// @return RAM view.
+        std::shared_ptr<SystemMemoryInterface> get_ram_view();
+
+        /// @brief Returns the type of the controller.
+        /// @return Controller type.
+        Type get_type() const noexcept;
+
+        /// @brief Returns the ROM bank mapped at 0x4000-0x7FFF.
+        /// @return ROM bank number.
+        uint16_t get_rom_bank() const noexcept;
+
+        /// @brief Returns the RAM bank mapped at 0xA000-0xBFFF.
+        /// @return RAM bank number.
+        uint8_t get_ram_bank() const noexcept;
+
+        /// @brief Is the cartridge RAM enabled?
+        /// @return RAM enabled?
+        bool is_ram_enabled() const noexcept;
+
+        /// @brief Returns a copy of the cartridge RAM, for battery saves.
+        /// @return RAM image.
+        std::vector<uint8_t> get_ram() const;
+
+        /// @brief Returns the pages of the cartridge RAM written since the last clear.
+        /// @details Page covers the RAM image bytes from index * DirtyPageTracker::page_size.
+        /// @return Dirty page indices in ascending order.
+        std::vector<uint16_t> get_dirty_ram_pages() const;
+
+        /// @brief Marks every page of the cartridge RAM clean, taken as the new checkpoint.
+        void clear_dirty_ram_pages() noexcept;
+
+        /// @brief Returns the running real time clock of MBC3.
+        /// @return Real time clock registers.
+        const RealTimeClock& get_real_time_clock() const noexcept;
+
+        /// @brief Advances the real time clock of MBC3 unless halted.
+        /// @param seconds Seconds to advance
+        void advance_real_time_clock(const uint32_t seconds) noexcept;
+
+        private:
+
+        /// @brief ROM area of the cartridge, 0x0000-0x7FFF.
+        class RomView : public SystemMemoryInterface{
+            public:
+            explicit RomView(MemoryBankController& controller);
+            StatusOr<uint8_t> get_byte(const uint16_t addr) noexcept override;
+            StatusOr<uint16_t> get_word(const uint16_t addr) noexcept override;
+            std::vector<uint8_t> get_memory() override;
+            std::size_t get_memory_size() override;
+            Status set_byte(const uint16_t addr, const uint8_t value) noexcept override;
+            Status set_word(const uint16_t addr, const uint16_t value) noexcept override;
+            Status set_memory(const std::vector<uint8_t>& contents) noexcept override;
+            void free() override;
+            const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override;
+            const uint32_t* get_direct_pointer_generation_counter() const noexcept override;
+            uint32_t get_contents_generation() const noexcept override;
+            uint16_t get_bank_tag(const uint16_t addr) const noexcept override;
+            StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+            private:
+            MemoryBankController& controller_;
+        };
+
+        /// @brief RAM area of the cartridge, 0xA000-0xBFFF.
+        class RamView : public SystemMemoryInterface{
+            public:
+            explicit RamView(MemoryBankController& controller);
+            StatusOr<uint8_t> get_byte(const uint16_t addr) noexcept override;
+            StatusOr<uint16_t> get_word(const uint16_t addr) noexcept override;
+            std::vector<uint8_t> get_memory() override;
+            std::size_t get_memory_size() override;
+            Status set_byte(const uint16_t addr, const uint8_t value) noexcept override;
+            Status set_word(const uint16_t addr, const uint16_t value) noexcept override;
+            Status set_memory(const std::vector<uint8_t>& contents) noexcept override;
+            void free() override;
+            const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override;
+            uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept override;
+            const uint32_t* get_direct_pointer_generation_counter() const noexcept override;
+            uint32_t get_contents_generation() const noexcept override;
+            uint16_t get_bank_tag(const uint16_t addr) const noexcept override;
+            uint8_t* get_dirty_page_flag(const uint16_t addr) noexcept override;
+            std::span<const uint8_t> get_read_view() noexcept override;
+            std::span<uint8_t> get_write_view() noexcept override;
+            StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones) override;
+            private:
+            MemoryBankController& controller_;
+        };
+
+        /// @brief Initializes the controller, use create.
+        /// @param type Controller type
+        /// @param rom_owner Owner keeping the ROM image alive
+        /// @param rom Bytes of the ROM image
+        /// @param ram_size RAM size in bytes
+        MemoryBankController(const Type type, std::shared_ptr<const void> rom_owner, std::span<const uint8_t> rom, const std::size_t ram_size);
+
+        /// @brief Returns the clone of the controller made during the fork, cloning it on first use.
+        /// @details Clone shares the ROM image and the RAM pages copy on write, control registers and clocks are copied.
+        /// @param clones Clones made during the same fork
+        /// @return Clone of the controller.
+        std::shared_ptr<MemoryBankController> get_clone(MemoryCloneMap& clones);
+
+        /// @brief Handles a write to the ROM area.
+        /// @param addr Address in the ROM area
+        /// @param value Written value
+        void write_control(const uint16_t addr, const uint8_t value) noexcept;
+
+        /// @brief Recomputes the mapped banks from the control registers.
+        /// @details Bumps the direct pointer generation if the mapping changed.
+        void update_banks() noexcept;
+
+        /// @brief Returns the ROM byte mapped at the address.
+        /// @param addr Address in the ROM area
+        /// @return Pointer into the ROM image or nullptr if outside of it.
+        const uint8_t* get_rom_pointer(const uint16_t addr) const noexcept;
+
+        /// @brief Returns the offset of the RAM byte mapped at the address, if accessed directly.
+        /// @param addr Address in the RAM area
+        /// @return Offset into the RAM image or the size of the image if disabled, not plain RAM or outside of it.
+        std::size_t get_ram_offset(const uint16_t addr) const noexcept;
+
+        /// @brief Sets the RAM byte and marks its page dirty, copying the page first if shared.
+        /// @param offset Offset into the RAM image, in range
+        /// @param value Byte, New value.
+        void write_ram(const std::size_t offset, const uint8_t value) noexcept;
+
+        /// @brief Returns the selected real time clock register of MBC3.
+        /// @param clock Clock to access
+        /// @return Selected register.
+        uint8_t& get_clock_register(RealTimeClock& clock) noexcept;
+
+        //Controller type
+        const Type type_;
+
+        //Owner of the ROM image, shared with the clones and the binary it came from
+        const std::shared_ptr<const void> rom_owner_;
+
+        //ROM and RAM images
+        const std::span<const uint8_t> rom_;
+        CopyOnWritePages ram_;
+
+        //Pages of the RAM image written since the last clear
+        DirtyPageTracker ram_dirty_pages_;
+
+        //Control registers as written
+        bool ram_enabled_;
+        uint8_t bank_register_low_; //MBC1 5 bits, MBC2 4 bits, MBC3 7 bits, MBC5 low 8 bits
+        uint8_t bank_register_high_; //MBC1 2 bits, MBC3 RAM bank or RTC select, MBC5 RAM bank
+        uint8_t rom_bank_high_bit_; //MBC5 ROM bank bit 8
+        uint8_t banking_mode_; //MBC1 mode select
+        uint8_t latch_register_; //MBC3 last latch write
+
+        //Mapping derived from the control registers
+        uint16_t rom_bank_fixed_; //Bank at 0x0000-0x3FFF
+        uint16_t rom_bank_switchable_; //Bank at 0x4000-0x7FFF
+        uint8_t ram_bank_;
+        bool clock_selected_; //MBC3 RTC register mapped instead of RAM
+        bool mapped_ram_enabled_; //RAM enable the mapping was derived with
+
+        //Bumped when the mapping changes
+        uint32_t direct_pointer_generation_;
+
+        //Bumped when the RAM image is replaced, bank switches are told apart by the bank tags
+        uint32_t contents_generation_;
+
+        //MBC3 real time clock and its latched copy
+        RealTimeClock real_time_clock_;
+        RealTimeClock latched_real_time_clock_;
+
+        //Views of the cartridge
+        RomView rom_view_;
+        RamView ram_view_;
+    };
+
+}//namespace_mygbc
+
+#endif
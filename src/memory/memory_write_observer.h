@@ -0,0 +1,25 @@
+#ifndef MEMORY_WRITE_OBSERVER_H
+#define MEMORY_WRITE_OBSERVER_H
+
+#include <cstdint> //Fixed lenght variables
+
+namespace mygbc{
+
+    /// @brief Runtime interface for components that need to know about writes to the memory.
+    /// @details Notified by the MemoryController after a successful write. Writes to read only memory fail and are not reported.
+    class MemoryWriteObserver{
+
+            public:
+            /// @brief Default destructor
+            virtual ~MemoryWriteObserver() = default;
+
+            /// @brief Called after the given range of the memory was written.
+            /// @param addr Zero based address of the write.
+            /// @param size_in_bytes Size of the write in bytes.
+            virtual void on_memory_write(const uint16_t addr, const uint16_t size_in_bytes) noexcept = 0;
+
+    };
+
+}//namespace_mygbc
+
+#endif
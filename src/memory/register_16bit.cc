@@ -1,7 +1,6 @@
 #include <stdexcept> //std::out_of_range
 #include <vector> //std::vector
 #include "register_16bit.h" //Register16Bit
-#include "../util/util.h" //Util
 
 namespace mygbc{
 
@@ -15,7 +14,7 @@ namespace mygbc{
     /// @param bit_index Index of the bit from right (0-7 value)
     /// @return bit at the given byte and bit index or error Status
     StatusOr<bool> Register16Bit::get_bit(const uint8_t byte_index, const uint8_t bit_index) noexcept{
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
         const uint8_t max_bit_index = 0x07;
         if(
             byte_index < memory_.size() &&
@@ -38,7 +37,7 @@ namespace mygbc{
     /// @param bit_value New value of the bit
     /// @return Status of the set.
     Status Register16Bit::set_bit(const uint8_t byte_index, const uint8_t bit_index, const bool bit_value) noexcept{
-        std::unique_lock<std::shared_mutex> read_lock(*memory_mutex_);
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
         const uint8_t max_bit_index = 0x07;
         if(
             byte_index < memory_.size() &&
@@ -52,6 +51,7 @@ namespace mygbc{
                 //Creates a mask like 00100 and negate it => 11011. And turns the 0 position to 0.
                 memory_[byte_index] = memory_[byte_index] & ~(1 << bit_index);
             }
+            dirty_pages_.mark(byte_index);
             return Status::ok_status();
         }
         return Status::invalid_index_error(
@@ -64,51 +64,37 @@ namespace mygbc{
     /// @brief Returns the contents of the registry as a word.
     /// @return Word value.
     uint16_t Register16Bit::get_word() noexcept{
-        std::shared_lock<std::shared_mutex> read_lock(*memory_mutex_);
-        const uint16_t byte_one_addr = 0;
-        const uint16_t byte_two_addr = 1;
-        uint16_t val = (static_cast<uint16_t>(memory_[byte_two_addr]) << 8) | static_cast<uint16_t>(memory_[byte_one_addr]);
-        return Util::nthos16_t(val);
+        std::shared_lock<std::shared_mutex> read_lock = lock_for_read();
+        return static_cast<uint16_t>((memory_[high_byte_index] << 8) | memory_[low_byte_index]);
     }
 
     /// @brief Sets the value of the register.
     /// @param value Word, New value.
     void Register16Bit::set_word(const uint16_t value) noexcept{
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
-        const uint16_t first_byte_addr = 0;
-        const uint16_t second_byte_addr = 1;
-        
-        const uint8_t * byte_ptr = reinterpret_cast<const uint8_t*>(&value);
-        memory_[first_byte_addr] = byte_ptr[second_byte_addr];
-        memory_[second_byte_addr] = byte_ptr[first_byte_addr];
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
+        memory_[high_byte_index] = static_cast<uint8_t>(value >> 8);
+        memory_[low_byte_index] = static_cast<uint8_t>(value);
+        dirty_pages_.mark(0);
     }
 
     /// @brief Increments and sets register value with given value
     /// @param value Value to increment with
     void Register16Bit::increment(const uint16_t value) noexcept{
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
-        const uint16_t byte_one_addr = 0;
-        const uint16_t byte_two_addr = 1;
-        uint16_t reg_val = (static_cast<uint16_t>(memory_[byte_two_addr]) << 8) | static_cast<uint16_t>(memory_[byte_one_addr]);
-        reg_val = Util::nthos16_t(reg_val);
-        reg_val += value;
-        const uint8_t * byte_ptr = reinterpret_cast<const uint8_t*>(&reg_val);
-        memory_[byte_one_addr] = byte_ptr[byte_two_addr];
-        memory_[byte_two_addr] = byte_ptr[byte_one_addr];
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
+        const uint16_t result = static_cast<uint16_t>(((memory_[high_byte_index] << 8) | memory_[low_byte_index]) + value);
+        memory_[high_byte_index] = static_cast<uint8_t>(result >> 8);
+        memory_[low_byte_index] = static_cast<uint8_t>(result);
+        dirty_pages_.mark(0);
     }
 
     /// @brief Decrements and sets register value with given value
     /// @param value Value to decrement with
     void Register16Bit::decrement(const uint16_t value){
-        std::unique_lock<std::shared_mutex> write_lock(*memory_mutex_);
-        const uint16_t byte_one_addr = 0;
-        const uint16_t byte_two_addr = 1;
-        uint16_t reg_val = (static_cast<uint16_t>(memory_[byte_two_addr]) << 8) | static_cast<uint16_t>(memory_[byte_one_addr]);
-        reg_val = Util::nthos16_t(reg_val);
-        reg_val -= value;
-        const uint8_t * byte_ptr = reinterpret_cast<const uint8_t*>(&reg_val);
-        memory_[byte_one_addr] = byte_ptr[byte_two_addr];
-        memory_[byte_two_addr] = byte_ptr[byte_one_addr];
+        std::unique_lock<std::shared_mutex> write_lock = lock_for_write();
+        const uint16_t result = static_cast<uint16_t>(((memory_[high_byte_index] << 8) | memory_[low_byte_index]) - value);
+        memory_[high_byte_index] = static_cast<uint8_t>(result >> 8);
+        memory_[low_byte_index] = static_cast<uint8_t>(result);
+        dirty_pages_.mark(0);
     }
 
 }//namespace_mygbc
\ No newline at end of file
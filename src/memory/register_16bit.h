@@ -49,6 +49,11 @@ namespace mygbc{
             /// @brief Decrements and sets register value with given value
             /// @param value Value to decrement with
             void decrement(const uint16_t value);
+
+        private:
+            /// @brief The register keeps its high byte first, byte indices of the bit access follow it.
+            static constexpr std::size_t high_byte_index = 0;
+            static constexpr std::size_t low_byte_index = 1;
     };
 
 }//namespace_mygbc
@@ -0,0 +1,131 @@
+#include "rom_cache.h" //RomCache
+#include <limits> //std::numeric_limits
+#include <vector> //std::vector
+#include <algorithm> //std::equal, std::min
+#include "../util/external/crc32.h" //CRC32
+
+namespace mygbc{
+
+    /// @brief Gets the process wide instance of the cache.
+    /// @return Process wide instance of the cache.
+    RomCache& RomCache::instance(){
+        static RomCache cache;
+        return cache;
+    }
+
+    /// @brief Returns a view of the cached image of the ROM, caching a copy of the bytes on a miss.
+    /// @param rom_bytes Bytes of the ROM
+    /// @return Read only binary over the cached image or error Status.
+    StatusOr<GBCBinary> RomCache::get_binary(std::span<const uint8_t> rom_bytes) noexcept{
+        const CacheKey key(get_checksum(rom_bytes), rom_bytes.size());
+        std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+        StatusOr<GBCBinary> cached_binary = find_binary(key, rom_bytes);
+        if(cached_binary.ok()){
+            return cached_binary;
+        }
+        try{
+            std::shared_ptr<const std::vector<uint8_t>> image = std::make_shared<const std::vector<uint8_t>>(rom_bytes.begin(), rom_bytes.end());
+            const std::span<const uint8_t> image_bytes(*image);
+            return insert_binary(key, std::move(image), image_bytes);
+        }
+        catch(const std::bad_alloc& e){
+            return Status::io_error(std::string("Issues with allocating memory! ") + e.what());
+        }
+    }
+
+    /// @brief Returns a view of the cached image of the ROM, caching the mapping itself on a miss.
+    /// @param mapped_file Mapping of the ROM
+    /// @return Read only binary over the cached image or error Status.
+    StatusOr<GBCBinary> RomCache::get_binary(std::shared_ptr<const MappedFile> mapped_file) noexcept{
+        if(mapped_file == nullptr){
+            return Status::invalid_binary_error("Could not parse the binary! No mapping given.");
+        }
+        const std::span<const uint8_t> image_bytes = mapped_file->get_bytes();
+        const CacheKey key(get_checksum(image_bytes), image_bytes.size());
+        std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+        StatusOr<GBCBinary> cached_binary = find_binary(key, image_bytes);
+        if(cached_binary.ok()){
+            return cached_binary;
+        }
+        return insert_binary(key, std::move(mapped_file), image_bytes);
+    }
+
+    /// @brief Maps the ROM file and returns a view of its cached image.
+    /// @param file_path The file path to the ROM.
+    /// @return Read only binary over the cached image or error Status.
+    StatusOr<GBCBinary> RomCache::load_binary(const std::string& file_path) noexcept{
+        StatusOr<std::shared_ptr<const MappedFile>> mapped_file = MappedFile::map(file_path, MappedFile::MappingHints{});
+        if(!mapped_file.ok()){
+            return mapped_file.status();
+        }
+        return get_binary(std::move(mapped_file).value());
+    }
+
+    /// @brief Returns the amount of images held, releases the entries of images without views.
+    /// @return Amount of images held.
+    std::size_t RomCache::get_image_count(){
+        std::lock_guard<std::mutex> cache_lock(cache_mutex_);
+        std::erase_if(entries_, [](const std::pair<const CacheKey, CacheEntry>& entry){
+            return entry.second.image_owner.expired();
+        });
+        return entries_.size();
+    }
+
+    /// @brief Computes the key checksum of the ROM.
+    /// @param rom_bytes Bytes of the ROM
+    /// @return CRC32 of the ROM.
+    uint32_t RomCache::get_checksum(std::span<const uint8_t> rom_bytes) noexcept{
+        //CRC32 takes 32 bit lengths, larger images are checksummed in chunks
+        uint32_t checksum = 0;
+        std::size_t offset = 0;
+        do{
+            const std::size_t chunk_size = std::min<std::size_t>(rom_bytes.size() - offset, std::numeric_limits<uint32_t>::max());
+            checksum = external::CRC32(rom_bytes.data() + offset, static_cast<uint32_t>(chunk_size), checksum);
+            offset += chunk_size;
+        }while(offset < rom_bytes.size());
+        return checksum;
+    }
+
+    /// @brief Returns a view of the cached image if the ROM is cached.
+    /// @param key Key of the ROM
+    /// @param rom_bytes Bytes of the ROM, compared against the image
+    /// @return Binary view or error Status on a miss.
+    StatusOr<GBCBinary> RomCache::find_binary(const CacheKey& key, std::span<const uint8_t> rom_bytes){
+        std::map<CacheKey, CacheEntry>::iterator entry = entries_.find(key);
+        if(entry != entries_.end()){
+            std::shared_ptr<const void> image_owner = entry->second.image_owner.lock();
+            //Same checksum and size is not a guarantee, the image is only shared if the bytes match
+            if(image_owner != nullptr && (entry->second.image_bytes.data() == rom_bytes.data() ||
+               std::equal(rom_bytes.begin(), rom_bytes.end(), entry->second.image_bytes.begin()))){
+                return GBCBinary(entry->second.header, entry->second.valid_logo, entry->second.valid_header, std::move(image_owner), entry->second.image_bytes);
+            }
+        }
+        return Status::invalid_input_error("ROM is not cached!");
+    }
+
+    /// @brief Parses the image and stores it in the cache.
+    /// @param key Key of the ROM
+    /// @param image_owner Owner of the image bytes
+    /// @param image_bytes Bytes of the image
+    /// @return Binary view or error Status.
+    StatusOr<GBCBinary> RomCache::insert_binary(const CacheKey& key, std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes){
+        std::weak_ptr<const void> entry_owner = image_owner;
+        StatusOr<GBCBinary> binary = GBCBinary::parse_shared_image(std::move(image_owner), image_bytes);
+        if(!binary.ok()){
+            return binary;
+        }
+        //Colliding live image keeps its entry, the new image is served uncached
+        std::map<CacheKey, CacheEntry>::iterator entry = entries_.find(key);
+        if(entry == entries_.end() || entry->second.image_owner.expired()){
+            entries_.insert_or_assign(key, CacheEntry{
+                std::move(entry_owner),
+                image_bytes,
+                binary.value().get_header_data(),
+                binary.value().has_valid_logo(),
+                binary.value().has_valid_header()
+            });
+        }
+        return binary;
+    }
+
+}//namespace_mygbc
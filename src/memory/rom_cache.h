@@ -0,0 +1,87 @@
+#ifndef ROM_CACHE_H
+#define ROM_CACHE_H
+
+#include <map> //std::map
+#include <span> //std::span
+#include <mutex> //std::mutex
+#include <memory> //std::shared_ptr, std::weak_ptr
+#include <string> //std::string
+#include <cstdint> //Fixed lenght variables
+#include <utility> //std::pair
+#include "gbc_binary.h" //GBCBinary
+#include "../util/io/mapped_file.h" //MappedFile
+#include "../util/status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Process wide registry of ROM images keyed by CRC32 and size.
+    /// @details Holds one immutable image and its parsed header per unique ROM and hands out read only GBCBinary views of it.
+    ///          Images are reference counted by the views, an image is released with its last view. Thread safe.
+    class RomCache{
+        public:
+
+        /// @brief Gets the process wide instance of the cache.
+        /// @return Process wide instance of the cache.
+        static RomCache& instance();
+
+        /// @brief Returns a view of the cached image of the ROM, caching a copy of the bytes on a miss.
+        /// @param rom_bytes Bytes of the ROM
+        /// @return Read only binary over the cached image or error Status.
+        StatusOr<GBCBinary> get_binary(std::span<const uint8_t> rom_bytes) noexcept;
+
+        /// @brief Returns a view of the cached image of the ROM, caching the mapping itself on a miss.
+        /// @param mapped_file Mapping of the ROM
+        /// @return Read only binary over the cached image or error Status.
+        StatusOr<GBCBinary> get_binary(std::shared_ptr<const MappedFile> mapped_file) noexcept;
+
+        /// @brief Maps the ROM file and returns a view of its cached image.
+        /// @param file_path The file path to the ROM.
+        /// @return Read only binary over the cached image or error Status.
+        StatusOr<GBCBinary> load_binary(const std::string& file_path) noexcept;
+
+        /// @brief Returns the amount of images held, releases the entries of images without views.
+        /// @return Amount of images held.
+        std::size_t get_image_count();
+
+        /// @brief Computes the key checksum of the ROM.
+        /// @param rom_bytes Bytes of the ROM
+        /// @return CRC32 of the ROM.
+        static uint32_t get_checksum(std::span<const uint8_t> rom_bytes) noexcept;
+
+        private:
+
+        //Cached image and its parsed header
+        struct CacheEntry{
+            std::weak_ptr<const void> image_owner;
+            std::span<const uint8_t> image_bytes;
+            GBCBinary::GBCBinaryHeaderData header;
+            bool valid_logo;
+            bool valid_header;
+        };
+
+        //CRC32 and size of the ROM
+        using CacheKey = std::pair<uint32_t, std::size_t>;
+
+        /// @brief Returns a view of the cached image if the ROM is cached.
+        /// @param key Key of the ROM
+        /// @param rom_bytes Bytes of the ROM, compared against the image
+        /// @return Binary view or error Status on a miss.
+        StatusOr<GBCBinary> find_binary(const CacheKey& key, std::span<const uint8_t> rom_bytes);
+
+        /// @brief Parses the image and stores it in the cache.
+        /// @param key Key of the ROM
+        /// @param image_owner Owner of the image bytes
+        /// @param image_bytes Bytes of the image
+        /// @return Binary view or error Status.
+        StatusOr<GBCBinary> insert_binary(const CacheKey& key, std::shared_ptr<const void> image_owner, std::span<const uint8_t> image_bytes);
+
+        //Lock for the entries
+        std::mutex cache_mutex_;
+
+        //Images by CRC32 and size
+        std::map<CacheKey, CacheEntry> entries_;
+    };
+
+}//namespace_mygbc
+
+#endif
@@ -2,7 +2,10 @@
 #define MEMORY_INTERFACE_H
 
 #include <concepts> //std::concept
+#include <span> //std::span
 #include <vector> //std::vector
+#include <map> //std::map
+#include <memory> //std::shared_ptr
 #include <cstdint> //Fixed lenght variables
 #include "../util/status/status_or.h"
 
@@ -21,6 +24,9 @@ namespace mygbc{
         { t.free() } -> std::same_as<void>;
     };
 
+    //Clones made during a single fork of the mounted memories, keyed by the original object. Lets memories sharing a owner clone it once
+    using MemoryCloneMap = std::map<const void*, std::shared_ptr<void>>;
+
     /// @brief Runtime interface
     class SystemMemoryInterface{
 
@@ -70,6 +76,81 @@ namespace mygbc{
             /// @details Frees the memory assosiated with the memory object.
             virtual void free() = 0;
 
+            /// @brief Returns a pointer to the byte at the given address for direct reads.
+            /// @details Used by the MemoryController page table, queried at the start of each page. Contents must be contiguous
+            ///          up to the end of the page or the memory. Memory with side effects on reads returns nullptr, reads then go
+            ///          trough get_byte. Pointer stays valid until the memory is resized, freed or the direct pointer generation changes.
+            /// @param addr Zero based address.
+            /// @return Pointer to the byte or nullptr.
+            virtual const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept{ return nullptr; }
+
+            /// @brief Returns a pointer to the byte at the given address for direct writes.
+            /// @details Used by the MemoryController page table, see get_direct_read_pointer. Read only memory and memory
+            ///          with side effects on writes returns nullptr, writes then go trough set_byte.
+            /// @param addr Zero based address.
+            /// @return Pointer to the byte or nullptr.
+            virtual uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept{ return nullptr; }
+
+            /// @brief Returns the counter of the direct pointer generation.
+            /// @details Bumped whenever the direct pointers move, for example on a bank switch, set_memory or free. MemoryController
+            ///          compares it on every direct access, so moved pointers are never used. Counter lives as long as the memory.
+            ///          Memory whose direct pointers never move returns nullptr.
+            /// @return Counter of the direct pointer generation or nullptr.
+            virtual const uint32_t* get_direct_pointer_generation_counter() const noexcept{ return nullptr; }
+
+            /// @brief Returns the generation of the direct pointers.
+            /// @details Value of the direct pointer generation counter, 0 if the memory has none.
+            ///          MemoryController rebuilds the pages of the memory when it sees a new generation.
+            /// @return Generation of the direct pointers.
+            uint32_t get_direct_pointer_generation() const noexcept{
+                const uint32_t* generation_counter = get_direct_pointer_generation_counter();
+                return (generation_counter != nullptr) ? *generation_counter : 0;
+            }
+
+            /// @brief Returns the generation of the contents mapped at the addresses of the memory.
+            /// @details Changes when the memory maps other contents at the same addresses. Moving the direct pointers without
+            ///          changing the contents, like copying a shared page on write, keeps it. So does a bank switch reported
+            ///          trough get_bank_tag. MemoryController bumps its mapping generation when it sees a new one.
+            /// @return Generation of the contents.
+            virtual uint32_t get_contents_generation() const noexcept{ return get_direct_pointer_generation(); }
+
+            /// @brief Returns the tag of the bank mapped at the given address.
+            /// @details Identifies the contents a bank switch maps at the address, the same bank always has the same tag.
+            ///          Queried at the start of each page when the direct pointers are rebuilt. Memory without banks returns 0.
+            /// @param addr Zero based address.
+            /// @return Tag of the mapped bank.
+            virtual uint16_t get_bank_tag(const uint16_t addr) const noexcept{ return 0; }
+
+            /// @brief Returns the dirty flag of the page starting at the given address.
+            /// @details Used by the MemoryController page table next to the direct write pointer, set to 1 on every direct write
+            ///          to the page. Memory tracking dirty pages only hands out direct write pointers at addresses with a flag.
+            ///          Flag stays valid like the direct pointers.
+            /// @param addr Zero based address.
+            /// @return Pointer to the flag or nullptr if dirty pages are not tracked.
+            virtual uint8_t* get_dirty_page_flag(const uint16_t addr) noexcept{ return nullptr; }
+
+            /// @brief Returns a view of the whole memory for bulk reads without copying.
+            /// @details Memory that is not contiguous or has side effects on reads returns a empty view, callers then go
+            ///          trough get_byte or get_memory. View stays valid like the direct pointers.
+            /// @return View of the memory or empty view.
+            virtual std::span<const uint8_t> get_read_view() noexcept{ return {}; }
+
+            /// @brief Returns a view of the whole memory for bulk writes without copying.
+            /// @details See get_read_view. Read only memory and memory with side effects on writes returns a empty view.
+            /// @return View of the memory or empty view.
+            virtual std::span<uint8_t> get_write_view() noexcept{ return {}; }
+
+            /// @brief Clones the memory for a forked instance.
+            /// @details Clone starts with the current contents and is independent of the memory afterwards. Memories may share
+            ///          immutable data, like a ROM image, with the clone, and writable pages copy on write. Such memories bump their
+            ///          direct pointer generation and withhold direct write pointers to the shared pages until a write copies them.
+            ///          Clones of shared owners are looked up from and added to clones.
+            /// @param clones Clones made during the same fork
+            /// @return Clone or error Status if the memory can't be cloned.
+            virtual StatusOr<std::shared_ptr<SystemMemoryInterface>> clone(MemoryCloneMap& clones){
+                return Status::invalid_input_error("Memory can't be cloned!");
+            }
+
     };
 
 }//namespace_mygbc
@@ -13,9 +13,18 @@ namespace mygbc{
         if(!binary_file){
             return Status::io_error("File at the given path was not accesible!");
         }
-        //Read and return file contents
+        //Size the buffer once and read the file contents in a single call
+        binary_file.seekg(0, std::ios::end);
+        const std::streamoff file_size = binary_file.tellg();
+        binary_file.seekg(0, std::ios::beg);
+        if(file_size < 0){
+            return Status::io_error("Could not determine the size of the file at the given path!");
+        }
         try{
-            std::vector<uint8_t> buffer(std::istreambuf_iterator<char>(binary_file), {});
+            std::vector<uint8_t> buffer(static_cast<std::size_t>(file_size));
+            if(!binary_file.read(reinterpret_cast<char*>(buffer.data()), file_size)){
+                return Status::io_error("Could not read the file at the given path!");
+            }
             return buffer;
         }
         catch(const std::bad_alloc& e){
@@ -23,4 +32,13 @@ namespace mygbc{
         }
     }
 
+    /// @brief Maps the file read only without copying it.
+    /// @details Bytes are paged in on first touch and shared with the page cache.
+    /// @param file_path The file path to the file.
+    /// @param hints Hints passed to the kernel for the mapping
+    /// @return Mapping of the file or error status.
+    StatusOr<std::shared_ptr<const MappedFile>> BinaryReader::map_as_bytes(const std::string& file_path, const MappedFile::MappingHints hints) noexcept{
+        return MappedFile::map(file_path, hints);
+    }
+
 }//namespace_mygbc
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include <vector> //std::vector
 #include <string> //std::string
 #include <cstdint> //Fixed lenght variables
+#include <memory> //std::shared_ptr
+#include "mapped_file.h" //MappedFile
 #include "../status/status_or.h" //StatusOr
 
 namespace mygbc{
@@ -18,6 +20,13 @@ namespace mygbc{
             /// @param file_path The file path to the file.
             /// @return A vector of uint8_t representing the file contents in binary format or error status.
             static StatusOr<std::vector<uint8_t>> read_as_bytes(const std::string& file_path) noexcept;
+
+            /// @brief Maps the file read only without copying it.
+            /// @details Bytes are paged in on first touch and shared with the page cache.
+            /// @param file_path The file path to the file.
+            /// @param hints Hints passed to the kernel for the mapping
+            /// @return Mapping of the file or error status.
+            static StatusOr<std::shared_ptr<const MappedFile>> map_as_bytes(const std::string& file_path, const MappedFile::MappingHints hints = MappedFile::MappingHints{}) noexcept;
     };
     
 }//namespace_mygbc
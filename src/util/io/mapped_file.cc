@@ -0,0 +1,81 @@
+#include "mapped_file.h" //MappedFile
+#include <fcntl.h> //open
+#include <unistd.h> //close
+#include <sys/mman.h> //mmap, munmap, madvise
+#include <sys/stat.h> //fstat
+
+namespace mygbc{
+
+    /// @brief Maps the file at the given path.
+    /// @param file_path The file path to the file.
+    /// @param hints Hints passed to the kernel for the mapping
+    /// @return Mapping of the file or error status.
+    StatusOr<std::shared_ptr<const MappedFile>> MappedFile::map(const std::string& file_path, const MappingHints hints) noexcept{
+        const int file_descriptor = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(file_descriptor < 0){
+            return Status::io_error("File at the given path was not accesible!");
+        }
+        struct stat file_stat{};
+        if(::fstat(file_descriptor, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)){
+            ::close(file_descriptor);
+            return Status::io_error("File at the given path is not a regular file!");
+        }
+        const std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+        void* mapping = nullptr;
+        //Zero length mappings are not allowed, empty files map to nothing
+        if(size > 0){
+            mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        }
+        //Mapping keeps the file referenced
+        ::close(file_descriptor);
+        if(mapping == MAP_FAILED){
+            return Status::io_error("Could not map the file at the given path!");
+        }
+        if(mapping != nullptr){
+            //Hints are advisory, failures are ignored
+            if(hints.will_need){
+                ::madvise(mapping, size, MADV_WILLNEED);
+            }
+#ifdef MADV_HUGEPAGE
+            if(hints.huge_pages){
+                ::madvise(mapping, size, MADV_HUGEPAGE);
+            }
+#endif
+        }
+        try{
+            return std::shared_ptr<const MappedFile>(new MappedFile(static_cast<const uint8_t*>(mapping), size));
+        }
+        catch(const std::bad_alloc& e){
+            if(mapping != nullptr){
+                ::munmap(mapping, size);
+            }
+            return Status::io_error(std::string("Issues with allocating memory! ") + e.what());
+        }
+    }
+
+    /// @brief Takes the ownership of the mapping, use map.
+    /// @param data Start of the mapping, nullptr for empty files
+    /// @param size Size of the mapping in bytes
+    MappedFile::MappedFile(const uint8_t* data, const std::size_t size) noexcept:data_(data), size_(size){
+    }
+
+    /// @brief Unmaps the file.
+    MappedFile::~MappedFile(){
+        if(data_ != nullptr){
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+        }
+    }
+
+    /// @brief Returns the mapped bytes.
+    /// @return Mapped bytes, empty for empty files.
+    std::span<const uint8_t> MappedFile::get_bytes() const noexcept{
+        return std::span<const uint8_t>(data_, size_);
+    }
+
+    /// @brief Returns the size of the mapped file.
+    /// @return Size of the file in bytes.
+    std::size_t MappedFile::get_size() const noexcept{
+        return size_;
+    }
+
+}//namespace_mygbc
@@ -0,0 +1,59 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <span> //std::span
+#include <string> //std::string
+#include <memory> //std::shared_ptr
+#include <cstdint> //Fixed lenght variables
+#include "../status/status_or.h" //StatusOr
+
+namespace mygbc{
+
+    /// @brief Read only, private memory mapping of a file.
+    /// @details Pages are loaded on first touch and shared with the page cache, so mapping is O(1) regardless of the file size.
+    ///          Mapping is released when the last owner lets go of it.
+    class MappedFile{
+        public:
+
+        //Hints passed to the kernel for the mapping
+        struct MappingHints{
+            bool will_need = true; //Start reading the file in ahead of the first touch
+            bool huge_pages = false; //Back the mapping with transparent huge pages where supported
+        };
+
+        /// @brief Maps the file at the given path.
+        /// @param file_path The file path to the file.
+        /// @param hints Hints passed to the kernel for the mapping
+        /// @return Mapping of the file or error status.
+        static StatusOr<std::shared_ptr<const MappedFile>> map(const std::string& file_path, const MappingHints hints) noexcept;
+
+        //Owns the mapping
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// @brief Unmaps the file.
+        ~MappedFile();
+
+        /// @brief Returns the mapped bytes.
+        /// @return Mapped bytes, empty for empty files.
+        std::span<const uint8_t> get_bytes() const noexcept;
+
+        /// @brief Returns the size of the mapped file.
+        /// @return Size of the file in bytes.
+        std::size_t get_size() const noexcept;
+
+        private:
+
+        /// @brief Takes the ownership of the mapping, use map.
+        /// @param data Start of the mapping, nullptr for empty files
+        /// @param size Size of the mapping in bytes
+        MappedFile(const uint8_t* data, const std::size_t size) noexcept;
+
+        //Mapped bytes
+        const uint8_t* data_;
+        const std::size_t size_;
+    };
+
+}//namespace_mygbc
+
+#endif
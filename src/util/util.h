@@ -3,6 +3,8 @@
 
 #include <cstdint> //Fixed lenght variables
 #include <string> //std::string
+#include <array> //std::array
+#include <bit> //std::endian, std::bit_cast
 #include "../util/status/status.h" //Status
 #include "../util/status/status_or.h" //StatusOr
 
@@ -17,6 +19,31 @@ namespace mygbc{
         /// @return A 16-bit unsigned integer in network byte order (big-endian).
         static uint16_t nthos16_t(const uint16_t val);
 
+        /// @brief Reads the word stored low byte first at the given bytes, the LR35902 byte order.
+        /// @details Single unaligned load, swapped only on big-endian hosts. Bytes don't need to be aligned.
+        /// @param bytes Pointer to the first (low) byte of the word.
+        /// @return Word value.
+        static inline uint16_t load_little_endian_word(const uint8_t* bytes) noexcept{
+            const uint16_t value = std::bit_cast<uint16_t>(std::array<uint8_t, 2>{bytes[0], bytes[1]});
+            if constexpr(std::endian::native == std::endian::big){
+                return byteswap_word(value);
+            }
+            return value;
+        }
+
+        /// @brief Stores the word low byte first at the given bytes, the LR35902 byte order.
+        /// @details Single unaligned store, swapped only on big-endian hosts. Bytes don't need to be aligned.
+        /// @param bytes Pointer to the first (low) byte of the word.
+        /// @param value Word value.
+        static inline void store_little_endian_word(uint8_t* bytes, uint16_t value) noexcept{
+            if constexpr(std::endian::native == std::endian::big){
+                value = byteswap_word(value);
+            }
+            const std::array<uint8_t, 2> stored = std::bit_cast<std::array<uint8_t, 2>>(value);
+            bytes[0] = stored[0];
+            bytes[1] = stored[1];
+        }
+
         /// @brief Converts the two bytes into their equilevant number in the ASCII - representation. Combines the two chars and returns it as uint8_t number.
         /// @details New licensee format described here https://www.zophar.net/fileuploads/2/10597teazh/gbrom.txt. Fullfills the described handling of the two bytes.
         /// @param first_byte first byte of the two bytes
@@ -33,6 +60,14 @@ namespace mygbc{
         /// @brief Returns current unix timestamp in string format.
         /// @return current unix timestamp in string format.
         static std::string get_unix_timestamp();
+
+    private:
+        /// @brief Swaps the bytes of the word, std::byteswap of C++23.
+        /// @param value Word value.
+        /// @return Word with its bytes swapped.
+        static constexpr uint16_t byteswap_word(const uint16_t value) noexcept{
+            return static_cast<uint16_t>((value << 8) | (value >> 8));
+        }
     };
 }//namespace_mygbc
 #endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "../../src/components/interrupt_controller.h" //InterruptController
+#include "../../src/components/memory_controller.h" //MemoryController
+#include "../../src/memory/high_page_memory.h" //HighPageMemory
+#include "../../src/memory/memory_arena.h" //MemoryArena
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+/// @brief Checks the pending interrupts kept by the controller.
+/// @details Pending is IE & IF of the five interrupts, requests and acknowledges update it. Highest priority is the lowest bit.
+TEST(InterruptControllerTest, pending_test){
+    std::shared_ptr<mygbc::MemoryArena> arena = std::make_shared<mygbc::MemoryArena>(std::vector<std::size_t>{0x100});
+    mygbc::InterruptController interrupt_controller(arena, 0);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x00);
+    interrupt_controller.request(mygbc::InterruptController::Interrupt::TIMER);
+    ASSERT_EQ(interrupt_controller.get_interrupt_flag(), 0x04);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x00);
+    interrupt_controller.set_interrupt_enable(0xFF);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x04);
+    interrupt_controller.request(mygbc::InterruptController::Interrupt::VBLANK);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x05);
+    ASSERT_EQ(mygbc::InterruptController::get_highest_priority(interrupt_controller.get_pending()), 0x01);
+    ASSERT_EQ(mygbc::InterruptController::get_vector(0x01), 0x0040);
+    ASSERT_EQ(mygbc::InterruptController::get_vector(0x04), 0x0050);
+    ASSERT_EQ(mygbc::InterruptController::get_vector(0x10), 0x0060);
+    interrupt_controller.acknowledge(0x01);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x04);
+    //Upper bits of IF are not interrupts
+    interrupt_controller.set_interrupt_flag(0xE0);
+    ASSERT_EQ(interrupt_controller.get_pending(), 0x00);
+    //Registers live in the arena
+    ASSERT_EQ(arena->get_byte(mygbc::InterruptController::interrupt_flag_offset), 0xE0);
+    ASSERT_EQ(arena->get_byte(mygbc::InterruptController::interrupt_enable_offset), 0xFF);
+    ASSERT_EQ(arena->get_dirty_pages().is_dirty(0), true);
+}
+
+/// @brief Checks that bus writes to IE and IF trough the high page refresh the pending interrupts.
+/// @details Direct writes are refused by the high page, clones follow their own controller.
+TEST(InterruptControllerTest, high_page_memory_test){
+    std::shared_ptr<mygbc::MemoryArena> arena = std::make_shared<mygbc::MemoryArena>(std::vector<std::size_t>{0x100});
+    std::shared_ptr<mygbc::InterruptController> interrupt_controller = std::make_shared<mygbc::InterruptController>(arena, 0);
+    std::shared_ptr<mygbc::HighPageMemory> high_page = std::make_shared<mygbc::HighPageMemory>(interrupt_controller);
+    ASSERT_EQ(high_page->get_direct_write_pointer(0x00), nullptr);
+    ASSERT_EQ(high_page->get_write_view().empty(), true);
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0xFF00, high_page).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xFFFF, 0x03).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xFF0F, 0x02).ok(), true);
+    ASSERT_EQ(interrupt_controller->get_pending(), 0x02);
+    ASSERT_EQ(memory_controller.set_word(0xFF0E, 0x0100).ok(), true);
+    ASSERT_EQ(interrupt_controller->get_pending(), 0x01);
+    //Other bytes of the page leave the controller alone
+    ASSERT_EQ(memory_controller.set_byte(0xFF80, 0xFF).ok(), true);
+    ASSERT_EQ(interrupt_controller->get_pending(), 0x01);
+    interrupt_controller->acknowledge(0x01);
+    ASSERT_EQ(memory_controller.get_byte(0xFF0F).value(), 0x00);
+    //Clone writes reach the controller clone only
+    mygbc::MemoryCloneMap clones;
+    mygbc::StatusOr<std::shared_ptr<mygbc::SystemMemoryInterface>> high_page_clone = high_page->clone(clones);
+    ASSERT_EQ(high_page_clone.ok(), true);
+    ASSERT_EQ(high_page_clone.value()->set_byte(0x0F, 0x02).ok(), true);
+    ASSERT_EQ(interrupt_controller->get_pending(), 0x00);
+    std::shared_ptr<mygbc::InterruptController> interrupt_controller_clone =
+        std::static_pointer_cast<mygbc::InterruptController>(clones.at(interrupt_controller.get()));
+    ASSERT_EQ(interrupt_controller_clone->get_pending(), 0x02);
+}
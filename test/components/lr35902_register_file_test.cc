@@ -0,0 +1,216 @@
+#include "../../src/components/lr35902_register_file.h" //LR35902RegisterFile
+#include <gtest/gtest.h> //GTest
+#include <tuple> //std::tuple
+
+/// @brief Checks that the 8-bit views map to the halves of the pair.
+/// @details High half is the first named register, writes to one half leave the other alone.
+TEST(LR35902RegisterFileTest, register_pair_view_test){
+    mygbc::LR35902RegisterFile register_file;
+    register_file.b_c.set_word(0x1234);
+    ASSERT_EQ(register_file.b_c.get_high(), 0x12);
+    ASSERT_EQ(register_file.b_c.get_low(), 0x34);
+    register_file.b_c.set_high(0xAB);
+    ASSERT_EQ(register_file.b_c.get_word(), 0xAB34);
+    register_file.b_c.set_low(0xCD);
+    ASSERT_EQ(register_file.b_c.get_word(), 0xABCD);
+}
+
+/// @brief Checks that increment and decrement wrap around.
+/// @details 16-bit registers wrap like the hardware does.
+TEST(LR35902RegisterFileTest, register_pair_wrap_test){
+    mygbc::LR35902RegisterFile register_file;
+    register_file.sp.set_word(0xFFFF);
+    register_file.sp.increment(2);
+    ASSERT_EQ(register_file.sp.get_word(), 0x0001);
+    register_file.sp.decrement(2);
+    ASSERT_EQ(register_file.sp.get_word(), 0xFFFF);
+}
+
+class LR35902RegisterFileFlagTest : public ::testing::TestWithParam<std::tuple<int, uint8_t>> {};
+
+/// @brief Checks that each flag maps to its bit in the F register.
+/// @details Setting the flag sets only its bit, clearing clears it.
+TEST_P(LR35902RegisterFileFlagTest, flag_bit_test){
+    std::tuple<int, uint8_t> test_values = GetParam();
+    mygbc::LR35902RegisterFile register_file;
+    register_file.a_f.set_word(0xFF00);
+    switch(std::get<0>(test_values)){
+        case 0: register_file.set_zero_flag(true); ASSERT_EQ(register_file.get_zero_flag(), true); break;
+        case 1: register_file.set_sub_flag(true); ASSERT_EQ(register_file.get_sub_flag(), true); break;
+        case 2: register_file.set_half_carry_flag(true); ASSERT_EQ(register_file.get_half_carry_flag(), true); break;
+        default: register_file.set_carry_flag(true); ASSERT_EQ(register_file.get_carry_flag(), true); break;
+    }
+    ASSERT_EQ(register_file.a_f.get_word(), 0xFF00 | std::get<1>(test_values));
+    switch(std::get<0>(test_values)){
+        case 0: register_file.set_zero_flag(false); break;
+        case 1: register_file.set_sub_flag(false); break;
+        case 2: register_file.set_half_carry_flag(false); break;
+        default: register_file.set_carry_flag(false); break;
+    }
+    ASSERT_EQ(register_file.a_f.get_word(), 0xFF00);
+}
+
+/// @brief Initantiazation of flag_bit_test.
+/// @details  Initantiazation of flag_bit_test.
+INSTANTIATE_TEST_SUITE_P(
+    flag_bit_test_cases,
+    LR35902RegisterFileFlagTest,
+    ::testing::Values(
+        std::make_tuple(0, 0x80), //Z
+        std::make_tuple(1, 0x40), //N
+        std::make_tuple(2, 0x20), //H
+        std::make_tuple(3, 0x10) //C
+    )
+);
+
+/// @brief Checks that register ids resolve to the pair holding them.
+/// @details Unknown ids return a status.
+TEST(LR35902RegisterFileTest, register_by_id_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_REGISTER_ID_ERROR;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::StatusOr<mygbc::RegisterPair*> register_fetch = register_file.get_register_by_id(mygbc::LR35902RegisterId::L);
+    ASSERT_EQ(register_fetch.ok(), true);
+    ASSERT_EQ(register_fetch.value(), &register_file.h_l);
+    register_fetch = register_file.get_register_by_id(mygbc::LR35902RegisterId::NONE);
+    ASSERT_EQ(register_fetch.ok(), false);
+    ASSERT_EQ(register_fetch.status().code(), expected_status);
+}
+
+class LR35902RegisterFileLazyFlagTest : public ::testing::TestWithParam<std::tuple<mygbc::LR35902LazyFlags::Operation, uint16_t, uint16_t, uint8_t, uint8_t, uint8_t>> {};
+
+/// @brief Checks that register ids access the right half of the pair.
+/// @details 8-bit ids leave the other half alone, F goes trough the lazy flags.
+TEST(LR35902RegisterFileTest, register_value_by_id_test){
+    mygbc::LR35902RegisterFile register_file;
+    register_file.set_register_value(mygbc::LR35902RegisterId::DE, 0x1234);
+    register_file.set_register_value(mygbc::LR35902RegisterId::E, 0xCD);
+    ASSERT_EQ(register_file.d_e.get_word(), 0x12CD);
+    ASSERT_EQ(register_file.get_register_value(mygbc::LR35902RegisterId::D), 0x12);
+    register_file.set_register_value(mygbc::LR35902RegisterId::A, 0x1FF);
+    ASSERT_EQ(register_file.a_f.get_word(), 0xFF00);
+    register_file.set_register_value(mygbc::LR35902RegisterId::SP, 0xFFFE);
+    ASSERT_EQ(register_file.sp.get_word(), 0xFFFE);
+    ASSERT_EQ(register_file.get_register_value(mygbc::LR35902RegisterId::PC), 0x0000);
+    register_file.set_lazy_flags_enabled(true);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::AND_8BIT, 0x00, 0x00);
+    ASSERT_EQ(register_file.get_register_value(mygbc::LR35902RegisterId::AF), 0xFFA0);
+    register_file.set_register_value(mygbc::LR35902RegisterId::AF, 0x0110);
+    ASSERT_EQ(register_file.get_register_value(mygbc::LR35902RegisterId::F), 0x10);
+}
+
+/// @brief Checks the flags computed from the recorded ALU operations.
+/// @details Lazy and eager mode agree, lazy mode leaves F untouched until materialized.
+TEST_P(LR35902RegisterFileLazyFlagTest, lazy_flag_test){
+    auto [operation, operand_a, operand_b, carry_in, previous_flags, expected_flags] = GetParam();
+    mygbc::LR35902RegisterFile eager_register_file;
+    eager_register_file.set_flags(previous_flags);
+    eager_register_file.record_flags(operation, operand_a, operand_b, carry_in);
+    ASSERT_EQ(eager_register_file.a_f.get_low(), expected_flags);
+    mygbc::LR35902RegisterFile lazy_register_file;
+    lazy_register_file.set_lazy_flags_enabled(true);
+    lazy_register_file.set_flags(previous_flags);
+    lazy_register_file.record_flags(operation, operand_a, operand_b, carry_in);
+    ASSERT_EQ(lazy_register_file.a_f.get_low(), previous_flags);
+    ASSERT_EQ(lazy_register_file.get_flags(), expected_flags);
+    ASSERT_EQ(lazy_register_file.get_zero_flag(), (expected_flags & 0x80) != 0);
+    ASSERT_EQ(lazy_register_file.get_carry_flag(), (expected_flags & 0x10) != 0);
+    lazy_register_file.materialize_flags();
+    ASSERT_EQ(lazy_register_file.a_f.get_low(), expected_flags);
+}
+
+/// @brief Initantiazation of lazy_flag_test.
+/// @details  Initantiazation of lazy_flag_test.
+INSTANTIATE_TEST_SUITE_P(
+    lazy_flag_test_cases,
+    LR35902RegisterFileLazyFlagTest,
+    ::testing::Values(
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::ADD_8BIT, 0x3A, 0xC6, 0, 0x00, 0xB0), //Z H C
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::ADC_8BIT, 0xE1, 0x1E, 1, 0x00, 0xB0), //Z H C
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::SUB_8BIT, 0x3E, 0x40, 0, 0x00, 0x50), //N C
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::SBC_8BIT, 0x3B, 0x2A, 1, 0x00, 0x40), //N
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::AND_8BIT, 0x00, 0x00, 0, 0x00, 0xA0), //Z H
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::OR_8BIT, 0x5A, 0x00, 0, 0xF0, 0x00), //None
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::INC_8BIT, 0xFF, 0x00, 0, 0x10, 0xB0), //Z H, C kept
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::DEC_8BIT, 0x01, 0x00, 0, 0x00, 0xC0), //Z N
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::ADD_16BIT, 0x8A23, 0x8A23, 0, 0x80, 0xB0), //Z kept, H C
+        std::make_tuple(mygbc::LR35902LazyFlags::Operation::ADD_SP_8BIT, 0xFFF8, 0x0002, 0, 0xF0, 0x00) //Z N cleared
+    )
+);
+
+/// @brief Checks that a pending operation reads the previous flags it keeps.
+/// @details INC after SUB keeps the carry of the SUB, direct writes discard the pending operation.
+TEST(LR35902RegisterFileTest, lazy_flag_chain_test){
+    mygbc::LR35902RegisterFile register_file;
+    register_file.set_lazy_flags_enabled(true);
+    register_file.a_f.set_word(0x1200);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::SUB_8BIT, 0x01, 0x02);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::INC_8BIT, 0x0F, 0x00);
+    ASSERT_EQ(register_file.get_af(), 0x1230);
+    register_file.set_zero_flag(true);
+    ASSERT_EQ(register_file.a_f.get_word(), 0x12B0);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::OR_8BIT, 0x00, 0x00);
+    register_file.set_flags(0x40);
+    ASSERT_EQ(register_file.get_flags(), 0x40);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::AND_8BIT, 0x01, 0x00);
+    register_file.set_lazy_flags_enabled(false);
+    ASSERT_EQ(register_file.a_f.get_low(), 0x20);
+}
+
+/// @brief Checks that kept flags are resolved when read, not when recorded.
+/// @details Recording INC, DEC and ADD HL leaves F alone. Chains keep the flags of the operation that produced them.
+TEST(LR35902RegisterFileTest, lazy_kept_flag_test){
+    mygbc::LR35902RegisterFile register_file;
+    register_file.set_lazy_flags_enabled(true);
+    register_file.set_flags(0x00);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::SUB_8BIT, 0x01, 0x02); //N H C
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::INC_8BIT, 0x0F, 0x00); //H, C of SUB
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::DEC_8BIT, 0x01, 0x00); //Z N, C of SUB
+    ASSERT_EQ(register_file.a_f.get_low(), 0x00);
+    ASSERT_EQ(register_file.lazy_flags.kept_source.operation, mygbc::LR35902LazyFlags::Operation::SUB_8BIT);
+    ASSERT_EQ(register_file.get_flags(), 0xD0);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::ADD_16BIT, 0x0001, 0x0001); //Z of DEC
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::ADD_16BIT, 0xFFFF, 0x0001); //Z of DEC, H C
+    ASSERT_EQ(register_file.lazy_flags.kept_source.operation, mygbc::LR35902LazyFlags::Operation::DEC_8BIT);
+    ASSERT_EQ(register_file.get_flags(), 0xB0);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::INC_8BIT, 0x00, 0x00); //C of ADD HL
+    ASSERT_EQ(register_file.get_flags(), 0x10);
+    ASSERT_EQ(register_file.a_f.get_low(), 0x00);
+    //Pointer to the AF pair exposes F, the pending flags are written first
+    mygbc::StatusOr<mygbc::RegisterPair*> af_pair = register_file.get_register_by_id(mygbc::LR35902RegisterId::AF);
+    ASSERT_EQ(af_pair.ok(), true);
+    ASSERT_EQ(register_file.lazy_flags.is_pending(), false);
+    ASSERT_EQ(af_pair.value()->get_low(), 0x10);
+    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::OR_8BIT, 0x00, 0x00);
+    ASSERT_EQ(register_file.get_register_by_id(mygbc::LR35902RegisterId::B).ok(), true);
+    ASSERT_EQ(register_file.lazy_flags.is_pending(), true);
+    ASSERT_EQ(register_file.get_register_by_id(mygbc::LR35902RegisterId::F).value()->get_low(), 0x80);
+}
+
+/// @brief Checks the 8-bit arithmetic flags against a reference for every operand and carry.
+/// @details Reference computes the half carry and carry from the nibble and byte sums.
+TEST(LR35902RegisterFileTest, arithmetic_flag_exhaustive_test){
+    mygbc::LR35902RegisterFile register_file;
+    for(unsigned operand_a = 0; operand_a < 0x100; ++operand_a){
+        for(unsigned operand_b = 0; operand_b < 0x100; ++operand_b){
+            for(unsigned carry_in = 0; carry_in < 2; ++carry_in){
+                const unsigned sum = operand_a + operand_b + carry_in;
+                const unsigned sum_flags = ((sum & 0xFF) == 0 ? 0x80 : 0x00) |
+                    (((operand_a & 0x0F) + (operand_b & 0x0F) + carry_in) > 0x0F ? 0x20 : 0x00) | (sum > 0xFF ? 0x10 : 0x00);
+                const int difference = static_cast<int>(operand_a) - static_cast<int>(operand_b) - static_cast<int>(carry_in);
+                const unsigned difference_flags = ((difference & 0xFF) == 0 ? 0x80 : 0x00) | 0x40 |
+                    ((static_cast<int>(operand_a & 0x0F) - static_cast<int>(operand_b & 0x0F) - static_cast<int>(carry_in)) < 0 ? 0x20 : 0x00) |
+                    (difference < 0 ? 0x10 : 0x00);
+                register_file.record_flags(mygbc::LR35902LazyFlags::Operation::ADC_8BIT, operand_a, operand_b, carry_in);
+                ASSERT_EQ(register_file.get_flags(), sum_flags);
+                register_file.record_flags(mygbc::LR35902LazyFlags::Operation::SBC_8BIT, operand_a, operand_b, carry_in);
+                ASSERT_EQ(register_file.get_flags(), difference_flags);
+                if(carry_in == 0){
+                    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::ADD_8BIT, operand_a, operand_b);
+                    ASSERT_EQ(register_file.get_flags(), sum_flags);
+                    register_file.record_flags(mygbc::LR35902LazyFlags::Operation::SUB_8BIT, operand_a, operand_b);
+                    ASSERT_EQ(register_file.get_flags(), difference_flags);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,274 @@
+#include "../../src/components/lr35902.h" //LR35902
+#include "../../src/components/memory_controller.h" //MemoryController
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <atomic> //std::atomic
+#include <cstdlib> //std::malloc, std::free
+#include <new> //std::bad_alloc
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+//Counts every global allocation made by the test binary
+static std::atomic<std::size_t> allocation_count{0};
+
+void* operator new(std::size_t size){
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if(void* allocation = std::malloc(size == 0 ? 1 : size)){
+        return allocation;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* allocation) noexcept{
+    std::free(allocation);
+}
+
+void operator delete(void* allocation, std::size_t size) noexcept{
+    std::free(allocation);
+}
+
+/// @brief Checks that the fetch-decode-execute cycle follows the pc.
+/// @details JP a16 jumps into a JR e8 loop, pc is advanced past each instruction before execution.
+TEST(LR35902FetchDecodeExecuteTest, pc_follows_program_test){
+    const uint8_t expected_jp_ticks = 16;
+    const uint8_t expected_jr_ticks = 12;
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    //JP 0x0004, NOP, JR -2
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0xC3, 0x04, 0x00, 0x00, 0x18, 0xFE}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<uint8_t> cycle = cpu.fetch_decode_execute(memory_controller);
+    ASSERT_EQ(cycle.ok(), true);
+    ASSERT_EQ(cycle.value(), expected_jp_ticks);
+    for(int step = 0; step < 4; ++step){
+        cycle = cpu.fetch_decode_execute(memory_controller);
+        ASSERT_EQ(cycle.ok(), true);
+        ASSERT_EQ(cycle.value(), expected_jr_ticks);
+    }
+}
+
+/// @brief Checks that the fetch-decode-execute cycle does not allocate.
+/// @details Global operator new is counted over a hot JR e8 loop after a warm up step.
+TEST(LR35902FetchDecodeExecuteTest, no_allocation_test){
+    const std::size_t expected_allocations = 0;
+    const int steps = 10000;
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    //JR -2
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x18, 0xFE}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    ASSERT_EQ(cpu.fetch_decode_execute(memory_controller).ok(), true);
+    bool all_ok = true;
+    const std::size_t allocations_before = allocation_count.load();
+    for(int step = 0; step < steps; ++step){
+        all_ok &= cpu.fetch_decode_execute(memory_controller).ok();
+    }
+    const std::size_t allocations_after = allocation_count.load();
+    ASSERT_EQ(all_ok, true);
+    ASSERT_EQ(allocations_after - allocations_before, expected_allocations);
+}
+
+/// @brief Checks that writes trough the memory controller invalidate cached instructions.
+/// @details JR e8 is overwritten with a PUSH BC, which has no executor and fails once re-decoded.
+TEST(LR35902FetchDecodeExecuteTest, write_invalidates_predecode_test){
+    const uint8_t expected_jr_ticks = 12;
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_INDEX_ERROR;
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    //JR -2, writable
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x18, 0xFE}, false
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<uint8_t> cycle = cpu.fetch_decode_execute(memory_controller);
+    ASSERT_EQ(cycle.ok(), true);
+    ASSERT_EQ(cycle.value(), expected_jr_ticks);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0xC5).ok(), true); //PUSH BC
+    cycle = cpu.fetch_decode_execute(memory_controller);
+    ASSERT_EQ(cycle.ok(), false);
+    ASSERT_EQ(cycle.status().code(), expected_status);
+}
+
+/// @brief Checks that remapping the memory invalidates cached instructions.
+/// @details Program is swapped by unmounting and mounting, new mapping generation misses the cache.
+TEST(LR35902FetchDecodeExecuteTest, remap_invalidates_predecode_test){
+    const uint8_t expected_jr_ticks = 12;
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_INDEX_ERROR;
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    //JR -2
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x18, 0xFE}, true
+    );
+    //PUSH BC, PUSH BC
+    std::shared_ptr<mygbc::AddressableMemory> other_program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0xC5, 0xC5}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<uint8_t> cycle = cpu.fetch_decode_execute(memory_controller);
+    ASSERT_EQ(cycle.ok(), true);
+    ASSERT_EQ(cycle.value(), expected_jr_ticks);
+    ASSERT_EQ(memory_controller.unmount_range(0x0000).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, other_program).ok(), true);
+    cycle = cpu.fetch_decode_execute(memory_controller);
+    ASSERT_EQ(cycle.ok(), false);
+    ASSERT_EQ(cycle.status().code(), expected_status);
+}
+
+//NOP, NOP, JR +1, NOP, JP 0x000A, JR -10, NOP, CALL 0x0012, JR -8, NOP, NOP, NOP, RET
+static const std::vector<uint8_t> jump_program{
+    0x00, 0x00, 0x18, 0x01, 0x00, 0xC3, 0x0A, 0x00, 0x18, 0xF6,
+    0x00, 0xCD, 0x12, 0x00, 0x18, 0xF8, 0x00, 0x00, 0x00, 0xC9
+};
+
+//LD A, 0x0F, LD B, 0x03, LD C, 0xF0, then looping: ADD A, B, ADC A, C, SUB C, SBC A, B, AND C, OR B, XOR B, CP C, INC B, DEC C,
+//LD D, A, LD E, D, LD H, E, LD L, H, ADD A, 0x11, ADC A, 0x22, SUB 0x05, SBC A, 0x01, INC A, DEC A, INC L, DEC H, JR NZ, -28, JR -30
+static const std::vector<uint8_t> alu_program{
+    0x3E, 0x0F, 0x06, 0x03, 0x0E, 0xF0, 0x80, 0x89, 0x91, 0x98, 0xA1, 0xB0, 0xA8, 0xB9, 0x04, 0x0D,
+    0x57, 0x5A, 0x63, 0x6C, 0xC6, 0x11, 0xCE, 0x22, 0xD6, 0x05, 0xDE, 0x01, 0x3C, 0x3D, 0x2C, 0x25,
+    0x20, 0xE4, 0x18, 0xE2
+};
+
+/// @brief Runs the program on the interpreter and on the given backend, comparing registers at every dispatch boundary.
+/// @details Interpreter is stepped until it has spent the ticks of each dispatch of the backend.
+/// @param execution_backend Backend compared against the interpreter
+/// @param program Program mounted at 0x0000
+void expect_matches_interpreter(const mygbc::LR35902::ExecutionBackend execution_backend, const std::vector<uint8_t>& program){
+    const int dispatches = 200;
+    const uint16_t stack_start = 0xC000;
+    mygbc::LR35902 interpreter_cpu;
+    mygbc::LR35902 backend_cpu;
+    backend_cpu.set_execution_backend(execution_backend);
+    mygbc::MemoryController interpreter_memory;
+    mygbc::MemoryController backend_memory;
+    ASSERT_EQ(interpreter_memory.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+    ASSERT_EQ(interpreter_memory.mount_memory(stack_start, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x100, 0x00), false)).ok(), true);
+    ASSERT_EQ(backend_memory.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+    ASSERT_EQ(backend_memory.mount_memory(stack_start, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x100, 0x00), false)).ok(), true);
+    interpreter_cpu.get_register_file().sp.set_word(stack_start);
+    backend_cpu.get_register_file().sp.set_word(stack_start);
+    uint32_t interpreter_ticks = 0;
+    uint32_t backend_ticks = 0;
+    for(int dispatch = 0; dispatch < dispatches; ++dispatch){
+        mygbc::StatusOr<uint16_t> backend_execution = backend_cpu.step(backend_memory);
+        ASSERT_EQ(backend_execution.ok(), true);
+        backend_ticks += backend_execution.value();
+        while(interpreter_ticks < backend_ticks){
+            mygbc::StatusOr<uint16_t> interpreter_execution = interpreter_cpu.step(interpreter_memory);
+            ASSERT_EQ(interpreter_execution.ok(), true);
+            interpreter_ticks += interpreter_execution.value();
+        }
+        ASSERT_EQ(interpreter_ticks, backend_ticks);
+        const mygbc::LR35902RegisterFile interpreter_registers = interpreter_cpu.get_register_snapshot();
+        const mygbc::LR35902RegisterFile backend_registers = backend_cpu.get_register_snapshot();
+        ASSERT_EQ(interpreter_registers.pc.get_word(), backend_registers.pc.get_word());
+        ASSERT_EQ(interpreter_registers.sp.get_word(), backend_registers.sp.get_word());
+        ASSERT_EQ(interpreter_registers.a_f.get_word(), backend_registers.a_f.get_word());
+        ASSERT_EQ(interpreter_registers.b_c.get_word(), backend_registers.b_c.get_word());
+        ASSERT_EQ(interpreter_registers.d_e.get_word(), backend_registers.d_e.get_word());
+        ASSERT_EQ(interpreter_registers.h_l.get_word(), backend_registers.h_l.get_word());
+    }
+}
+
+/// @brief Checks that the basic block backend matches the interpreter.
+/// @details Registers must match at every block boundary.
+TEST(LR35902FetchDecodeExecuteTest, basic_block_differential_test){
+    expect_matches_interpreter(mygbc::LR35902::ExecutionBackend::BASIC_BLOCK, jump_program);
+    expect_matches_interpreter(mygbc::LR35902::ExecutionBackend::BASIC_BLOCK, alu_program);
+}
+
+/// @brief Checks that the jit backend matches the interpreter.
+/// @details Hot blocks get compiled during the run, the ALU loop runs in host registers. Registers must match at every block boundary.
+TEST(LR35902FetchDecodeExecuteTest, jit_differential_test){
+    expect_matches_interpreter(mygbc::LR35902::ExecutionBackend::JIT, jump_program);
+    expect_matches_interpreter(mygbc::LR35902::ExecutionBackend::JIT, alu_program);
+}
+
+/// @brief Checks that a basic block stops before the instruction that would cross the budget.
+/// @details Two NOPs fit 10 ticks, the third one runs in the next dispatch. First instruction runs even past the budget.
+TEST(LR35902FetchDecodeExecuteTest, basic_block_budget_test){
+    const uint16_t expected_ticks = 8;
+    const uint16_t expected_pc = 0x0002;
+    const uint16_t expected_first_ticks = 4;
+    mygbc::LR35902 cpu;
+    cpu.set_execution_backend(mygbc::LR35902::ExecutionBackend::BASIC_BLOCK);
+    mygbc::MemoryController memory_controller;
+    //NOP, NOP, NOP, NOP, JR -6
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x00, 0x00, 0x00, 0x18, 0xFA}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<uint16_t> dispatch = cpu.step(memory_controller, 10);
+    ASSERT_EQ(dispatch.ok(), true);
+    ASSERT_EQ(dispatch.value(), expected_ticks);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), expected_pc);
+    dispatch = cpu.step(memory_controller, 1);
+    ASSERT_EQ(dispatch.ok(), true);
+    ASSERT_EQ(dispatch.value(), expected_first_ticks);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), expected_pc + 1);
+}
+
+/// @brief Checks that HALT stops the cpu until it is woken.
+/// @details Halted cpu idles a machine cycle per dispatch without moving the pc, every backend.
+TEST(LR35902FetchDecodeExecuteTest, halt_test){
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    //HALT, NOP
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>{0x76, 0x00}, true)).ok(), true);
+    ASSERT_EQ(cpu.fetch_decode_execute(memory_controller).value(), 4);
+    ASSERT_EQ(cpu.get_register_file().halted, true);
+    ASSERT_EQ(cpu.fetch_decode_execute(memory_controller).value(), mygbc::LR35902::machine_cycle_ticks);
+    cpu.set_execution_backend(mygbc::LR35902::ExecutionBackend::BASIC_BLOCK);
+    ASSERT_EQ(cpu.step(memory_controller).value(), mygbc::LR35902::machine_cycle_ticks);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0x0001);
+    cpu.get_register_file().halted = false;
+    ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0x0002);
+}
+
+/// @brief Checks the EI delay and DI.
+/// @details IME is set only after the instruction following EI, DI right after EI cancels it. Every backend.
+TEST(LR35902FetchDecodeExecuteTest, ei_delay_test){
+    for(const mygbc::LR35902::ExecutionBackend execution_backend : {
+        mygbc::LR35902::ExecutionBackend::INTERPRETER, mygbc::LR35902::ExecutionBackend::BASIC_BLOCK, mygbc::LR35902::ExecutionBackend::JIT
+    }){
+        mygbc::LR35902 cpu;
+        mygbc::MemoryController memory_controller;
+        cpu.set_execution_backend(execution_backend);
+        //EI, NOP, EI, DI, NOP
+        ASSERT_EQ(memory_controller.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>{0xFB, 0x00, 0xFB, 0xF3, 0x00}, true)).ok(), true);
+        ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+        ASSERT_EQ(cpu.get_register_file().ime, false);
+        ASSERT_EQ(cpu.get_register_file().ime_scheduled, true);
+        ASSERT_EQ(cpu.fetch_decode_execute(memory_controller).ok(), true);
+        ASSERT_EQ(cpu.get_register_file().ime, true);
+        ASSERT_EQ(cpu.get_register_file().ime_scheduled, false);
+        cpu.get_register_file().ime = false;
+        ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+        ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+        ASSERT_EQ(cpu.get_register_file().ime, false);
+        ASSERT_EQ(cpu.get_register_file().ime_scheduled, false);
+    }
+}
+
+/// @brief Checks the instruction read after the HALT bug.
+/// @details Opcode byte is read twice, JP 0x0010 becomes JP 0x10C3. Blocks fall back to the interpreter for it.
+TEST(LR35902FetchDecodeExecuteTest, halt_bug_test){
+    mygbc::LR35902 cpu;
+    mygbc::MemoryController memory_controller;
+    cpu.set_execution_backend(mygbc::LR35902::ExecutionBackend::BASIC_BLOCK);
+    //JP 0x0010
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>{0xC3, 0x10, 0x00}, true)).ok(), true);
+    cpu.get_register_file().halt_bug = true;
+    ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+    ASSERT_EQ(cpu.get_register_file().halt_bug, false);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0x10C3);
+    //Cached decode of the same address is unaffected
+    cpu.get_register_file().pc.set_word(0x0000);
+    ASSERT_EQ(cpu.step(memory_controller).ok(), true);
+    ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0x0010);
+}
@@ -0,0 +1,215 @@
+#include "../../src/components/memory_controller.h" //MemoryController
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+namespace{
+    /// @brief Memory without direct pointers, counts the accesses going trough it.
+    class CountingMemory : public mygbc::AddressableMemory{
+        public:
+        CountingMemory(const std::vector<uint8_t>& memory):AddressableMemory(memory, false), reads(0){}
+
+        mygbc::StatusOr<uint8_t> get_byte(const uint16_t addr) noexcept override{
+            ++reads;
+            return AddressableMemory::get_byte(addr);
+        }
+
+        const uint8_t* get_direct_read_pointer(const uint16_t addr) noexcept override{ return nullptr; }
+
+        uint8_t* get_direct_write_pointer(const uint16_t addr) noexcept override{ return nullptr; }
+
+        int reads;
+    };
+}
+
+/// @brief Checks reads and writes trough the page table.
+/// @details Words are stored high byte first, also across page boundaries.
+TEST(MemoryControllerTest, page_table_access_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x2000, 0x00), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xC010, 0xAB).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC010).value(), 0xAB);
+    ASSERT_EQ(ram->get_byte(0x0010).value(), 0xAB);
+    ASSERT_EQ(memory_controller.set_word(0xC0FF, 0x1234).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC0FF).value(), 0x34);
+    ASSERT_EQ(memory_controller.get_byte(0xC100).value(), 0x12);
+    ASSERT_EQ(memory_controller.get_word(0xC0FF).value(), 0x1234);
+    ASSERT_EQ(memory_controller.set_word(0xDFFE, 0xBEEF).ok(), true);
+    ASSERT_EQ(memory_controller.get_word(0xDFFE).value(), 0xBEEF);
+}
+
+/// @brief Checks that read only memory keeps rejecting writes.
+/// @details Read only pages have no direct write pointer, writes fall back to the memory.
+TEST(MemoryControllerTest, page_table_read_only_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::PROTECTED_MEMORY_SET_ERROR;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> rom = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x4000, 0x5A), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, rom).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x3FFF).value(), 0x5A);
+    mygbc::Status write_status = memory_controller.set_byte(0x0100, 0x00);
+    ASSERT_EQ(write_status.ok(), false);
+    ASSERT_EQ(write_status.code(), expected_status);
+    ASSERT_EQ(memory_controller.get_byte(0x0100).value(), 0x5A);
+}
+
+/// @brief Checks the fall back paths of the page table.
+/// @details Memory without direct pointers and partially covered pages go trough the memory, unmounted pages fail.
+TEST(MemoryControllerTest, page_table_fallback_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_MEMORY_RANGE_ERROR;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<CountingMemory> io = std::make_shared<CountingMemory>(std::vector<uint8_t>(0x80, 0x11));
+    std::shared_ptr<mygbc::AddressableMemory> partial = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x10, 0x22), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xFF00, io).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x8010, partial).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xFF10).value(), 0x11);
+    ASSERT_EQ(io->reads, 1);
+    ASSERT_EQ(memory_controller.get_byte(0x8015).value(), 0x22);
+    ASSERT_EQ(memory_controller.unmount_range(0x8010).ok(), true);
+    mygbc::StatusOr<uint8_t> read = memory_controller.get_byte(0x8015);
+    ASSERT_EQ(read.ok(), false);
+    ASSERT_EQ(read.status().code(), expected_status);
+}
+
+/// @brief Checks that unmount and free clear the direct pointers.
+/// @details Reads of the cleared pages fail instead of reaching the old memory.
+TEST(MemoryControllerTest, page_table_unmount_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x1000, 0x33), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xA000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA800).value(), 0x33);
+    ASSERT_EQ(memory_controller.unmount_range(0xA000).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA800).ok(), false);
+    ASSERT_EQ(memory_controller.set_byte(0xA800, 0x00).ok(), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xA000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA800).value(), 0x33);
+    memory_controller.free();
+    ASSERT_EQ(memory_controller.get_byte(0xA800).ok(), false);
+}
+
+/// @brief Checks that freeing or resizing a mounted memory rebuilds its pages.
+/// @details Moved direct pointers are never used, accesses past the new end fail trough the memory.
+TEST(MemoryControllerTest, page_table_memory_moved_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x2000, 0x33), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC000).value(), 0x33);
+    ram->free();
+    ASSERT_EQ(memory_controller.get_byte(0xC000).ok(), false);
+    ASSERT_EQ(memory_controller.get_word(0xD000).ok(), false);
+    ASSERT_EQ(memory_controller.set_byte(0xC100, 0x00).ok(), false);
+    std::vector<uint8_t> block(0x10);
+    ASSERT_EQ(memory_controller.read_block(0xC000, block).ok(), false);
+    ASSERT_EQ(ram->set_memory(std::vector<uint8_t>(0x1000, 0x44)).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC800).value(), 0x44);
+    ASSERT_EQ(memory_controller.set_byte(0xCFFF, 0x55).ok(), true);
+    ASSERT_EQ(ram->get_byte(0x0FFF).value(), 0x55);
+    ASSERT_EQ(memory_controller.get_byte(0xD800).ok(), false);
+}
+
+namespace{
+    /// @brief Records the writes reported by the memory controller.
+    class RecordingObserver : public mygbc::MemoryWriteObserver{
+        public:
+        void on_memory_write(const uint16_t addr, const uint16_t size_in_bytes) noexcept override{
+            writes.emplace_back(addr, size_in_bytes);
+        }
+
+        std::vector<std::pair<uint16_t, uint16_t>> writes;
+    };
+}
+
+/// @brief Checks block reads and writes spanning adjacent mounts.
+/// @details Direct pages are copied whole, memory without direct pointers goes trough the memory byte by byte.
+TEST(MemoryControllerTest, block_access_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x180, 0x00), false);
+    std::shared_ptr<CountingMemory> io = std::make_shared<CountingMemory>(std::vector<uint8_t>(0x80, 0x00));
+    std::shared_ptr<RecordingObserver> observer = std::make_shared<RecordingObserver>();
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0xC180, io).ok(), true);
+    memory_controller.set_write_observer(observer);
+    std::vector<uint8_t> block(0x180);
+    for(std::size_t i = 0; i < block.size(); ++i){
+        block[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_EQ(memory_controller.write_block(0xC080, block).ok(), true);
+    ASSERT_EQ(ram->get_byte(0x0080).value(), 0x00);
+    ASSERT_EQ(ram->get_byte(0x017F).value(), 0xFF);
+    ASSERT_EQ(io->get_byte(0x0000).value(), 0x00);
+    ASSERT_EQ(io->get_byte(0x007F).value(), 0x7F);
+    //Direct page reported once, the page split between the mounts once per byte
+    ASSERT_EQ(observer->writes.size(), 1 + 0x100);
+    ASSERT_EQ(observer->writes[0], std::make_pair(uint16_t{0xC080}, uint16_t{0x80}));
+    std::vector<uint8_t> read_back(block.size());
+    ASSERT_EQ(memory_controller.read_block(0xC080, read_back).ok(), true);
+    ASSERT_EQ(read_back, block);
+    ASSERT_EQ(io->reads, 2 + 0x80);
+    ASSERT_EQ(std::vector<uint8_t>(ram->get_read_view().begin() + 0x80, ram->get_read_view().end()),
+              std::vector<uint8_t>(block.begin(), block.begin() + 0x100));
+}
+
+/// @brief Checks that block accesses fail on unmapped memory and past the end of the bus.
+TEST(MemoryControllerTest, block_access_invalid_range_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x100, 0x00), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xFF00, ram).ok(), true);
+    std::vector<uint8_t> block(0x10);
+    ASSERT_EQ(memory_controller.read_block(0xFFF0, block).ok(), true);
+    ASSERT_EQ(memory_controller.read_block(0xFFF8, block).code(), mygbc::Status::StatusType::INVALID_INDEX_ERROR);
+    ASSERT_EQ(memory_controller.read_block(0xFEF8, block).code(), mygbc::Status::StatusType::INVALID_MEMORY_RANGE_ERROR);
+    ASSERT_EQ(memory_controller.write_block(0xFFF8, block).code(), mygbc::Status::StatusType::INVALID_INDEX_ERROR);
+}
+
+/// @brief Checks that mounts can be adjacent but not overlap.
+TEST(MemoryControllerTest, mount_range_test){
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0x8010, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x10, 0x00), false)).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x8000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x10, 0x00), false)).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x8020, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x10, 0x00), false)).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0x7F00, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x200, 0x00), false)).ok(), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xFFF0, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x20, 0x00), false)).ok(), false);
+    ASSERT_EQ(memory_controller.get_memory_size(), 0x30);
+}
+
+/// @brief Checks words crossing page and memory boundaries.
+/// @details Bytes of the word come from different pages and memories, stored high byte first.
+TEST(MemoryControllerTest, word_boundary_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x180, 0x00), false);
+    std::shared_ptr<CountingMemory> io = std::make_shared<CountingMemory>(std::vector<uint8_t>(0x80, 0x00));
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0xC180, io).ok(), true);
+    //Page boundary inside the same memory
+    ASSERT_EQ(memory_controller.set_word(0xC0FF, 0x1234).ok(), true);
+    ASSERT_EQ(ram->get_byte(0x00FF).value(), 0x34);
+    ASSERT_EQ(ram->get_byte(0x0100).value(), 0x12);
+    ASSERT_EQ(memory_controller.get_word(0xC0FF).value(), 0x1234);
+    //Memory boundary inside a page
+    ASSERT_EQ(memory_controller.set_word(0xC17F, 0xBEEF).ok(), true);
+    ASSERT_EQ(ram->get_byte(0x017F).value(), 0xEF);
+    ASSERT_EQ(io->get_byte(0x0000).value(), 0xBE);
+    ASSERT_EQ(memory_controller.get_word(0xC17F).value(), 0xBEEF);
+    //Word running past the last mounted byte
+    ASSERT_EQ(memory_controller.get_word(0xC1FF).ok(), false);
+}
+
+/// @brief Checks that writes trough the page table mark the dirty pages of the memory.
+/// @details Direct byte, word and block writes mark their pages, reads do not.
+TEST(MemoryControllerTest, dirty_page_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x2000, 0x00), false);
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC000).ok(), true);
+    ASSERT_EQ(ram->get_dirty_pages().empty(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xC010, 0xAB).ok(), true);
+    ASSERT_EQ(memory_controller.set_word(0xC210, 0x1234).ok(), true);
+    ASSERT_EQ(memory_controller.set_word(0xC3FF, 0x1234).ok(), true);
+    const std::vector<uint8_t> block(0x180, 0xCD);
+    ASSERT_EQ(memory_controller.write_block(0xDE80, block).ok(), true);
+    ASSERT_EQ(ram->get_dirty_pages(), (std::vector<uint16_t>{0x00, 0x02, 0x03, 0x04, 0x1E, 0x1F}));
+    ram->clear_dirty_pages();
+    ASSERT_EQ(memory_controller.set_byte(0xC010, 0xAB).ok(), true);
+    ASSERT_EQ(ram->get_dirty_pages(), (std::vector<uint16_t>{0x00}));
+}
@@ -0,0 +1,48 @@
+#include "../../src/components/scheduler.h" //Scheduler
+#include <gtest/gtest.h> //GTest
+
+/// @brief Checks that events pop in deadline order once due.
+/// @details Ties pop in scheduling order, events not yet due stay pending.
+TEST(SchedulerTest, pop_due_event_test){
+    mygbc::Scheduler scheduler;
+    scheduler.schedule(mygbc::SchedulerEvent::SERIAL_BIT, 100);
+    scheduler.schedule(mygbc::SchedulerEvent::SCANLINE_END, 50);
+    scheduler.schedule(mygbc::SchedulerEvent::TIMER_OVERFLOW, 100);
+    ASSERT_EQ(scheduler.get_next_deadline(), 50);
+    mygbc::SchedulerEvent event;
+    uint64_t deadline = 0;
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), false);
+    scheduler.advance(120);
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), true);
+    ASSERT_EQ(event, mygbc::SchedulerEvent::SCANLINE_END);
+    ASSERT_EQ(deadline, 50);
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), true);
+    ASSERT_EQ(event, mygbc::SchedulerEvent::SERIAL_BIT);
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), true);
+    ASSERT_EQ(event, mygbc::SchedulerEvent::TIMER_OVERFLOW);
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), false);
+    ASSERT_EQ(scheduler.get_next_deadline(), mygbc::Scheduler::no_deadline);
+    ASSERT_EQ(scheduler.get_current_cycle(), 120);
+}
+
+/// @brief Checks rescheduling and cancelling of pending events.
+/// @details Replaced entries never pop, the next deadline skips them.
+TEST(SchedulerTest, reschedule_and_cancel_test){
+    mygbc::Scheduler scheduler;
+    scheduler.schedule(mygbc::SchedulerEvent::DMA_COMPLETE, 10);
+    scheduler.schedule(mygbc::SchedulerEvent::INTERRUPT, 20);
+    scheduler.schedule_at(mygbc::SchedulerEvent::DMA_COMPLETE, 30);
+    ASSERT_EQ(scheduler.get_next_deadline(), 20);
+    ASSERT_EQ(scheduler.get_event_deadline(mygbc::SchedulerEvent::DMA_COMPLETE), 30);
+    scheduler.cancel(mygbc::SchedulerEvent::INTERRUPT);
+    ASSERT_EQ(scheduler.is_scheduled(mygbc::SchedulerEvent::INTERRUPT), false);
+    ASSERT_EQ(scheduler.get_next_deadline(), 30);
+    scheduler.advance(40);
+    mygbc::SchedulerEvent event;
+    uint64_t deadline = 0;
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), true);
+    ASSERT_EQ(event, mygbc::SchedulerEvent::DMA_COMPLETE);
+    ASSERT_EQ(deadline, 30);
+    ASSERT_EQ(scheduler.is_scheduled(mygbc::SchedulerEvent::DMA_COMPLETE), false);
+    ASSERT_EQ(scheduler.pop_due_event(event, deadline), false);
+}
@@ -0,0 +1,364 @@
+#include "../src/gbc.h" //GBC
+#include "../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <chrono> //std::chrono::steady_clock
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+/// @brief Mounts a NOP, JR -3 loop at 0x0000.
+/// @details Single iteration costs 16 ticks, 4 for the NOP and 12 for the JR.
+/// @param gbc GBC to mount the program on
+void mount_loop_program(mygbc::GBC& gbc){
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x18, 0xFD}, true
+    );
+    ASSERT_EQ(gbc.get_memory().mount_memory(0x0000, program).ok(), true);
+}
+
+/// @brief Checks that run_for_cycles stops at the first instruction boundary past the budget.
+/// @details Budget of 98 ticks ends after the NOP of the seventh iteration.
+TEST(GBCTest, run_for_cycles_test){
+    const uint64_t expected_cycles = 100;
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    mygbc::StatusOr<uint64_t> run = gbc.run_for_cycles(98);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), expected_cycles);
+    ASSERT_EQ(gbc.get_elapsed_cycles(), expected_cycles);
+}
+
+class GBCFrameTest : public ::testing::TestWithParam<mygbc::LR35902::ExecutionBackend> {};
+
+/// @brief Checks that run_frames stops exactly at the frame boundaries.
+/// @details A started frame is finished first, every backend lands on the boundary.
+TEST_P(GBCFrameTest, run_frames_test){
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    gbc.get_processing_unit().set_execution_backend(GetParam());
+    ASSERT_EQ(gbc.run_for_cycles(98).ok(), true);
+    mygbc::StatusOr<uint64_t> run = gbc.run_frames(1);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), mygbc::GBC::cycles_per_frame - 100);
+    run = gbc.run_frames(2);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 2 * mygbc::GBC::cycles_per_frame);
+    ASSERT_EQ(gbc.get_elapsed_cycles(), 3 * mygbc::GBC::cycles_per_frame);
+}
+
+/// @brief Initantiazation of run_frames_test.
+/// @details  Initantiazation of run_frames_test.
+INSTANTIATE_TEST_SUITE_P(
+    run_frames_test_cases,
+    GBCFrameTest,
+    ::testing::Values(
+        mygbc::LR35902::ExecutionBackend::INTERPRETER,
+        mygbc::LR35902::ExecutionBackend::BASIC_BLOCK,
+        mygbc::LR35902::ExecutionBackend::JIT
+    )
+);
+
+class GBCBlockDispatchTest : public ::testing::TestWithParam<mygbc::LR35902::ExecutionBackend> {};
+
+/// @brief Checks that the block backends dispatch blocks while running a frame.
+/// @details Segments end at every scanline, blocks are bounded by the rest of the segment instead of skipped.
+///          INC A, JR -3 is no idle loop, every iteration is dispatched.
+TEST_P(GBCBlockDispatchTest, block_dispatch_test){
+    const std::size_t minimum_blocks = 1;
+    mygbc::GBC gbc;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x3C, 0x18, 0xFD}, true
+    );
+    ASSERT_EQ(gbc.get_memory().mount_memory(0x0000, program).ok(), true);
+    gbc.get_processing_unit().set_execution_backend(GetParam());
+    mygbc::StatusOr<uint64_t> run = gbc.run_frames(1);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), mygbc::GBC::cycles_per_frame);
+    ASSERT_GE(gbc.get_processing_unit().get_translated_block_count(), minimum_blocks);
+}
+
+/// @brief Initantiazation of block_dispatch_test.
+/// @details  Initantiazation of block_dispatch_test.
+INSTANTIATE_TEST_SUITE_P(
+    block_dispatch_test_cases,
+    GBCBlockDispatchTest,
+    ::testing::Values(
+        mygbc::LR35902::ExecutionBackend::BASIC_BLOCK,
+        mygbc::LR35902::ExecutionBackend::JIT
+    )
+);
+
+/// @brief Checks that run_until stops once the predicate holds.
+/// @details Predicate on the pc is checked after every dispatch, a single instruction with the interpreter.
+TEST(GBCTest, run_until_predicate_test){
+    const uint64_t expected_cycles = 4 + 16 * 3;
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    gbc.get_processing_unit().set_execution_backend(mygbc::LR35902::ExecutionBackend::INTERPRETER);
+    int nop_count = 0;
+    mygbc::StatusOr<uint64_t> run = gbc.run_until([&nop_count](const mygbc::GBC& state){
+        return const_cast<mygbc::GBC&>(state).get_processing_unit().get_register_snapshot().pc.get_word() == 0x0001 && ++nop_count == 4;
+    }, mygbc::GBC::cycles_per_frame);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), expected_cycles);
+    run = gbc.run_until([](const mygbc::GBC&){ return false; }, 20);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 28);
+}
+
+/// @brief Checks that stopped or expired runs execute nothing.
+/// @details Stop is checked at slice boundaries, init clears it.
+TEST(GBCTest, run_stop_and_deadline_test){
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    mygbc::StatusOr<uint64_t> run = gbc.run_until(std::chrono::steady_clock::now() - std::chrono::seconds(1));
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 0);
+    gbc.stop();
+    run = gbc.run_for_cycles(mygbc::GBC::cycles_per_frame);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 0);
+    ASSERT_EQ(gbc.init().ok(), true);
+    run = gbc.run_for_cycles(16);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 16);
+}
+
+/// @brief Checks that a forked GBC continues from the state of the original.
+/// @details Registers and ticks are copied, memory writes of the clone are not seen by the original.
+TEST(GBCTest, clone_test){
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    std::shared_ptr<mygbc::AddressableMemory> ram = std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x2000, 0x00), false);
+    ASSERT_EQ(gbc.get_memory().mount_memory(0xC000, ram).ok(), true);
+    ASSERT_EQ(gbc.run_for_cycles(98).ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xC000, 0x12).ok(), true);
+    mygbc::StatusOr<std::unique_ptr<mygbc::GBC>> clone_result = gbc.clone();
+    ASSERT_EQ(clone_result.ok(), true);
+    mygbc::GBC& gbc_clone = *clone_result.value();
+    ASSERT_EQ(gbc_clone.get_elapsed_cycles(), gbc.get_elapsed_cycles());
+    ASSERT_EQ(gbc_clone.get_processing_unit().get_register_snapshot().pc.get_word(), gbc.get_processing_unit().get_register_snapshot().pc.get_word());
+    ASSERT_EQ(gbc_clone.get_memory().get_byte(0xC000).value(), 0x12);
+    ASSERT_EQ(gbc_clone.get_memory().set_byte(0xC000, 0x34).ok(), true);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xC000).value(), 0x12);
+    ASSERT_EQ(gbc_clone.run_for_cycles(50).ok(), true);
+    ASSERT_EQ(gbc.run_for_cycles(50).ok(), true);
+    ASSERT_EQ(gbc_clone.get_elapsed_cycles(), gbc.get_elapsed_cycles());
+    ASSERT_EQ(gbc_clone.get_processing_unit().get_register_snapshot().pc.get_word(), gbc.get_processing_unit().get_register_snapshot().pc.get_word());
+}
+
+/// @brief Checks that init mounts the regions of the memory arena.
+/// @details Echo RAM mirrors the work RAM, a fork shares the arena pages copy on write and keeps the mounts.
+TEST(GBCTest, memory_arena_test){
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xC123, 0xAB).ok(), true);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xE123).value(), 0xAB);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xFF80, 0xCD).ok(), true);
+    const std::size_t work_ram_offset = gbc.get_memory_arena().get_region_offset(static_cast<std::size_t>(mygbc::GBC::MemoryRegion::WORK_RAM));
+    ASSERT_EQ(gbc.get_memory_arena().get_byte(work_ram_offset + 0x123), 0xAB);
+    mygbc::StatusOr<std::unique_ptr<mygbc::GBC>> clone_result = gbc.clone();
+    ASSERT_EQ(clone_result.ok(), true);
+    mygbc::GBC& gbc_clone = *clone_result.value();
+    ASSERT_EQ(gbc_clone.init().ok(), true);
+    ASSERT_EQ(gbc_clone.get_memory().set_byte(0xE123, 0x12).ok(), true);
+    ASSERT_EQ(gbc_clone.get_memory_arena().get_byte(work_ram_offset + 0x123), 0x12);
+    ASSERT_EQ(gbc_clone.get_memory().get_byte(0xFF80).value(), 0xCD);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xC123).value(), 0xAB);
+}
+
+/// @brief Checks that writes to the work RAM invalidate the code decoded trough its echo.
+/// @details NOP at 0xC000 runs from 0xE000, then HALT is written to 0xC000. Running 0xE000 again halts, every backend.
+TEST(GBCTest, echo_ram_invalidation_test){
+    for(const mygbc::LR35902::ExecutionBackend execution_backend : {
+        mygbc::LR35902::ExecutionBackend::INTERPRETER, mygbc::LR35902::ExecutionBackend::BASIC_BLOCK, mygbc::LR35902::ExecutionBackend::JIT
+    }){
+        mygbc::GBC gbc;
+        ASSERT_EQ(gbc.init().ok(), true);
+        mygbc::LR35902& cpu = gbc.get_processing_unit();
+        cpu.set_execution_backend(execution_backend);
+        ASSERT_EQ(gbc.get_memory().set_byte(0xC000, 0x00).ok(), true);
+        cpu.get_register_file().pc.set_word(0xE000);
+        ASSERT_EQ(cpu.step(gbc.get_memory(), 4).ok(), true);
+        ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0xE001);
+        ASSERT_EQ(gbc.get_memory().set_byte(0xC000, 0x76).ok(), true);
+        cpu.get_register_file().pc.set_word(0xE000);
+        ASSERT_EQ(cpu.step(gbc.get_memory(), 4).ok(), true);
+        ASSERT_EQ(cpu.get_register_file().pc.get_word(), 0xE001);
+        ASSERT_EQ(cpu.get_register_file().halted, true);
+    }
+}
+
+/// @brief Checks the scanline events of the scheduler.
+/// @details LY follows the scanlines, vertical blank is requested at scanline 144 and the frame wraps to scanline 0.
+TEST(GBCTest, scanline_event_test){
+    mygbc::GBC gbc;
+    mount_loop_program(gbc);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.get_scheduler().get_event_deadline(mygbc::SchedulerEvent::SCANLINE_END), mygbc::GBC::cycles_per_scanline);
+    ASSERT_EQ(gbc.run_for_cycles(3 * mygbc::GBC::cycles_per_scanline).ok(), true);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF44).value(), 3);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF0F).value() & 0x01, 0x00);
+    ASSERT_EQ(gbc.run_for_cycles((mygbc::GBC::vblank_scanline - 3) * mygbc::GBC::cycles_per_scanline).ok(), true);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF44).value(), mygbc::GBC::vblank_scanline);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF0F).value() & 0x01, 0x01);
+    ASSERT_EQ(gbc.run_frames(1).ok(), true);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF44).value(), 0);
+    ASSERT_EQ(gbc.get_scheduler().get_event_deadline(mygbc::SchedulerEvent::SCANLINE_END), mygbc::GBC::cycles_per_frame + mygbc::GBC::cycles_per_scanline);
+}
+
+/// @brief Checks that a halted cpu is fast-forwarded to the event waking it.
+/// @details HALT, JR -3 loop with only the vertical blank enabled. Cpu stays halted trough the visible scanlines, the
+///          budget is still met exactly. Vertical blank request wakes it at scanline 144.
+TEST(GBCTest, halt_fast_forward_test){
+    mygbc::GBC gbc;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x76, 0x18, 0xFD}, true
+    );
+    ASSERT_EQ(gbc.get_memory().mount_memory(0x0000, program).ok(), true);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xFFFF, 0x01).ok(), true);
+    mygbc::StatusOr<uint64_t> run = gbc.run_for_cycles(100 * mygbc::GBC::cycles_per_scanline + 2);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 100 * mygbc::GBC::cycles_per_scanline + 4);
+    ASSERT_EQ(gbc.get_processing_unit().get_register_file().halted, true);
+    ASSERT_EQ(gbc.get_processing_unit().get_register_file().pc.get_word(), 0x0001);
+    //Woken right at the start of the vertical blank, the request stays set so HALT falls trough
+    const uint64_t vblank_cycle = mygbc::GBC::vblank_scanline * mygbc::GBC::cycles_per_scanline;
+    ASSERT_EQ(gbc.run_until([](const mygbc::GBC& state){
+        return !const_cast<mygbc::GBC&>(state).get_processing_unit().get_register_file().halted;
+    }, mygbc::GBC::cycles_per_frame).ok(), true);
+    ASSERT_EQ(gbc.get_elapsed_cycles(), vblank_cycle + 12);
+    ASSERT_EQ(gbc.get_processing_unit().get_register_file().pc.get_word(), 0x0000);
+}
+
+/// @brief Checks that a enabled interrupt is serviced once IME is set.
+/// @details EI, HALT, JR -2 with the vertical blank enabled. Request wakes the cpu and dispatches it to 0x0040 in 20 ticks,
+///          pc is pushed like CALL and the request is acknowledged.
+TEST(GBCTest, interrupt_service_test){
+    mygbc::GBC gbc;
+    std::vector<uint8_t> program(0x48, 0x00);
+    program[0x00] = 0xFB;
+    program[0x01] = 0x76;
+    program[0x02] = 0x18;
+    program[0x03] = 0xFE;
+    program[0x40] = 0x18;
+    program[0x41] = 0xFE;
+    ASSERT_EQ(gbc.get_memory().mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xFFFF, 0x01).ok(), true);
+    ASSERT_EQ(gbc.get_interrupt_controller().get_interrupt_enable(), 0x01);
+    gbc.get_processing_unit().get_register_file().sp.set_word(0xC000);
+    ASSERT_EQ(gbc.run_until([](const mygbc::GBC& state){
+        return const_cast<mygbc::GBC&>(state).get_processing_unit().get_register_file().pc.get_word() == 0x0040;
+    }, mygbc::GBC::cycles_per_frame).ok(), true);
+    const mygbc::LR35902RegisterFile& register_file = gbc.get_processing_unit().get_register_file();
+    ASSERT_EQ(gbc.get_elapsed_cycles(), mygbc::GBC::vblank_scanline * mygbc::GBC::cycles_per_scanline + mygbc::LR35902::interrupt_service_ticks);
+    ASSERT_EQ(register_file.ime, false);
+    ASSERT_EQ(register_file.halted, false);
+    ASSERT_EQ(register_file.sp.get_word(), 0xC002);
+    ASSERT_EQ(gbc.get_memory().get_word(0xC000).value(), 0x0002);
+    ASSERT_EQ(gbc.get_memory().get_byte(0xFF0F).value() & 0x01, 0x00);
+    ASSERT_EQ(gbc.get_interrupt_controller().get_pending(), 0x00);
+}
+
+/// @brief Checks the HALT bug.
+/// @details HALT with IME clear and a interrupt pending does not halt, JR +2 after it is read as JR +24 from 0x0002.
+TEST(GBCTest, halt_bug_test){
+    mygbc::GBC gbc;
+    std::vector<uint8_t> program(0x20, 0x00);
+    program[0x00] = 0x76;
+    program[0x01] = 0x18;
+    program[0x02] = 0x02;
+    ASSERT_EQ(gbc.get_memory().mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+    ASSERT_EQ(gbc.init().ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xFFFF, 0x01).ok(), true);
+    ASSERT_EQ(gbc.get_memory().set_byte(0xFF0F, 0x01).ok(), true);
+    mygbc::StatusOr<uint64_t> run = gbc.run_for_cycles(16);
+    ASSERT_EQ(run.ok(), true);
+    ASSERT_EQ(run.value(), 16);
+    const mygbc::LR35902RegisterFile& register_file = gbc.get_processing_unit().get_register_file();
+    ASSERT_EQ(register_file.halted, false);
+    ASSERT_EQ(register_file.halt_bug, false);
+    ASSERT_EQ(register_file.pc.get_word(), 0x001A);
+    //Request stays pending, IME never set
+    ASSERT_EQ(gbc.get_interrupt_controller().get_pending(), 0x01);
+}
+
+/// @brief Checks that lazy and eager flags agree while running ALU code.
+/// @details INC B keeps the carry of ADD A, ADD HL keeps the zero flag of INC B, DEC B keeps the carry of ADD HL.
+TEST(GBCTest, lazy_flags_switch_test){
+    //LD A, 0x0F; INC A; ADD A, 0xF0; INC B; ADD HL, BC; DEC B; SUB A, 0x01; JR -12
+    const std::vector<uint8_t> program{0x3E, 0x0F, 0x3C, 0xC6, 0xF0, 0x04, 0x09, 0x05, 0xD6, 0x01, 0x18, 0xF4};
+    mygbc::GBC lazy_gbc;
+    mygbc::GBC eager_gbc;
+    ASSERT_EQ(lazy_gbc.is_lazy_flags(), true);
+    eager_gbc.set_lazy_flags(false);
+    ASSERT_EQ(eager_gbc.is_lazy_flags(), false);
+    for(mygbc::GBC* gbc : {&lazy_gbc, &eager_gbc}){
+        ASSERT_EQ(gbc->get_memory().mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+        ASSERT_EQ(gbc->init().ok(), true);
+    }
+    for(const uint64_t budget : {4, 8, 12, 16, 20, 24, 28, 36, 1000}){
+        ASSERT_EQ(lazy_gbc.run_for_cycles(budget).ok(), true);
+        ASSERT_EQ(eager_gbc.run_for_cycles(budget).ok(), true);
+        const mygbc::LR35902RegisterFile lazy_registers = lazy_gbc.get_processing_unit().get_register_snapshot();
+        const mygbc::LR35902RegisterFile eager_registers = eager_gbc.get_processing_unit().get_register_snapshot();
+        ASSERT_EQ(lazy_registers.pc.get_word(), eager_registers.pc.get_word());
+        ASSERT_EQ(lazy_registers.get_af(), eager_registers.get_af());
+        ASSERT_EQ(lazy_registers.b_c.get_word(), eager_registers.b_c.get_word());
+        ASSERT_EQ(lazy_registers.h_l.get_word(), eager_registers.h_l.get_word());
+    }
+    ASSERT_EQ(eager_gbc.get_processing_unit().get_register_file().lazy_flags.is_pending(), false);
+}
+
+/// @brief Runs the same calls on the GBC with idle loop skipping on and off.
+/// @details Registers, ticks, scanline and pending events must match at the end of every run.
+/// @param program Program mounted at 0x0000
+void expect_idle_loop_skipping_matches_stepping(const std::vector<uint8_t>& program, const mygbc::LR35902::ExecutionBackend execution_backend){
+    mygbc::GBC skipping_gbc;
+    mygbc::GBC stepping_gbc;
+    stepping_gbc.set_idle_loop_skipping(false);
+    for(mygbc::GBC* gbc : {&skipping_gbc, &stepping_gbc}){
+        ASSERT_EQ(gbc->get_memory().mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(program, true)).ok(), true);
+        ASSERT_EQ(gbc->init().ok(), true);
+        gbc->get_processing_unit().set_execution_backend(execution_backend);
+    }
+    ASSERT_EQ(skipping_gbc.is_idle_loop_skipping(), true);
+    ASSERT_EQ(stepping_gbc.is_idle_loop_skipping(), false);
+    const std::vector<uint64_t> budgets{98, 1000, 457, mygbc::GBC::cycles_per_frame, 3 * mygbc::GBC::cycles_per_frame + 13, 4095};
+    for(const uint64_t budget : budgets){
+        mygbc::StatusOr<uint64_t> skipping_run = skipping_gbc.run_for_cycles(budget);
+        mygbc::StatusOr<uint64_t> stepping_run = stepping_gbc.run_for_cycles(budget);
+        ASSERT_EQ(skipping_run.ok(), true);
+        ASSERT_EQ(stepping_run.ok(), true);
+        ASSERT_EQ(skipping_run.value(), stepping_run.value());
+        ASSERT_EQ(skipping_gbc.get_elapsed_cycles(), stepping_gbc.get_elapsed_cycles());
+        const mygbc::LR35902RegisterFile skipping_registers = skipping_gbc.get_processing_unit().get_register_snapshot();
+        const mygbc::LR35902RegisterFile stepping_registers = stepping_gbc.get_processing_unit().get_register_snapshot();
+        ASSERT_EQ(skipping_registers.pc.get_word(), stepping_registers.pc.get_word());
+        ASSERT_EQ(skipping_registers.get_af(), stepping_registers.get_af());
+        ASSERT_EQ(skipping_gbc.get_memory().get_byte(0xFF44).value(), stepping_gbc.get_memory().get_byte(0xFF44).value());
+        ASSERT_EQ(skipping_gbc.get_scheduler().get_next_deadline(), stepping_gbc.get_scheduler().get_next_deadline());
+    }
+}
+
+/// @brief Checks that idle loop skipping matches plain stepping on every backend.
+/// @details NOP, NOP, JR -4 spins for 20 ticks a iteration, JR -2 for 12 ticks. LY polling loops leave once
+///          a SCANLINE_END event reaches line 0x90, the HRAM polling loop never does.
+TEST(GBCTest, idle_loop_skipping_accuracy_test){
+    for(const mygbc::LR35902::ExecutionBackend execution_backend : {
+        mygbc::LR35902::ExecutionBackend::INTERPRETER, mygbc::LR35902::ExecutionBackend::BASIC_BLOCK, mygbc::LR35902::ExecutionBackend::JIT
+    }){
+        expect_idle_loop_skipping_matches_stepping({0x00, 0x00, 0x18, 0xFC}, execution_backend);
+        expect_idle_loop_skipping_matches_stepping({0x00, 0x18, 0xFE}, execution_backend);
+        expect_idle_loop_skipping_matches_stepping({0xFE, 0x90, 0x20, 0xFC}, execution_backend);
+        //LDH A, [LY]; CP 0x90; JR NZ, -6; JR -2
+        expect_idle_loop_skipping_matches_stepping({0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA, 0x18, 0xFE}, execution_backend);
+        //LD C, 0x44; LDH A, [C]; CP 0x90; JR NZ, -5; JR -2
+        expect_idle_loop_skipping_matches_stepping({0x0E, 0x44, 0xF2, 0xFE, 0x90, 0x20, 0xFB, 0x18, 0xFE}, execution_backend);
+        //LDH A, [0x80]; AND A, A; JR Z, -5
+        expect_idle_loop_skipping_matches_stepping({0xF0, 0x80, 0xA7, 0x28, 0xFB}, execution_backend);
+    }
+}
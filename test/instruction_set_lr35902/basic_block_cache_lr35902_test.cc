@@ -0,0 +1,63 @@
+#include "../../src/instruction_set_lr35902/basic_block_cache_lr35902.h" //BasicBlockCacheLR35902
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+/// @brief Checks that translation stops after the first block ending instruction.
+/// @details NOP, NOP, NOP, JR e8 translate into a single block of 4 operations.
+TEST(BasicBlockCacheLR35902Test, translate_until_branch_test){
+    const std::size_t expected_operations = 4;
+    const uint16_t expected_last_address = 0x0004;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x00, 0x00, 0x18, 0xFB, 0x00}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    ASSERT_EQ(block_fetch.value()->operations.size(), expected_operations);
+    ASSERT_EQ(block_fetch.value()->last_address, expected_last_address);
+    ASSERT_EQ(block_fetch.value()->operations[3].decoded_instruction.read_value, 0xFB);
+}
+
+/// @brief Checks that translation stops at the end of the start page.
+/// @details Block of NOPs starting near the page end ends at the last byte of the page.
+TEST(BasicBlockCacheLR35902Test, translate_until_page_end_test){
+    const std::size_t expected_operations = 2;
+    const uint16_t expected_last_address = 0x00FF;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>(0x200, 0x00), true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x00FE, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    ASSERT_EQ(block_fetch.value()->operations.size(), expected_operations);
+    ASSERT_EQ(block_fetch.value()->last_address, expected_last_address);
+}
+
+/// @brief Checks that writes to the page of a block make it stale.
+/// @details Write to a different page keeps the block current.
+TEST(BasicBlockCacheLR35902Test, write_makes_block_stale_test){
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x18, 0xFD}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    const uint64_t bank_tag = memory_controller.get_contents_tag(0x0000);
+    ASSERT_EQ(mygbc::BasicBlockCacheLR35902::is_current(*block_fetch.value(), bank_tag, predecode_cache), true);
+    predecode_cache.on_memory_write(0xC000, 1);
+    ASSERT_EQ(mygbc::BasicBlockCacheLR35902::is_current(*block_fetch.value(), bank_tag, predecode_cache), true);
+    predecode_cache.on_memory_write(0x0080, 1);
+    ASSERT_EQ(mygbc::BasicBlockCacheLR35902::is_current(*block_fetch.value(), bank_tag, predecode_cache), false);
+    ASSERT_EQ(mygbc::BasicBlockCacheLR35902::is_current(*block_fetch.value(), bank_tag + 1, predecode_cache), false);
+}
@@ -0,0 +1,65 @@
+#include "../../src/instruction_set_lr35902/idle_loop_detector_lr35902.h" //IdleLoopDetectorLR35902
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+//Program at 0x0000 and the expected analysis of it
+struct IdleLoopCase{
+    std::vector<uint8_t> program;
+    bool expected_idle;
+    uint16_t expected_last_address;
+};
+
+class IdleLoopDetectorLR35902Test : public ::testing::TestWithParam<IdleLoopCase> {};
+
+/// @brief Checks the analysis of the loop starting at 0x0000.
+/// @details Loads, compares and logic operations closed by a jump to the start are idle when they write no memory and
+///          read nothing left over from the previous iteration.
+TEST_P(IdleLoopDetectorLR35902Test, find_idle_loop_test){
+    mygbc::IdleLoopDetectorLR35902 idle_loop_detector;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(GetParam().program, true)).ok(), true);
+    uint16_t last_address = 0;
+    ASSERT_EQ(idle_loop_detector.find_idle_loop(memory_controller, 0x0000, predecode_cache, last_address), GetParam().expected_idle);
+    if(GetParam().expected_idle){
+        ASSERT_EQ(last_address, GetParam().expected_last_address);
+    }
+    //Cached result
+    ASSERT_EQ(idle_loop_detector.find_idle_loop(memory_controller, 0x0000, predecode_cache, last_address), GetParam().expected_idle);
+}
+
+/// @brief Initantiazation of find_idle_loop_test.
+/// @details  Initantiazation of find_idle_loop_test.
+INSTANTIATE_TEST_SUITE_P(
+    find_idle_loop_test_cases,
+    IdleLoopDetectorLR35902Test,
+    ::testing::Values(
+        IdleLoopCase{{0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA}, true, 0x0005}, //LDH A, [LY]; CP A, 0x90; JR NZ, -6
+        IdleLoopCase{{0xFA, 0x00, 0xC0, 0xA7, 0x28, 0xFA}, true, 0x0005}, //LD A, [0xC000]; AND A, A; JR Z, -6
+        IdleLoopCase{{0x7E, 0x47, 0x18, 0xFC}, true, 0x0003}, //LD A, [HL]; LD B, A; JR -4
+        IdleLoopCase{{0x18, 0xFE}, true, 0x0001}, //JR -2
+        IdleLoopCase{{0x47, 0x7E, 0x18, 0xFC}, false, 0x0000}, //LD B, A; LD A, [HL]; JR -4, B from the previous A
+        IdleLoopCase{{0x2A, 0x18, 0xFD}, false, 0x0000}, //LD A, [HL+]; JR -3, HL advances
+        IdleLoopCase{{0x04, 0x20, 0xFD}, false, 0x0000}, //INC B; JR NZ, -3, counter
+        IdleLoopCase{{0xE0, 0x80, 0x18, 0xFC}, false, 0x0000}, //LDH [0x80], A; JR -4, store
+        IdleLoopCase{{0x00, 0x18, 0xFE}, false, 0x0000}, //NOP; JR -2, loop starts at 0x0001
+        IdleLoopCase{{0x00, 0xC9}, false, 0x0000}, //NOP; RET, no loop
+        IdleLoopCase{{0xF0, 0x41, 0xCB, 0x4F, 0x20, 0xFA}, false, 0x0000} //LDH A, [STAT]; BIT 1, A; JR NZ, -6, bit tests not accepted
+    )
+);
+
+/// @brief Checks that writing over a idle loop analyses it again.
+/// @details LD B, A is overwritten with LD [HL], A storing every iteration.
+TEST(IdleLoopDetectorLR35902WriteTest, write_invalidates_analysis_test){
+    mygbc::IdleLoopDetectorLR35902 idle_loop_detector;
+    std::shared_ptr<mygbc::PredecodeCacheLR35902> predecode_cache = std::make_shared<mygbc::PredecodeCacheLR35902>();
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>{0x7E, 0x47, 0x18, 0xFC}, false)).ok(), true);
+    memory_controller.set_write_observer(predecode_cache);
+    uint16_t last_address = 0;
+    ASSERT_EQ(idle_loop_detector.find_idle_loop(memory_controller, 0x0000, *predecode_cache, last_address), true);
+    ASSERT_EQ(memory_controller.set_byte(0x0001, 0x77).ok(), true);
+    ASSERT_EQ(idle_loop_detector.find_idle_loop(memory_controller, 0x0000, *predecode_cache, last_address), false);
+}
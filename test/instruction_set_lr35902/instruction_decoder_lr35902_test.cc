@@ -39,7 +39,7 @@ INSTANTIATE_TEST_SUITE_P(
         ),
         //2 byte read
         std::make_tuple(
-            mygbc::AddressableMemory(std::vector<uint8_t>{0x11, 0xF0, 0xA0}, false), //LD DE, n16 
+            mygbc::AddressableMemory(std::vector<uint8_t>{0x11, 0xA0, 0xF0}, false), //LD DE, n16 
             mygbc::InstructionLR35902(0x0011,3,std::vector<mygbc::InstructionLR35902::OperandRegister>{mygbc::InstructionLR35902::OperandRegister("DE", 0, false, false, false, false)},std::vector<mygbc::InstructionLR35902::OperandConstValue>{},true, 2, 1, 0xF0A0, mygbc::InstructionLR35902::OperandValueInterpHint::VALUE,mygbc::InstructionLR35902::ExecutionCondition::NONE,"LD","LD DE, n16","LD DE, %1",std::vector<uint8_t>{12},mygbc::InstructionLR35902::FlagOperation::NO_CHANGE,mygbc::InstructionLR35902::FlagOperation::NO_CHANGE,mygbc::InstructionLR35902::FlagOperation::NO_CHANGE,mygbc::InstructionLR35902::FlagOperation::NO_CHANGE)
         )
     )
@@ -0,0 +1,247 @@
+#include "../../src/instruction_set_lr35902/instruction_executor_lr35902.h" //InstructionExecutorLR35902
+#include "../../src/instruction_set_lr35902/instruction_set_lr35902.h" //InstructionSetLR35902
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <tuple> //std::tuple
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+class InstructionExecutorDispatchIndexTest : public ::testing::TestWithParam<std::tuple<uint16_t, std::size_t>> {};
+
+/// @brief Checks that opcodes map to the correct dispatch table index.
+/// @details Unprefixed opcodes map to the lower half and 0xCB prefixed to the upper half.
+TEST_P(InstructionExecutorDispatchIndexTest, dispatch_index_test){
+    std::tuple<uint16_t, std::size_t> test_values = GetParam();
+    ASSERT_EQ(mygbc::InstructionExecutorLR35902::get_dispatch_index(std::get<0>(test_values)), std::get<1>(test_values));
+}
+
+/// @brief Initantiazation of dispatch_index_test.
+/// @details  Initantiazation of dispatch_index_test.
+INSTANTIATE_TEST_SUITE_P(
+    dispatch_index_test_cases,
+    InstructionExecutorDispatchIndexTest,
+    ::testing::Values(
+        std::make_tuple(0x0000, 0x000), //NOP
+        std::make_tuple(0x00C3, 0x0C3), //JP a16
+        std::make_tuple(0x00CB, 0x0CB), //PREFIX
+        std::make_tuple(0xCB00, 0x100), //RLC B
+        std::make_tuple(0xCBFF, 0x1FF) //SET 7, A
+    )
+);
+
+/// @brief Checks that a dispatched executor runs the instruction.
+/// @details JR e8 moves the pc by the signed read value. Pc is advanced past the instruction before execution.
+TEST(InstructionExecutorDispatchTest, dispatch_jr_test){
+    const uint16_t start_pc = 0x0100;
+    const uint16_t expected_pc = 0x00F0;
+    const uint8_t expected_ticks = 12;
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0018), 0xF0}; //JR -16
+    register_file.pc.set_word(start_pc);
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), true);
+    ASSERT_EQ(execution.value(), expected_ticks);
+    ASSERT_EQ(register_file.pc.get_word(), expected_pc);
+}
+
+/// @brief Checks that opcodes without a executor land in the error slot.
+/// @details Status is returned instead of executing.
+TEST(InstructionExecutorDispatchTest, dispatch_missing_executor_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_INDEX_ERROR;
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    mygbc::DecodedInstructionLR35902 push_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00C5), 0x00}; //PUSH BC
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(push_instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), false);
+    ASSERT_EQ(execution.status().code(), expected_status);
+}
+
+/// @brief Checks that JP a16 jumps to the read value.
+/// @details Read value of JP a16 is interpreted as a plain value.
+TEST(InstructionExecutorDispatchTest, dispatch_jp_test){
+    const uint16_t expected_pc = 0x1234;
+    const uint8_t expected_ticks = 16;
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00C3), expected_pc}; //JP a16
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), true);
+    ASSERT_EQ(execution.value(), expected_ticks);
+    ASSERT_EQ(register_file.pc.get_word(), expected_pc);
+}
+
+/// @brief Checks that a untaken conditional jump leaves the pc alone.
+/// @details Pc already points at the next instruction, skip cost is returned.
+TEST(InstructionExecutorDispatchTest, dispatch_jr_untaken_test){
+    const uint16_t start_pc = 0x0102;
+    const uint8_t expected_ticks = 8;
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0028), 0xF0}; //JR Z, -16
+    register_file.set_zero_flag(false);
+    register_file.pc.set_word(start_pc);
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), true);
+    ASSERT_EQ(execution.value(), expected_ticks);
+    ASSERT_EQ(register_file.pc.get_word(), start_pc);
+}
+
+class InstructionExecutorAluTest : public ::testing::TestWithParam<std::tuple<uint16_t, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>> {};
+
+/// @brief Checks the 8-bit ALU, rotate and shift executors.
+/// @details Opcode, read value, A, B and F before, A, B and F after. Flags are read trough the lazy flags.
+TEST_P(InstructionExecutorAluTest, dispatch_alu_test){
+    auto [opcode, read_value, a, b, flags, expected_a, expected_b, expected_flags] = GetParam();
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(opcode), read_value};
+    register_file.set_lazy_flags_enabled(true);
+    register_file.a_f.set_high(a);
+    register_file.b_c.set_high(b);
+    register_file.set_flags(flags);
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), true);
+    ASSERT_EQ(execution.value(), instruction.descriptor->t_cycles_costs[0]);
+    ASSERT_EQ(register_file.a_f.get_high(), expected_a);
+    ASSERT_EQ(register_file.b_c.get_high(), expected_b);
+    ASSERT_EQ(register_file.get_flags(), expected_flags);
+}
+
+/// @brief Initantiazation of dispatch_alu_test.
+/// @details  Initantiazation of dispatch_alu_test.
+INSTANTIATE_TEST_SUITE_P(
+    dispatch_alu_test_cases,
+    InstructionExecutorAluTest,
+    ::testing::Values(
+        std::make_tuple(0x0080, 0x00, 0x3A, 0xC6, 0x00, 0x00, 0xC6, 0xB0), //ADD A, B
+        std::make_tuple(0x0088, 0x00, 0xE1, 0x1E, 0x10, 0x00, 0x1E, 0xB0), //ADC A, B
+        std::make_tuple(0x0090, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x3E, 0xC0), //SUB B
+        std::make_tuple(0x0098, 0x00, 0x3B, 0x2A, 0x10, 0x10, 0x2A, 0x40), //SBC A, B
+        std::make_tuple(0x00A0, 0x00, 0x5A, 0x3F, 0x10, 0x1A, 0x3F, 0x20), //AND B
+        std::make_tuple(0x00A8, 0x00, 0xFF, 0xFF, 0x70, 0x00, 0xFF, 0x80), //XOR B
+        std::make_tuple(0x00B0, 0x00, 0x5A, 0x00, 0xF0, 0x5A, 0x00, 0x00), //OR B
+        std::make_tuple(0x00B8, 0x00, 0x3C, 0x40, 0x00, 0x3C, 0x40, 0x50), //CP B
+        std::make_tuple(0x00C6, 0x0F, 0x01, 0x00, 0x00, 0x10, 0x00, 0x20), //ADD A, n8
+        std::make_tuple(0x00FE, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xC0), //CP n8
+        std::make_tuple(0x0004, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x00, 0xB0), //INC B
+        std::make_tuple(0x0005, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC0), //DEC B
+        std::make_tuple(0x003C, 0x00, 0x0F, 0x00, 0x00, 0x10, 0x00, 0x20), //INC A
+        std::make_tuple(0x0027, 0x00, 0x7D, 0x00, 0x00, 0x83, 0x00, 0x00), //DAA after addition
+        std::make_tuple(0x0027, 0x00, 0x3C, 0x00, 0x60, 0x36, 0x00, 0x40), //DAA after subtraction
+        std::make_tuple(0x0027, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x90), //DAA carry out
+        std::make_tuple(0x002F, 0x00, 0x35, 0x00, 0x90, 0xCA, 0x00, 0xF0), //CPL
+        std::make_tuple(0x0037, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90), //SCF
+        std::make_tuple(0x003F, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00), //CCF
+        std::make_tuple(0x003F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x90), //CCF
+        std::make_tuple(0x0007, 0x00, 0x85, 0x00, 0x80, 0x0B, 0x00, 0x10), //RLCA
+        std::make_tuple(0x0017, 0x00, 0x95, 0x00, 0x10, 0x2B, 0x00, 0x10), //RLA
+        std::make_tuple(0x000F, 0x00, 0x3B, 0x00, 0x00, 0x9D, 0x00, 0x10), //RRCA
+        std::make_tuple(0x001F, 0x00, 0x81, 0x00, 0x00, 0x40, 0x00, 0x10), //RRA
+        std::make_tuple(0xCB00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x10), //RLC B
+        std::make_tuple(0xCB18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90), //RR B
+        std::make_tuple(0xCB20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x90), //SLA B
+        std::make_tuple(0xCB28, 0x00, 0x00, 0x8A, 0x00, 0x00, 0xC5, 0x00), //SRA B
+        std::make_tuple(0xCB38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90), //SRL B
+        std::make_tuple(0xCB30, 0x00, 0x00, 0xF0, 0x10, 0x00, 0x0F, 0x00), //SWAP B
+        std::make_tuple(0xCB37, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80) //SWAP A
+    )
+);
+
+/// @brief Checks the 16-bit ALU executors.
+/// @details INC rr leaves the flags alone, ADD HL keeps Z, ADD SP takes the flags of the low byte.
+TEST(InstructionExecutorDispatchTest, dispatch_alu_16bit_test){
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    register_file.set_flags(0xF0);
+    register_file.b_c.set_word(0xFFFF);
+    mygbc::DecodedInstructionLR35902 inc_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0003), 0x00}; //INC BC
+    ASSERT_EQ(executor.execute_instruction(inc_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.b_c.get_word(), 0x0000);
+    ASSERT_EQ(register_file.get_flags(), 0xF0);
+    register_file.h_l.set_word(0x8A23);
+    register_file.d_e.set_word(0x0605);
+    mygbc::DecodedInstructionLR35902 add_hl_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0019), 0x00}; //ADD HL, DE
+    ASSERT_EQ(executor.execute_instruction(add_hl_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.h_l.get_word(), 0x9028);
+    ASSERT_EQ(register_file.get_flags(), 0xA0);
+    register_file.sp.set_word(0xFFF8);
+    mygbc::DecodedInstructionLR35902 add_sp_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00E8), 0xFE}; //ADD SP, -2
+    ASSERT_EQ(executor.execute_instruction(add_sp_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.sp.get_word(), 0xFFF6);
+    ASSERT_EQ(register_file.get_flags(), 0x30);
+}
+
+/// @brief Checks the ALU executors on the byte at HL.
+/// @details Read-modify-write variations write the result back to memory.
+TEST(InstructionExecutorDispatchTest, dispatch_alu_indirect_test){
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> memory = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x0F, 0x81}, false
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, memory).ok(), true);
+    register_file.h_l.set_word(0x0001);
+    register_file.a_f.set_high(0x01);
+    mygbc::DecodedInstructionLR35902 inc_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0034), 0x00}; //INC [HL]
+    ASSERT_EQ(executor.execute_instruction(inc_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x0001).value(), 0x10);
+    ASSERT_EQ(register_file.get_flags(), 0x20);
+    mygbc::DecodedInstructionLR35902 add_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0086), 0x00}; //ADD A, [HL]
+    ASSERT_EQ(executor.execute_instruction(add_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.a_f.get_high(), 0x11);
+    register_file.h_l.set_word(0x0002);
+    mygbc::DecodedInstructionLR35902 rlc_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0xCB06), 0x00}; //RLC [HL]
+    ASSERT_EQ(executor.execute_instruction(rlc_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x0002).value(), 0x03);
+    ASSERT_EQ(register_file.get_flags(), 0x10);
+}
+
+/// @brief Checks the LD and LDH executors.
+/// @details Immidiate, register, memory and high page loads. HL+ moves HL after the access, LD [a16], SP stores low byte first.
+TEST(InstructionExecutorDispatchTest, dispatch_ld_test){
+    mygbc::InstructionExecutorLR35902 executor;
+    mygbc::LR35902RegisterFile register_file;
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x10, 0x00), false)).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0xFF00, std::make_shared<mygbc::AddressableMemory>(std::vector<uint8_t>(0x100, 0x00), false)).ok(), true);
+    mygbc::DecodedInstructionLR35902 ld_n8_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x003E), 0x5A}; //LD A, 0x5A
+    mygbc::StatusOr<uint8_t> execution = executor.execute_instruction(ld_n8_instruction, register_file, memory_controller);
+    ASSERT_EQ(execution.ok(), true);
+    ASSERT_EQ(execution.value(), 8);
+    ASSERT_EQ(register_file.a_f.get_high(), 0x5A);
+    mygbc::DecodedInstructionLR35902 ld_register_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0047), 0x00}; //LD B, A
+    ASSERT_EQ(executor.execute_instruction(ld_register_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.b_c.get_high(), 0x5A);
+    mygbc::DecodedInstructionLR35902 ld_n16_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0021), 0xC001}; //LD HL, 0xC001
+    ASSERT_EQ(executor.execute_instruction(ld_n16_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.h_l.get_word(), 0xC001);
+    mygbc::DecodedInstructionLR35902 ld_hl_increment_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0022), 0x00}; //LD [HL+], A
+    ASSERT_EQ(executor.execute_instruction(ld_hl_increment_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC001).value(), 0x5A);
+    ASSERT_EQ(register_file.h_l.get_word(), 0xC002);
+    mygbc::DecodedInstructionLR35902 ld_a16_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00FA), 0xC001}; //LD A, [0xC001]
+    register_file.a_f.set_high(0x00);
+    ASSERT_EQ(executor.execute_instruction(ld_a16_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.a_f.get_high(), 0x5A);
+    mygbc::DecodedInstructionLR35902 ldh_store_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00E0), 0x80}; //LDH [0x80], A
+    ASSERT_EQ(executor.execute_instruction(ldh_store_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xFF80).value(), 0x5A);
+    register_file.b_c.set_low(0x80);
+    register_file.a_f.set_high(0x00);
+    mygbc::DecodedInstructionLR35902 ldh_c_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00F2), 0x00}; //LDH A, [C]
+    ASSERT_EQ(executor.execute_instruction(ldh_c_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(register_file.a_f.get_high(), 0x5A);
+    register_file.sp.set_word(0xBEEF);
+    mygbc::DecodedInstructionLR35902 ld_sp_store_instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0008), 0xC004}; //LD [0xC004], SP
+    ASSERT_EQ(executor.execute_instruction(ld_sp_store_instruction, register_file, memory_controller).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xC004).value(), 0xEF);
+    ASSERT_EQ(memory_controller.get_byte(0xC005).value(), 0xBE);
+}
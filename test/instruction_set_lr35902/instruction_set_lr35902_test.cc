@@ -0,0 +1,55 @@
+#include "../../src/instruction_set_lr35902/instruction_set_lr35902.h" //InstructionSetLR35902
+#include <gtest/gtest.h> //GTest
+#include <type_traits> //std::is_trivially_copyable_v
+
+/// @brief Checks that every legal opcode is reachable through both the descriptor and the full instruction.
+/// @details 501 legal opcodes, 11 unprefixed gaps.
+TEST(InstructionSetTest, legal_opcode_count_test){
+    const int expected_legal_opcodes = 501;
+    mygbc::InstructionSetLR35902 instruction_set;
+    int legal_opcodes = 0;
+    for(uint32_t opcode = 0; opcode <= 0xFFFF; ++opcode){
+        const mygbc::InstructionDescriptorLR35902& descriptor = mygbc::InstructionSetLR35902::get_descriptor(opcode);
+        mygbc::StatusOr<mygbc::InstructionLR35902> instruction_fetch = instruction_set.get_by_opcode(opcode);
+        ASSERT_EQ(instruction_fetch.ok(), descriptor.is_valid());
+        if(descriptor.is_valid()){
+            ASSERT_EQ(descriptor.opcode, opcode);
+            ASSERT_EQ(instruction_fetch.value().size_in_bytes, descriptor.size_in_bytes);
+            ++legal_opcodes;
+        }
+    }
+    ASSERT_EQ(legal_opcodes, expected_legal_opcodes);
+}
+
+/// @brief Checks that the descriptor expands into the matching full instruction.
+/// @details LD [HL-], A carries operands, mnemonics and flag effects.
+TEST(InstructionSetTest, descriptor_expansion_test){
+    mygbc::InstructionSetLR35902 instruction_set;
+    mygbc::StatusOr<mygbc::InstructionLR35902> instruction_fetch = instruction_set.get_by_opcode(0x0032); //LD [HL-], A
+    ASSERT_EQ(instruction_fetch.ok(), true);
+    const mygbc::InstructionLR35902& instruction = instruction_fetch.value();
+    ASSERT_EQ(instruction.full_mnemonic, "LD [HL-], A");
+    ASSERT_EQ(instruction.short_mnemonic, "LD");
+    ASSERT_EQ(instruction.operand_registers.size(), 2);
+    ASSERT_EQ(instruction.operand_registers[0].id, "HL");
+    ASSERT_EQ(instruction.operand_registers[0].address_mode, true);
+    ASSERT_EQ(instruction.operand_registers[0].decrement, true);
+    ASSERT_EQ(instruction.operand_registers[1].id, "A");
+    ASSERT_EQ(instruction.operand_registers[1].operand_position, 1);
+    ASSERT_EQ(instruction.t_cycles_costs, std::vector<uint8_t>{8});
+    ASSERT_EQ(instruction.effect_on_flag_z, mygbc::InstructionLR35902::FlagOperation::NO_CHANGE);
+}
+
+/// @brief Checks that illegal opcodes return a error status.
+/// @details Both gaps in the table and opcodes with unknown prefixes are rejected.
+TEST(InstructionSetTest, illegal_opcode_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_OPCODE_ERROR;
+    mygbc::InstructionSetLR35902 instruction_set;
+    for(const uint16_t opcode : {0x00D3, 0x00ED, 0x01CB, 0xED00}){
+        mygbc::StatusOr<mygbc::InstructionLR35902> instruction_fetch = instruction_set.get_by_opcode(opcode);
+        ASSERT_EQ(instruction_fetch.ok(), false);
+        ASSERT_EQ(instruction_fetch.status().code(), expected_status);
+        ASSERT_EQ(mygbc::InstructionSetLR35902::get_descriptor(opcode).is_valid(), false);
+        ASSERT_EQ(mygbc::InstructionSetLR35902::get_mnemonic(opcode).full_mnemonic, "ILLEGAL");
+    }
+}
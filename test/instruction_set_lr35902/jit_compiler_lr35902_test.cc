@@ -0,0 +1,122 @@
+#include "../../src/instruction_set_lr35902/jit_compiler_lr35902.h" //JitCompilerLR35902
+#include "../../src/instruction_set_lr35902/basic_block_cache_lr35902.h" //BasicBlockCacheLR35902
+#include "../../src/memory/addressable_memory.h" //AddressableMemory
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+#include <tuple> //std::tuple
+
+class JitCompilerLR35902ConditionalTest : public ::testing::TestWithParam<std::tuple<uint8_t, int32_t, uint16_t, int32_t>> {};
+
+/// @brief Checks that a compiled conditional block exits trough the correct path.
+/// @details NOP, JR Z, +5. Taken exit jumps relative to the next instruction, both exits subtract their ticks from the budget.
+///          Budget below the most expensive path returns without running the block.
+TEST_P(JitCompilerLR35902ConditionalTest, conditional_exit_test){
+    if(!mygbc::JitCompilerLR35902::is_supported()){
+        GTEST_SKIP() << "Compiling is not supported on this host";
+    }
+    std::tuple<uint8_t, int32_t, uint16_t, int32_t> test_values = GetParam();
+    mygbc::JitCompilerLR35902 jit_compiler;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x28, 0x05}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    ASSERT_EQ(mygbc::JitCompilerLR35902::can_compile(*block_fetch.value()), true);
+    mygbc::StatusOr<mygbc::JitCompilerLR35902::CompiledBlock> compile_result = jit_compiler.compile(*block_fetch.value());
+    ASSERT_EQ(compile_result.ok(), true);
+    mygbc::JitStateLR35902 jit_state{0x0000, std::get<0>(test_values), 0, std::get<1>(test_values)};
+    compile_result.value()(&jit_state);
+    ASSERT_EQ(jit_state.pc, std::get<2>(test_values));
+    ASSERT_EQ(jit_state.cycle_budget, std::get<3>(test_values));
+}
+
+/// @brief Initantiazation of conditional_exit_test.
+/// @details  Initantiazation of conditional_exit_test.
+INSTANTIATE_TEST_SUITE_P(
+    conditional_exit_test_cases,
+    JitCompilerLR35902ConditionalTest,
+    ::testing::Values(
+        std::make_tuple(0x80, 100, 0x0008, 84), //Z set, taken
+        std::make_tuple(0x10, 100, 0x0003, 88), //Z clear, fall trough
+        std::make_tuple(0x10, 15, 0x0000, 15) //Taken path could overshoot the budget
+    )
+);
+
+/// @brief Checks that a compiled self loop spins up to the budget.
+/// @details NOP, JR -3. Iterations of 16 ticks run while a whole one fits, pc is left at the start of the loop.
+TEST(JitCompilerLR35902Test, self_loop_budget_test){
+    if(!mygbc::JitCompilerLR35902::is_supported()){
+        GTEST_SKIP() << "Compiling is not supported on this host";
+    }
+    mygbc::JitCompilerLR35902 jit_compiler;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x00, 0x18, 0xFD}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    mygbc::StatusOr<mygbc::JitCompilerLR35902::CompiledBlock> compile_result = jit_compiler.compile(*block_fetch.value());
+    ASSERT_EQ(compile_result.ok(), true);
+    mygbc::JitStateLR35902 jit_state{0x0000, 0x00, 0, 100};
+    compile_result.value()(&jit_state);
+    ASSERT_EQ(jit_state.pc, 0x0000);
+    ASSERT_EQ(jit_state.cycle_budget, 4);
+}
+
+/// @brief Checks that a compiled block runs register ALU operations in host registers.
+/// @details INC A, SUB B, JP 0x0100. INC keeps C and sets H, SUB B zeroes A. Registers not written keep their values.
+TEST(JitCompilerLR35902Test, register_alu_test){
+    if(!mygbc::JitCompilerLR35902::is_supported()){
+        GTEST_SKIP() << "Compiling is not supported on this host";
+    }
+    mygbc::JitCompilerLR35902 jit_compiler;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x3C, 0x90, 0xC3, 0x00, 0x01}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    ASSERT_EQ(mygbc::JitCompilerLR35902::can_compile(*block_fetch.value()), true);
+    mygbc::StatusOr<mygbc::JitCompilerLR35902::CompiledBlock> compile_result = jit_compiler.compile(*block_fetch.value());
+    ASSERT_EQ(compile_result.ok(), true);
+    mygbc::JitStateLR35902 jit_state{0x0000, 0x10, 0x0F, 100, 0x10, 0x21, 0x32, 0x43, 0x54, 0x65};
+    compile_result.value()(&jit_state);
+    ASSERT_EQ(jit_state.pc, 0x0100);
+    ASSERT_EQ(jit_state.cycle_budget, 76);
+    ASSERT_EQ(jit_state.a, 0x00);
+    ASSERT_EQ(jit_state.f, 0xC0);
+    ASSERT_EQ(jit_state.b, 0x10);
+    ASSERT_EQ(jit_state.c, 0x21);
+    ASSERT_EQ(jit_state.d, 0x32);
+    ASSERT_EQ(jit_state.e, 0x43);
+    ASSERT_EQ(jit_state.h, 0x54);
+    ASSERT_EQ(jit_state.l, 0x65);
+}
+
+/// @brief Checks that blocks with unsupported instructions are not compiled.
+/// @details LD A, [HL] reads memory and CALL a16 ends the block, both are left for the threaded-code backend.
+TEST(JitCompilerLR35902Test, unsupported_block_test){
+    mygbc::JitCompilerLR35902 jit_compiler;
+    mygbc::BasicBlockCacheLR35902 block_cache;
+    mygbc::PredecodeCacheLR35902 predecode_cache;
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::AddressableMemory> program = std::make_shared<mygbc::AddressableMemory>(
+        std::vector<uint8_t>{0x7E, 0xCD, 0x00, 0x00}, true
+    );
+    ASSERT_EQ(memory_controller.mount_memory(0x0000, program).ok(), true);
+    mygbc::StatusOr<const mygbc::BasicBlockLR35902*> block_fetch = block_cache.get_block(memory_controller, 0x0000, predecode_cache);
+    ASSERT_EQ(block_fetch.ok(), true);
+    ASSERT_EQ(mygbc::JitCompilerLR35902::can_compile(*block_fetch.value()), false);
+    ASSERT_EQ(jit_compiler.compile(*block_fetch.value()).ok(), false);
+}
@@ -0,0 +1,62 @@
+#include "../../src/instruction_set_lr35902/predecode_cache_lr35902.h" //PredecodeCacheLR35902
+#include "../../src/instruction_set_lr35902/instruction_set_lr35902.h" //InstructionSetLR35902
+#include <gtest/gtest.h> //GTest
+#include <tuple> //std::tuple
+
+/// @brief Checks that stored instructions are found with the same bank tag.
+/// @details Lookup with a different bank tag or at a different address misses.
+TEST(PredecodeCacheLR35902Test, store_lookup_test){
+    const uint16_t address = 0x0150;
+    const uint32_t bank_tag = 3;
+    mygbc::PredecodeCacheLR35902 cache;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x00C3), 0x1234}; //JP a16
+    ASSERT_EQ(cache.lookup(address, bank_tag), nullptr);
+    cache.store(address, bank_tag, instruction);
+    const mygbc::DecodedInstructionLR35902* cached_instruction = cache.lookup(address, bank_tag);
+    ASSERT_NE(cached_instruction, nullptr);
+    ASSERT_EQ(cached_instruction->descriptor, instruction.descriptor);
+    ASSERT_EQ(cached_instruction->read_value, instruction.read_value);
+    ASSERT_EQ(cache.lookup(address, bank_tag + 1), nullptr);
+    ASSERT_EQ(cache.lookup(address + 1, bank_tag), nullptr);
+}
+
+class PredecodeCacheLR35902InvalidateTest : public ::testing::TestWithParam<std::tuple<uint16_t, uint16_t, bool>> {};
+
+/// @brief Checks that writes invalidate every entry containing the written bytes.
+/// @details 3 byte instruction at 0x0200 covers 0x0200-0x0202.
+TEST_P(PredecodeCacheLR35902InvalidateTest, write_invalidation_test){
+    std::tuple<uint16_t, uint16_t, bool> test_values = GetParam();
+    const uint16_t address = 0x0200;
+    const uint32_t bank_tag = 0;
+    mygbc::PredecodeCacheLR35902 cache;
+    cache.store(address, bank_tag, mygbc::DecodedInstructionLR35902{&mygbc::InstructionSetLR35902::get_descriptor(0x00C3), 0x1234}); //JP a16
+    cache.on_memory_write(std::get<0>(test_values), std::get<1>(test_values));
+    ASSERT_EQ(cache.lookup(address, bank_tag) != nullptr, std::get<2>(test_values));
+}
+
+/// @brief Initantiazation of write_invalidation_test.
+/// @details  Initantiazation of write_invalidation_test.
+INSTANTIATE_TEST_SUITE_P(
+    write_invalidation_test_cases,
+    PredecodeCacheLR35902InvalidateTest,
+    ::testing::Values(
+        std::make_tuple(0x0200, 1, false), //Opcode byte
+        std::make_tuple(0x0202, 1, false), //Last read value byte
+        std::make_tuple(0x01FF, 2, false), //Word write overlapping the opcode
+        std::make_tuple(0x0203, 1, true), //Right after the instruction
+        std::make_tuple(0x01FE, 2, true) //Word write right before the instruction
+    )
+);
+
+/// @brief Checks that invalidate_all empties the cache.
+/// @details Every stored entry misses afterwards.
+TEST(PredecodeCacheLR35902Test, invalidate_all_test){
+    const uint32_t bank_tag = 0;
+    mygbc::PredecodeCacheLR35902 cache;
+    mygbc::DecodedInstructionLR35902 instruction{&mygbc::InstructionSetLR35902::get_descriptor(0x0018), 0xFE}; //JR e8
+    cache.store(0x0000, bank_tag, instruction);
+    cache.store(0xC000, bank_tag, instruction);
+    cache.invalidate_all();
+    ASSERT_EQ(cache.lookup(0x0000, bank_tag), nullptr);
+    ASSERT_EQ(cache.lookup(0xC000, bank_tag), nullptr);
+}
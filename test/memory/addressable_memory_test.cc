@@ -57,7 +57,7 @@ TEST(AddressableMemoryReadTest, read_byte_invalid_addr_test){
 /// @details  Result of the fetch matches the expected value.
 TEST(AddressableMemoryReadTest, read_word_test){
     mygbc::AddressableMemory memory(std::vector<uint8_t>{0x00, 0x01, 0x02}, false);
-    const uint16_t expected_result = 0x0102;
+    const uint16_t expected_result = 0x0201;
     const uint16_t read_addr = 0x01;
     const bool ok_status_expected = true;
     mygbc::StatusOr<uint16_t> read_result = memory.get_word(read_addr);
@@ -94,7 +94,7 @@ TEST(AddressableMemorySetTest, set_byte_test){
 /// @details  Result of the fetch matches the expected value.
 TEST(AddressableMemorySetTest, set_word_test){
     mygbc::AddressableMemory memory(std::vector<uint8_t>{0x00, 0x01, 0x02}, false);
-    const std::vector<uint8_t> expected_result{0x00, 0x05, 0x04};
+    const std::vector<uint8_t> expected_result{0x00, 0x04, 0x05};
     const uint16_t set_addr = 0x01;
     const uint16_t set_value = 0x0504;
     const bool ok_status_expected = true;
@@ -196,4 +196,59 @@ TEST(AddressableMemoryChangeProtectedMemoryFlag, SetProtectedMemoryFlag){
     ASSERT_EQ(not_protected.is_read_only(), false);
     mygbc::AddressableMemory protected_memory(std::vector<uint8_t>{0x00, 0x01, 0x02}, true);
     ASSERT_EQ(protected_memory.is_read_only(), true);
-}
\ No newline at end of file
+}
+
+/// @brief Checks that the threading policy is kept and decides the direct pointers.
+/// @details Single owner memory is the default and exposes direct pointers, concurrently observed memory does not.
+TEST(AddressableMemoryThreadingTest, threading_policy_test){
+    mygbc::AddressableMemory single_owner_memory(std::vector<uint8_t>{0x00, 0x01}, false);
+    ASSERT_EQ(single_owner_memory.get_threading_policy(), mygbc::AddressableMemory::ThreadingPolicy::SINGLE_OWNER);
+    ASSERT_NE(single_owner_memory.get_direct_write_pointer(0x00), nullptr);
+    mygbc::AddressableMemory observed_memory(std::vector<uint8_t>{0x00, 0x01}, false, mygbc::AddressableMemory::ThreadingPolicy::CONCURRENT_OBSERVER);
+    ASSERT_EQ(observed_memory.get_threading_policy(), mygbc::AddressableMemory::ThreadingPolicy::CONCURRENT_OBSERVER);
+    ASSERT_EQ(observed_memory.get_direct_read_pointer(0x00), nullptr);
+    ASSERT_EQ(observed_memory.get_direct_write_pointer(0x00), nullptr);
+    ASSERT_EQ(observed_memory.set_word(0x00, 0xBEEF).ok(), true);
+    ASSERT_EQ(observed_memory.get_byte(0x01).value(), 0xBE);
+    mygbc::AddressableMemory default_memory;
+    ASSERT_EQ(default_memory.get_byte(0x00).ok(), false);
+}
+
+/// @brief Checks the views of the memory.
+/// @details Views alias the memory, read only memory has no write view and concurrently observed memory no views.
+TEST(AddressableMemoryViewTest, view_test){
+    mygbc::AddressableMemory memory(std::vector<uint8_t>{0x00, 0x01, 0x02}, false);
+    ASSERT_EQ(memory.get_read_view().size(), 3);
+    memory.get_write_view()[1] = 0xAB;
+    ASSERT_EQ(memory.get_byte(0x01).value(), 0xAB);
+    ASSERT_EQ(memory.get_read_view()[1], 0xAB);
+    mygbc::AddressableMemory protected_memory(std::vector<uint8_t>{0x00, 0x01}, true);
+    ASSERT_EQ(protected_memory.get_read_view().size(), 2);
+    ASSERT_EQ(protected_memory.get_write_view().empty(), true);
+    mygbc::AddressableMemory observed_memory(std::vector<uint8_t>{0x00, 0x01}, false, mygbc::AddressableMemory::ThreadingPolicy::CONCURRENT_OBSERVER);
+    ASSERT_EQ(observed_memory.get_read_view().empty(), true);
+    ASSERT_EQ(observed_memory.get_write_view().empty(), true);
+}
+
+/// @brief Checks the dirty page tracking of the memory.
+/// @details Writes mark their pages, clear resets them and read only memory tracks nothing.
+TEST(AddressableMemoryDirtyPageTest, dirty_page_test){
+    mygbc::AddressableMemory memory(std::vector<uint8_t>(0x400, 0x00), false);
+    ASSERT_EQ(memory.get_dirty_pages().empty(), true);
+    ASSERT_EQ(memory.set_byte(0x0105, 0xAB).ok(), true);
+    ASSERT_EQ(memory.set_word(0x02FF, 0x1234).ok(), true);
+    ASSERT_EQ(memory.get_dirty_pages(), (std::vector<uint16_t>{1, 2, 3}));
+    ASSERT_EQ(memory.is_page_dirty(0), false);
+    memory.clear_dirty_pages();
+    ASSERT_EQ(memory.get_dirty_pages().empty(), true);
+    ASSERT_NE(memory.get_dirty_page_flag(0x0100), nullptr);
+    ASSERT_EQ(memory.get_dirty_page_flag(0x0101), nullptr);
+    ASSERT_EQ(memory.get_direct_write_pointer(0x0101), nullptr);
+    memory.get_write_view();
+    ASSERT_EQ(memory.get_dirty_pages().size(), 4);
+    ASSERT_EQ(memory.set_memory(std::vector<uint8_t>(0x100, 0x00)).ok(), true);
+    ASSERT_EQ(memory.get_dirty_pages(), (std::vector<uint16_t>{0}));
+    mygbc::AddressableMemory protected_memory(std::vector<uint8_t>(0x100, 0x00), true);
+    ASSERT_EQ(protected_memory.get_dirty_page_flag(0x0000), nullptr);
+    ASSERT_EQ(protected_memory.get_dirty_pages().empty(), true);
+}
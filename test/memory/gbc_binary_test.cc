@@ -1,9 +1,12 @@
 #include "../../src/memory/gbc_binary.h" //GBCBinary
+#include "../../src/util/io/binary_reader.h" //BinaryReader
 #include <gtest/gtest.h> //GTest
 #include <stdexcept> //std::out_of_range
 #include <cstring> //Fixed lenght variables
 #include <vector> //std::vector
 #include <tuple> //std::tuple
+#include <fstream> //std::ofstream
+#include <cstdio> //std::remove
 
 
 //Definitions for constants
@@ -374,4 +377,47 @@ INSTANTIATE_TEST_SUITE_P(
             mygbc::GBCBinary::GBCBinaryHeaderData("", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x5137)
         ) //Global checksum
     )
-);
\ No newline at end of file
+);
+
+/// @brief Checks that GBCBinary::parse_mapped_file parses the binary straight from the mapping.
+/// @details Header and bytes match GBCBinary::parse_bytes, the mapped binary is read only.
+TEST(GBCBinaryMappedFileTest, mapped_file_parsed_correctly){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::PROTECTED_MEMORY_SET_ERROR;
+    std::vector<uint8_t> binary_data = insert_into_empty(
+        OK_SIZE_FOR_BINARY,
+        HEADER_START_ADDR,
+        std::vector<uint8_t>{
+            0x61, 0x64, 0x64, 0x5f, 0x64, 0x65, 0x6d, 0x6f, 0x2e, 0x67,
+            0x62, 0x00, 0x00, 0x00, 0x00, 0x80, 0x37, 0x31, 0x00, 0x00,
+            0x01, 0x01, 0x00, 0x01, 0x02, 0xd6, 0x1d, 0x5B
+        }
+    );
+    const std::string file_path = ::testing::TempDir() + "gbc_binary_mapped_file_test.gbc";
+    {
+        std::ofstream binary_file(file_path, std::ios::binary);
+        binary_file.write(reinterpret_cast<const char*>(binary_data.data()), binary_data.size());
+    }
+    mygbc::StatusOr<std::shared_ptr<const mygbc::MappedFile>> mapped_file = mygbc::BinaryReader::map_as_bytes(file_path);
+    std::remove(file_path.c_str());
+    ASSERT_EQ(mapped_file.ok(), true);
+    ASSERT_EQ(mapped_file.value()->get_size(), binary_data.size());
+    mygbc::StatusOr<mygbc::GBCBinary> mapped_binary = mygbc::GBCBinary::parse_mapped_file(mapped_file.value());
+    mygbc::StatusOr<mygbc::GBCBinary> binary = mygbc::GBCBinary::parse_bytes(binary_data);
+    ASSERT_EQ(mapped_binary.ok(), true);
+    ASSERT_EQ(mapped_binary.value().is_shared(), true);
+    ASSERT_EQ(mapped_binary.value().is_read_only(), true);
+    ASSERT_TRUE(mapped_binary.value().get_header_data() == binary.value().get_header_data());
+    ASSERT_EQ(mapped_binary.value().has_valid_header(), true);
+    ASSERT_EQ(mapped_binary.value().get_memory(), binary_data);
+    ASSERT_EQ(mapped_binary.value().get_bytes().data(), mapped_file.value()->get_bytes().data());
+    ASSERT_EQ(mapped_binary.value().get_word(0x143).value(), binary.value().get_word(0x143).value());
+    ASSERT_EQ(mapped_binary.value().set_byte(0x0000, 0x01).code(), expected_status);
+}
+
+/// @brief Checks that mapping a missing file gives a error status.
+TEST(GBCBinaryMappedFileTest, missing_file_not_mapped){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::IO_ERROR;
+    mygbc::StatusOr<std::shared_ptr<const mygbc::MappedFile>> mapped_file = mygbc::BinaryReader::map_as_bytes(::testing::TempDir() + "does_not_exist.gbc");
+    ASSERT_EQ(mapped_file.ok(), false);
+    ASSERT_EQ(mapped_file.status().code(), expected_status);
+}
@@ -0,0 +1,87 @@
+#include "../../src/memory/memory_arena.h" //MemoryArena
+#include "../../src/memory/arena_memory.h" //ArenaMemory
+#include "../../src/components/memory_controller.h" //MemoryController
+#include <gtest/gtest.h> //GTest
+#include <cstdint> //uintptr_t
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+/// @brief Checks the layout of the arena.
+/// @details Regions are zeroed and start at page boundaries, pages are page aligned.
+TEST(MemoryArenaTest, layout_test){
+    mygbc::MemoryArena arena(std::vector<std::size_t>{0x2000, 0xA0, 0x100});
+    ASSERT_EQ(arena.get_region_count(), 3);
+    ASSERT_EQ(arena.get_region_offset(1), 0x2000);
+    ASSERT_EQ(arena.get_region_offset(2), 0x2100);
+    ASSERT_EQ(arena.get_size(), 0x2200);
+    ASSERT_EQ(arena.get_region_size(1), 0x100);
+    ASSERT_EQ(arena.get_region_size(3), 0);
+    ASSERT_EQ(arena.get_page(0x21) - arena.get_page(0x20), mygbc::MemoryArena::region_alignment);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(arena.get_page(0)) % mygbc::MemoryArena::region_alignment, 0);
+    ASSERT_EQ(arena.get_byte(0x21FF), 0x00);
+}
+
+/// @brief Checks that clones do not alias the arena and reset zeroes it.
+/// @details Reset marks every page dirty.
+TEST(MemoryArenaTest, clone_and_reset_test){
+    mygbc::MemoryArena arena(std::vector<std::size_t>{0x100, 0x100});
+    arena.set_byte(0x110, 0xAB);
+    std::shared_ptr<mygbc::MemoryArena> arena_clone = arena.clone();
+    ASSERT_EQ(arena_clone->get_byte(0x110), 0xAB);
+    arena_clone->set_byte(0x110, 0xCD);
+    ASSERT_EQ(arena.get_byte(0x110), 0xAB);
+    arena.reset();
+    ASSERT_EQ(arena.get_byte(0x110), 0x00);
+    ASSERT_EQ(arena_clone->get_byte(0x110), 0xCD);
+    ASSERT_EQ(arena.get_dirty_pages().get_dirty_pages(), (std::vector<uint16_t>{0, 1}));
+}
+
+/// @brief Checks that a clone shares the pages until written.
+/// @details First write to a shared page copies only that page and moves the direct pointer generation,
+///          direct writes are withheld from shared pages.
+TEST(MemoryArenaTest, copy_on_write_test){
+    mygbc::MemoryArena arena(std::vector<std::size_t>{0x100, 0x2000});
+    std::shared_ptr<mygbc::MemoryArena> arena_clone = arena.clone();
+    for(std::size_t page = 0; page < arena.get_size() / mygbc::MemoryArena::region_alignment; ++page){
+        ASSERT_EQ(arena_clone->get_page(page), arena.get_page(page));
+        ASSERT_EQ(arena_clone->is_page_shared(page), true);
+        ASSERT_EQ(arena.is_page_shared(page), true);
+    }
+    ASSERT_EQ(arena_clone->get_direct_write_page(2), nullptr);
+    const uint32_t generation = *arena_clone->get_direct_pointer_generation_counter();
+    arena_clone->set_byte(0x210, 0x56);
+    arena_clone->set_byte(0x211, 0x78);
+    ASSERT_EQ(arena_clone->get_copied_page_count(), 1);
+    ASSERT_NE(*arena_clone->get_direct_pointer_generation_counter(), generation);
+    ASSERT_NE(arena_clone->get_page(2), arena.get_page(2));
+    ASSERT_EQ(arena_clone->get_page(3), arena.get_page(3));
+    ASSERT_EQ(arena_clone->is_page_shared(2), false);
+    ASSERT_NE(arena_clone->get_direct_write_page(2), nullptr);
+    ASSERT_EQ(arena.get_byte(0x210), 0x00);
+    //Original still holds the page it shared, it copies it too on write
+    ASSERT_EQ(arena.is_page_shared(2), true);
+    arena.set_byte(0x210, 0x12);
+    ASSERT_EQ(arena.get_copied_page_count(), 1);
+    ASSERT_EQ(arena_clone->get_byte(0x210), 0x56);
+}
+
+/// @brief Checks views over the arena.
+/// @details Views of the same region alias, writes trough the controller mark the pages of the arena and clones view one arena clone.
+TEST(MemoryArenaTest, arena_memory_test){
+    std::shared_ptr<mygbc::MemoryArena> arena = std::make_shared<mygbc::MemoryArena>(std::vector<std::size_t>{0x100, 0x2000});
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(0xC000, std::make_shared<mygbc::ArenaMemory>(arena, 1)).ok(), true);
+    ASSERT_EQ(memory_controller.mount_memory(0xE000, std::make_shared<mygbc::ArenaMemory>(arena, 1, 0, 0x1E00)).ok(), true);
+    ASSERT_EQ(memory_controller.set_word(0xE010, 0x1234).ok(), true);
+    ASSERT_EQ(memory_controller.get_word(0xC010).value(), 0x1234);
+    ASSERT_EQ(arena->get_dirty_pages().get_dirty_pages(), (std::vector<uint16_t>{1}));
+    mygbc::MemoryCloneMap clones;
+    mygbc::StatusOr<mygbc::MemoryController> controller_clone = memory_controller.clone(clones);
+    ASSERT_EQ(controller_clone.ok(), true);
+    ASSERT_EQ(clones.count(arena.get()), 1);
+    ASSERT_EQ(controller_clone.value().set_byte(0xC010, 0x56).ok(), true);
+    ASSERT_EQ(controller_clone.value().get_byte(0xE010).value(), 0x56);
+    ASSERT_EQ(memory_controller.get_byte(0xC010).value(), 0x34);
+    mygbc::ArenaMemory view(arena, 1);
+    ASSERT_EQ(view.set_memory(std::vector<uint8_t>(0x10, 0x00)).ok(), false);
+}
@@ -0,0 +1,248 @@
+#include "../../src/memory/memory_bank_controller.h" //MemoryBankController
+#include "../../src/components/memory_controller.h" //MemoryController
+#include <gtest/gtest.h> //GTest
+#include <memory> //std::shared_ptr
+#include <vector> //std::vector
+
+namespace{
+    /// @brief Builds a ROM whose every byte holds the number of its bank.
+    /// @param bank_count Banks in the ROM
+    /// @return ROM image.
+    std::vector<uint8_t> make_rom(const std::size_t bank_count){
+        std::vector<uint8_t> rom(bank_count * mygbc::MemoryBankController::rom_bank_size);
+        for(std::size_t i = 0; i < rom.size(); ++i){
+            rom[i] = static_cast<uint8_t>(i / mygbc::MemoryBankController::rom_bank_size);
+        }
+        return rom;
+    }
+
+    /// @brief Builds the controller and mounts its views.
+    /// @param memory_controller Memory controller to mount to
+    /// @param cartridge_type Cartridge type header byte
+    /// @param bank_count Banks in the ROM
+    /// @param ram_size_code RAM size header byte
+    /// @return Controller.
+    std::shared_ptr<mygbc::MemoryBankController> mount_cartridge(mygbc::MemoryController& memory_controller, const uint8_t cartridge_type, const std::size_t bank_count, const uint8_t ram_size_code){
+        mygbc::StatusOr<std::shared_ptr<mygbc::MemoryBankController>> controller = mygbc::MemoryBankController::create(cartridge_type, make_rom(bank_count), ram_size_code);
+        EXPECT_EQ(controller.ok(), true);
+        EXPECT_EQ(memory_controller.mount_memory(mygbc::MemoryBankController::rom_mount_address, controller.value()->get_rom_view()).ok(), true);
+        EXPECT_EQ(memory_controller.mount_memory(mygbc::MemoryBankController::ram_mount_address, controller.value()->get_ram_view()).ok(), true);
+        return controller.value();
+    }
+}
+
+/// @brief Checks the ROM bank switching of MBC1.
+/// @details Bank 0 selects bank 1, switches repoint the pages of the memory controller. Only the contents tags of the
+///          switched pages and the page before them change, the mapping generation is kept.
+TEST(MemoryBankControllerTest, mbc1_rom_bank_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x01, 64, 0x00);
+    ASSERT_EQ(controller->get_type(), mygbc::MemoryBankController::Type::MBC1);
+    ASSERT_EQ(memory_controller.get_byte(0x0000).value(), 0);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 1);
+    const uint32_t generation = memory_controller.get_mapping_generation();
+    const uint64_t fixed_tag = memory_controller.get_contents_tag(0x0000);
+    const uint64_t boundary_tag = memory_controller.get_contents_tag(0x3F00);
+    const uint64_t switchable_tag = memory_controller.get_contents_tag(0x4000);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x05).ok(), true);
+    ASSERT_EQ(controller->get_rom_bank(), 5);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 5);
+    ASSERT_EQ(memory_controller.get_byte(0x7FFF).value(), 5);
+    ASSERT_EQ(memory_controller.get_mapping_generation(), generation);
+    ASSERT_EQ(memory_controller.get_contents_tag(0x0000), fixed_tag);
+    ASSERT_NE(memory_controller.get_contents_tag(0x3F00), boundary_tag);
+    ASSERT_NE(memory_controller.get_contents_tag(0x4000), switchable_tag);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x00).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 1);
+    //Bank seen before gets its old tags back
+    ASSERT_EQ(memory_controller.get_contents_tag(0x3F00), boundary_tag);
+    ASSERT_EQ(memory_controller.get_contents_tag(0x4000), switchable_tag);
+    //Upper bits, mode 1 maps them to the fixed area as well
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x01).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 33);
+    ASSERT_EQ(memory_controller.get_byte(0x0000).value(), 0);
+    ASSERT_EQ(memory_controller.set_byte(0x6000, 0x01).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x0000).value(), 32);
+    //ROM stays untouched
+    ASSERT_EQ(memory_controller.get_byte(0x2000).value(), 32);
+}
+
+/// @brief Checks the ROM bank switching of MBC5.
+/// @details Bank 0 is selectable, bit 8 comes from its own register, banks wrap at the ROM size.
+TEST(MemoryBankControllerTest, mbc5_rom_bank_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x19, 8, 0x00);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x00).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 0);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x06).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 6);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x0B).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 3);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x02).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x3000, 0x01).ok(), true);
+    ASSERT_EQ(controller->get_rom_bank(), (0x102 % 8));
+}
+
+/// @brief Checks the RAM enable and RAM banks.
+/// @details Disabled RAM reads as 0xFF and ignores writes, banks keep their own contents.
+TEST(MemoryBankControllerTest, ram_bank_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x1B, 4, 0x03);
+    const uint32_t generation = memory_controller.get_mapping_generation();
+    const uint64_t disabled_tag = memory_controller.get_contents_tag(0xA000);
+    ASSERT_EQ(memory_controller.set_byte(0xA000, 0x12).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 0xFF);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    ASSERT_EQ(controller->is_ram_enabled(), true);
+    //Enabling the RAM maps other contents at the RAM pages only
+    ASSERT_EQ(memory_controller.get_mapping_generation(), generation);
+    ASSERT_NE(memory_controller.get_contents_tag(0xA000), disabled_tag);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 0x00);
+    ASSERT_EQ(memory_controller.set_word(0xA000, 0x1234).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x02).ok(), true);
+    ASSERT_EQ(controller->get_ram_bank(), 2);
+    ASSERT_EQ(memory_controller.get_word(0xA000).value(), 0x0000);
+    ASSERT_EQ(memory_controller.set_byte(0xBFFF, 0x56).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x00).ok(), true);
+    ASSERT_EQ(memory_controller.get_word(0xA000).value(), 0x1234);
+    ASSERT_EQ(controller->get_ram()[2 * mygbc::MemoryBankController::ram_bank_size + 0x1FFF], 0x56);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x00).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 0xFF);
+}
+
+/// @brief Checks the dirty page tracking of the cartridge RAM.
+/// @details Pages are tracked in the RAM image, so writes to a switched bank mark the pages of that bank.
+TEST(MemoryBankControllerTest, dirty_ram_page_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x1B, 4, 0x03);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA000, 0x12).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x01).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA105, 0x34).ok(), true);
+    const uint16_t bank_one_page = mygbc::MemoryBankController::ram_bank_size / mygbc::DirtyPageTracker::page_size;
+    ASSERT_EQ(controller->get_dirty_ram_pages(), (std::vector<uint16_t>{0, static_cast<uint16_t>(bank_one_page + 1)}));
+    controller->clear_dirty_ram_pages();
+    ASSERT_EQ(controller->get_dirty_ram_pages().empty(), true);
+}
+
+/// @brief Checks that the views of a cartridge clone to a single controller.
+/// @details Clone keeps the banks and RAM, control writes and RAM writes of the clone are not seen by the original.
+TEST(MemoryBankControllerTest, clone_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x1B, 4, 0x03);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x02).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA000, 0x12).ok(), true);
+    mygbc::StatusOr<mygbc::MemoryController> controller_clone = memory_controller.clone();
+    ASSERT_EQ(controller_clone.ok(), true);
+    mygbc::MemoryController& memory_clone = controller_clone.value();
+    ASSERT_EQ(memory_clone.get_byte(0x4000).value(), 2);
+    ASSERT_EQ(memory_clone.get_byte(0xA000).value(), 0x12);
+    ASSERT_EQ(memory_clone.set_byte(0x2000, 0x03).ok(), true);
+    ASSERT_EQ(memory_clone.set_byte(0xA000, 0x34).ok(), true);
+    ASSERT_EQ(memory_clone.set_byte(0x4000, 0x01).ok(), true);
+    ASSERT_EQ(memory_clone.get_byte(0x4000).value(), 3);
+    ASSERT_EQ(memory_clone.get_byte(0xA000).value(), 0x00);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 2);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 0x12);
+    ASSERT_EQ(controller->get_rom_bank(), 2);
+}
+
+/// @brief Checks that a controller clone shares the RAM pages until written.
+/// @details Direct writes are withheld from shared pages, the first write copies only its page and moves the direct pointer generation.
+TEST(MemoryBankControllerTest, clone_ram_copy_on_write_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x03, 4, 0x03);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA110, 0x12).ok(), true);
+    mygbc::MemoryCloneMap clones;
+    mygbc::StatusOr<mygbc::MemoryController> controller_clone = memory_controller.clone(clones);
+    ASSERT_EQ(controller_clone.ok(), true);
+    std::shared_ptr<mygbc::SystemMemoryInterface> ram_view = controller->get_ram_view();
+    std::shared_ptr<mygbc::SystemMemoryInterface> ram_view_clone = std::static_pointer_cast<mygbc::MemoryBankController>(clones.at(controller.get()))->get_ram_view();
+    for(uint16_t addr = 0x0000; addr < 0x2000; addr += 0x100){
+        ASSERT_EQ(ram_view_clone->get_direct_read_pointer(addr), ram_view->get_direct_read_pointer(addr));
+        ASSERT_EQ(ram_view_clone->get_direct_write_pointer(addr), nullptr);
+        ASSERT_EQ(ram_view->get_direct_write_pointer(addr), nullptr);
+    }
+    const uint32_t generation = *ram_view_clone->get_direct_pointer_generation_counter();
+    ASSERT_EQ(controller_clone.value().set_byte(0xA110, 0x34).ok(), true);
+    ASSERT_EQ(controller_clone.value().set_byte(0xA111, 0x56).ok(), true);
+    ASSERT_NE(*ram_view_clone->get_direct_pointer_generation_counter(), generation);
+    for(uint16_t addr = 0x0000; addr < 0x2000; addr += 0x100){
+        const bool copied = (addr == 0x0100);
+        ASSERT_EQ(ram_view_clone->get_direct_read_pointer(addr) != ram_view->get_direct_read_pointer(addr), copied);
+        ASSERT_EQ(ram_view_clone->get_direct_write_pointer(addr) != nullptr, copied);
+    }
+    ASSERT_EQ(controller_clone.value().get_byte(0xA110).value(), 0x34);
+    ASSERT_EQ(memory_controller.get_byte(0xA110).value(), 0x12);
+    ASSERT_EQ(controller->get_ram()[0x110], 0x12);
+}
+
+/// @brief Checks the built-in half byte RAM of MBC2.
+/// @details Upper half reads as set, RAM repeats every 512 bytes.
+TEST(MemoryBankControllerTest, mbc2_ram_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x06, 16, 0x00);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA001, 0xAB).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA001).value(), 0xFB);
+    ASSERT_EQ(memory_controller.get_byte(0xA201).value(), 0xFB);
+    ASSERT_EQ(memory_controller.set_byte(0x0100, 0x07).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 7);
+}
+
+/// @brief Checks the real time clock of MBC3.
+/// @details Reads see the latched clock, advance cascades the registers and sets the day carry.
+TEST(MemoryBankControllerTest, mbc3_real_time_clock_test){
+    mygbc::MemoryController memory_controller;
+    std::shared_ptr<mygbc::MemoryBankController> controller = mount_cartridge(memory_controller, 0x10, 4, 0x03);
+    ASSERT_EQ(memory_controller.set_byte(0x0000, 0x0A).ok(), true);
+    controller->advance_real_time_clock(3 * 3600 + 2 * 60 + 1);
+    ASSERT_EQ(controller->get_real_time_clock().hours, 3);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x0A).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 0);
+    ASSERT_EQ(memory_controller.set_byte(0x6000, 0x00).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x6000, 0x01).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 3);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x09).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 2);
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x08).ok(), true);
+    ASSERT_EQ(memory_controller.get_byte(0xA000).value(), 1);
+    controller->advance_real_time_clock(512u * 24 * 3600);
+    ASSERT_EQ(controller->get_real_time_clock().days_high & 0x80, 0x80);
+    //Halted clock does not advance
+    ASSERT_EQ(memory_controller.set_byte(0x4000, 0x0C).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0xA000, 0x40).ok(), true);
+    controller->advance_real_time_clock(10);
+    ASSERT_EQ(controller->get_real_time_clock().seconds, 1);
+}
+
+/// @brief Checks that unsupported cartridge types are rejected.
+TEST(MemoryBankControllerTest, unsupported_type_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_BINARY_ERROR;
+    mygbc::StatusOr<std::shared_ptr<mygbc::MemoryBankController>> controller = mygbc::MemoryBankController::create(0xFC, make_rom(2), 0x00);
+    ASSERT_EQ(controller.ok(), false);
+    ASSERT_EQ(controller.status().code(), expected_status);
+}
+
+/// @brief Checks that a controller built from a shared binary maps the image of the binary instead of a copy.
+/// @details MBC1 header, the switchable bank points into the image once switched.
+TEST(MemoryBankControllerTest, shared_binary_test){
+    const uint8_t cartridge_type = 0x01;
+    std::shared_ptr<const std::vector<uint8_t>> image = std::make_shared<const std::vector<uint8_t>>(make_rom(4));
+    mygbc::GBCBinary binary(
+        mygbc::GBCBinary::GBCBinaryHeaderData("a", 0, 0, 0, cartridge_type, 0, 0, 0, 0, 0, 0, 0), true, true, image, std::span<const uint8_t>(*image)
+    );
+    mygbc::StatusOr<std::shared_ptr<mygbc::MemoryBankController>> controller = mygbc::MemoryBankController::create_from_binary(binary);
+    ASSERT_EQ(controller.ok(), true);
+    ASSERT_EQ(controller.value()->get_type(), mygbc::MemoryBankController::Type::MBC1);
+    mygbc::MemoryController memory_controller;
+    ASSERT_EQ(memory_controller.mount_memory(mygbc::MemoryBankController::rom_mount_address, controller.value()->get_rom_view()).ok(), true);
+    ASSERT_EQ(memory_controller.set_byte(0x2000, 0x03).ok(), true);
+    ASSERT_EQ(controller.value()->get_rom_view()->get_direct_read_pointer(0x4000), image->data() + 3 * mygbc::MemoryBankController::rom_bank_size);
+    //Image outlives the binary trough the controller
+    binary.free();
+    image.reset();
+    ASSERT_EQ(memory_controller.get_byte(0x4000).value(), 3);
+}
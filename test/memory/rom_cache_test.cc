@@ -0,0 +1,58 @@
+#include "../../src/memory/rom_cache.h" //RomCache
+#include "../../src/util/external/crc32.h" //CRC32
+#include <gtest/gtest.h> //GTest
+#include <vector> //std::vector
+#include <optional> //std::optional
+
+namespace{
+    /// @brief Builds a ROM large enough to hold a header.
+    /// @param fill Value of every byte
+    /// @return ROM image.
+    std::vector<uint8_t> make_rom(const uint8_t fill){
+        return std::vector<uint8_t>(0x8000, fill);
+    }
+}
+
+/// @brief Checks that the same ROM is held once and shared by its views.
+/// @details Views point into the same image, a different ROM gets its own image.
+TEST(RomCacheTest, image_shared_test){
+    mygbc::RomCache& cache = mygbc::RomCache::instance();
+    const std::size_t initial_count = cache.get_image_count();
+    const std::vector<uint8_t> rom = make_rom(0x11);
+    const std::vector<uint8_t> rom_copy = make_rom(0x11);
+    const std::vector<uint8_t> other_rom = make_rom(0x22);
+    mygbc::StatusOr<mygbc::GBCBinary> first = cache.get_binary(rom);
+    mygbc::StatusOr<mygbc::GBCBinary> second = cache.get_binary(rom_copy);
+    mygbc::StatusOr<mygbc::GBCBinary> other = cache.get_binary(other_rom);
+    ASSERT_EQ(first.ok(), true);
+    ASSERT_EQ(second.ok(), true);
+    ASSERT_EQ(other.ok(), true);
+    ASSERT_EQ(first.value().is_shared(), true);
+    ASSERT_EQ(first.value().get_bytes().data(), second.value().get_bytes().data());
+    ASSERT_NE(first.value().get_bytes().data(), rom.data());
+    ASSERT_NE(first.value().get_bytes().data(), other.value().get_bytes().data());
+    ASSERT_TRUE(first.value().get_header_data() == second.value().get_header_data());
+    ASSERT_EQ(second.value().get_byte(0x7FFF).value(), 0x11);
+    ASSERT_EQ(cache.get_image_count(), initial_count + 2);
+}
+
+/// @brief Checks that images are released with their last view.
+TEST(RomCacheTest, image_released_test){
+    mygbc::RomCache& cache = mygbc::RomCache::instance();
+    const std::size_t initial_count = cache.get_image_count();
+    std::optional<mygbc::GBCBinary> binary;
+    binary.emplace(cache.get_binary(make_rom(0x33)).value());
+    ASSERT_EQ(cache.get_image_count(), initial_count + 1);
+    binary.reset();
+    ASSERT_EQ(cache.get_image_count(), initial_count);
+}
+
+/// @brief Checks that the checksum matches the CRC32 of the ROM and that too small ROMs are rejected.
+TEST(RomCacheTest, checksum_and_invalid_rom_test){
+    const mygbc::Status::StatusType expected_status = mygbc::Status::StatusType::INVALID_BINARY_ERROR;
+    const std::vector<uint8_t> rom = make_rom(0x44);
+    ASSERT_EQ(mygbc::RomCache::get_checksum(rom), external::CRC32(rom.data(), static_cast<uint32_t>(rom.size())));
+    mygbc::StatusOr<mygbc::GBCBinary> binary = mygbc::RomCache::instance().get_binary(std::vector<uint8_t>(0x10, 0x00));
+    ASSERT_EQ(binary.ok(), false);
+    ASSERT_EQ(binary.status().code(), expected_status);
+}
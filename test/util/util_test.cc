@@ -84,4 +84,14 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple("abc\0\0\0", "abc"),
         std::make_tuple("\0abc", "\0abc")
     )
-);
\ No newline at end of file
+);
+
+/// @brief Checks that words are loaded and stored low byte first at unaligned addresses.
+TEST(UtilWordAccessTest, little_endian_word_test){
+    uint8_t bytes[4] = {0x00, 0x12, 0x34, 0x00};
+    ASSERT_EQ(mygbc::Util::load_little_endian_word(bytes + 1), 0x3412);
+    mygbc::Util::store_little_endian_word(bytes + 2, 0xABCD);
+    ASSERT_EQ(bytes[1], 0x12);
+    ASSERT_EQ(bytes[2], 0xCD);
+    ASSERT_EQ(bytes[3], 0xAB);
+}